@@ -26,6 +26,7 @@
 #include "Engine/Graphics/Image.h"
 #include "Engine/Graphics/TurnBasedOverlay.h"
 #include "Engine/Localization.h"
+#include "Engine/MapAssetManifest.h"
 #include "Engine/LodTextureCache.h"
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/Chest.h"
@@ -860,6 +861,7 @@ void Game::processQueuedMessages() {
                     }
                     pSpriteFrameTable->ResetLoadedFlags();
                     pCurrentMapName = pOut;
+                    beginMapAssetCapture(pCurrentMapName.substr(0, pCurrentMapName.rfind('.')));
                     Level_LoadEvtAndStr(pCurrentMapName.substr(0, pCurrentMapName.rfind('.')));
                     _decalBuilder->Reset(0);
                     uLevelMapStatsID = pMapStats->GetMapInfo(pCurrentMapName);
@@ -1,5 +1,7 @@
 #include "GameConfig.h"
 
+#include <initializer_list>
+
 #include "Library/Logger/Logger.h"
 #include "Library/Serialization/EnumSerialization.h"
 
@@ -17,5 +19,20 @@ MM_DEFINE_ENUM_SERIALIZATION_FUNCTIONS(PlatformWindowMode, CASE_INSENSITIVE, {
     {WINDOW_MODE_FULLSCREEN_BORDERLESS, "3"}
 });
 
-GameConfig::GameConfig() = default;
+GameConfig::GameConfig() {
+    std::initializer_list<AnyConfigEntry *> snapshotEntries = {
+        &gameplay.FloorChecksEps, &gameplay.Gravity, &gameplay.MaxFlightHeight, &gameplay.NoPartyActorCollisions
+    };
+    for (AnyConfigEntry *entry : snapshotEntries)
+        entry->addListener([this] { updateSnapshot(); });
+    updateSnapshot();
+}
+
 GameConfig::~GameConfig() = default;
+
+void GameConfig::updateSnapshot() {
+    _snapshot.floorChecksEps = gameplay.FloorChecksEps.value();
+    _snapshot.gravity = gameplay.Gravity.value();
+    _snapshot.maxFlightHeight = gameplay.MaxFlightHeight.value();
+    _snapshot.noPartyActorCollisions = gameplay.NoPartyActorCollisions.value();
+}
@@ -34,6 +34,22 @@ class GameConfig : public Config {
     using String = ConfigEntry<std::string>;
     using Key = ConfigEntry<PlatformKey>;
 
+    /**
+     * Plain copy of the config values that are read in hot loops, e.g. in collision code and in floor level queries.
+     * Reading these doesn't go through `std::any_cast`. The copy is updated every time one of the source config
+     * entries changes.
+     */
+    struct Snapshot {
+        int floorChecksEps = 0;
+        int gravity = 0;
+        int maxFlightHeight = 0;
+        bool noPartyActorCollisions = false;
+    };
+
+    const Snapshot &snapshot() const {
+        return _snapshot;
+    }
+
     class Debug : public ConfigSection {
      public:
         explicit Debug(GameConfig *config) : ConfigSection(config, "debug") {}
@@ -61,6 +77,9 @@ class GameConfig : public Config {
 
         Bool ShowFPS = {this, "show_fps", false, "Show debug HUD with FPS and other debug information."};
 
+        Bool ShowProfiler = {this, "show_profiler", false,
+                             "Enable the profiler and show per-zone CPU timings, averaged over the last second."};
+
         Bool ShowPickedFace = {this, "show_picked_face", false,
                                "Face pointed with mouse will flash with red for buildings or green for dungeons."};
 
@@ -98,6 +117,10 @@ class GameConfig : public Config {
 
         Bool FullMonsterID = { this, "full_monster_id", false, "Full monster info on popup." };
 
+        Bool VerifyDetectionCache = {this, "verify_detection_cache", false,
+                                     "Check cached line of sight results for monster detection against freshly computed ones, "
+                                     "and log an error on mismatch."};
+
      private:
         static int ValidateFrameTime(int frameTime) {
             return std::max(frameTime, 1);
@@ -353,14 +376,30 @@ class GameConfig : public Config {
 
         Int Gamma = {this, "gamma", 4, &ValidateGamma, "Gamma level, can be used to adjust brightness."};
 
+        Int ImageCpuBudget = {this, "image_cpu_budget", 0, &ValidateCacheBudget,
+                              "Max size of decoded images kept in memory, in MiB. Least recently used images are freed first and "
+                              "are reloaded when needed again. Use 0 for no limit."};
+        Int ImageGpuBudget = {this, "image_gpu_budget", 0, &ValidateCacheBudget,
+                              "Max size of textures kept on the GPU, in MiB. Least recently used textures are freed first and "
+                              "are uploaded again when needed. Use 0 for no limit."};
+
         Int HouseMovieX1 = {this, "house_movie_x1", 8, "Viewport top-left offset for in-house movies."};
         Int HouseMovieY1 = {this, "house_movie_y1", 8, "Viewport top-left offset for in-house movies."};
 
         Int HouseMovieX2 = {this, "house_movie_x2", 172, "Viewport bottom-right offset for in-house movies."};
         Int HouseMovieY2 = {this, "house_movie_y2", 128, "Viewport bottom-right offset for in-house movies."};
 
+        Int LodCacheBudget = {this, "lod_cache_budget", 0, &ValidateCacheBudget,
+                              "Max size of decoded LOD data kept in memory by each of the texture and sprite LOD caches, in MiB. "
+                              "Use 0 for no limit."};
+
         Int MaxVisibleSectors = {this, "maxvisiblesectors", 10, &ValidateMaxSectors, "Max number of BSP sectors to display."};
 
+        Int ParticleCapacity = {this, "particle_capacity", 2000, &ValidateParticleCapacity,
+                                "Max number of particles alive at the same time. Spells like Meteor Shower and Armageddon "
+                                "spawn lots of particles, new particles are dropped once this limit is reached. "
+                                "Original game used 500."};
+
         Bool SeasonsChange = {this, "seasons_change", true,
                               "Allow changing trees/ground depending on current season (originally was only used in MM6)."};
 
@@ -396,6 +435,12 @@ class GameConfig : public Config {
         static int ValidateGamma(int level) {
             return std::clamp(level, 0, 9);
         }
+        static int ValidateCacheBudget(int budget) {
+            return std::max(budget, 0);
+        }
+        static int ValidateParticleCapacity(int capacity) {
+            return std::clamp(capacity, 100, 1000000);
+        }
         static int ValidateMaxSectors(int sectors) {
             return std::clamp(sectors, 1, 150);
         }
@@ -602,5 +647,11 @@ class GameConfig : public Config {
     };
 
     Window window{ this };
+
+ private:
+    void updateSnapshot();
+
+ private:
+    Snapshot _snapshot;
 };
 
@@ -1,5 +1,6 @@
 #include "GameStarter.h"
 
+#include <exception>
 #include <utility>
 #include <filesystem>
 #include <string>
@@ -30,7 +31,9 @@
 #include "Library/Logger/BufferLogSink.h"
 #include "Library/Platform/Interface/Platform.h"
 #include "Library/Platform/Null/NullPlatform.h"
+#include "Library/Profiler/Profiler.h"
 
+#include "Utility/Streams/FileOutputStream.h"
 #include "Utility/DataPath.h"
 #include "Utility/Exception.h"
 
@@ -138,6 +141,11 @@ GameStarter::GameStarter(GameStarterOptions options): _options(std::move(options
 
     // Init game.
     _game = std::make_unique<Game>(_application.get(), _config);
+
+    // Init profiler. Overlay needs it enabled too.
+    auto updateProfiler = [this] { Profiler::setEnabled(!_options.profilePath.empty() || _config->debug.ShowProfiler.value()); };
+    _config->debug.ShowProfiler.addListener(updateProfiler);
+    updateProfiler();
 }
 
 GameStarter::~GameStarter() {
@@ -189,6 +197,18 @@ void GameStarter::resolvePaths(Environment *environment, GameStarterOptions* opt
 void GameStarter::run() {
     _game->run();
 
+    if (!_options.profilePath.empty()) {
+        Profiler::setEnabled(false);
+        try {
+            FileOutputStream stream(_options.profilePath);
+            Profiler::writeChromeTrace(&stream);
+            stream.close();
+            logger->info("Profile written to '{}'.", _options.profilePath);
+        } catch (const std::exception &e) {
+            logger->error("Could not write profile '{}': {}", _options.profilePath, e.what());
+        }
+    }
+
     if (_options.useConfig) {
         _config->save(_options.configPath);
         logger->info("Configuration file '{}' saved!", _options.configPath);
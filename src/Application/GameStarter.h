@@ -35,7 +35,14 @@ class GameStarter {
 
     void runInstrumented(std::function<void(EngineController *)> controlRoutine);
 
- private:
+    /**
+     * Fills in the data & config paths in the provided options if they are not set, the same way it's done when
+     * constructing a `GameStarter`.
+     *
+     * @param environment               Environment to look up the game paths in.
+     * @param[in,out] options           Options to update.
+     * @param logger                    Logger to report the data path candidates to.
+     */
     static void resolvePaths(Environment *environment, GameStarterOptions* options, Logger *logger);
 
  private:
@@ -14,4 +14,5 @@ struct GameStarterOptions {
     std::optional<LogLevel> logLevel; // Override log level.
     bool headless = false; // Run in headless mode.
     bool tracingRng = false; // Use tracing random engine?
+    std::string profilePath; // Path to write profiler zones to in Chrome trace format, empty means don't profile.
 };
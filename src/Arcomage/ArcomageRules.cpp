@@ -0,0 +1,817 @@
+#include "ArcomageRules.h"
+
+#include <cassert>
+#include <array>
+#include <utility>
+
+#include "Library/Random/RandomEngine.h"
+
+#include "Utility/IndexedArray.h"
+
+struct ArcomageStartConditions {
+    int16_t max_tower;
+    int16_t max_resources;
+    int16_t tower_height;
+    int16_t wall_height;
+    int16_t quarry_level;
+    int16_t magic_level;
+    int16_t zoo_level;
+    int16_t bricks_amount;
+    int16_t gems_amount;
+    int16_t beasts_amount;
+    int mastery_lvl;
+};
+
+static constexpr IndexedArray<ArcomageStartConditions, HOUSE_FIRST_ARCOMAGE_TAVERN, HOUSE_LAST_ARCOMAGE_TAVERN> start_conditions = {
+    {HOUSE_TAVERN_HARMONDALE,       {30, 100, 15, 5, 2, 2, 2, 10, 10, 10, 0}},
+    {HOUSE_TAVERN_ERATHIA,          {50, 150, 20, 5, 2, 2, 2, 5, 5, 5, 1}},
+    {HOUSE_TAVERN_TULAREAN_FOREST,  {50, 150, 20, 5, 2, 2, 2, 5, 5, 5, 2}},
+    {HOUSE_TAVERN_DEYJA,            {75, 200, 25, 10, 3, 3, 3, 5, 5, 5, 2}},
+    {HOUSE_TAVERN_BRACADA_DESERT,   {75, 200, 20, 10, 3, 3, 3, 5, 5, 5, 1}},
+    {HOUSE_TAVERN_CELESTE,          {100, 300, 30, 15, 4, 4, 4, 10, 10, 10, 1}},
+    {HOUSE_TAVERN_PIT,              {100, 300, 30, 15, 4, 4, 4, 10, 10, 10, 2}},
+    {HOUSE_TAVERN_EVENMORN_ISLAND,  {150, 400, 20, 10, 5, 5, 5, 25, 25, 25, 0}},
+    {HOUSE_TAVERN_MOUNT_NIGHON,     {200, 500, 20, 10, 1, 1, 1, 15, 15, 15, 2}},
+    {HOUSE_TAVERN_BARROW_DOWNS,     {100, 300, 20, 50, 1, 1, 5, 5, 5, 25, 0}},
+    {HOUSE_TAVERN_TATALIA,          {125, 350, 10, 20, 3, 1, 2, 15, 5, 10, 2}},
+    {HOUSE_TAVERN_AVLEE,            {125, 350, 10, 20, 3, 1, 2, 15, 5, 10, 1}},
+    {HOUSE_TAVERN_STONE_CITY,       {100, 300, 50, 50, 5, 3, 5, 20, 10, 20, 0}}
+};
+
+static std::array<int, DECK_SIZE> makeMasterDeck() {
+    std::array<int, DECK_SIZE> result;
+    for (int i = 0, card_dispenser_counter = -2, card_id_counter = 0; i < DECK_SIZE; ++i, ++card_dispenser_counter) {
+        result[i] = card_id_counter;
+        switch (card_dispenser_counter) {
+            case 0:
+            case 2:
+            case 6:
+            case 9:
+            case 13:
+            case 18:
+            case 23:
+            case 33:
+            case 36:
+            case 38:
+            case 44:
+            case 46:
+            case 52:
+            case 57:
+            case 69:
+            case 71:
+            case 75:
+            case 79:
+            case 81:
+            case 84:
+            case 89:
+                break;
+            default:
+                ++card_id_counter;
+        }
+    }
+    return result;
+}
+
+ArcomageRules arcomageTavernRules(HouseId houseId) {
+    const ArcomageStartConditions &st_cond = start_conditions[houseId];
+
+    ArcomageRules result;
+    result.startTowerHeight = st_cond.tower_height;
+    result.startWallHeight = st_cond.wall_height;
+    result.startQuarryLevel = st_cond.quarry_level - 1;
+    result.startMagicLevel = st_cond.magic_level - 1;
+    result.startZooLevel = st_cond.zoo_level - 1;
+    result.startBricks = st_cond.bricks_amount;
+    result.startGems = st_cond.gems_amount;
+    result.startBeasts = st_cond.beasts_amount;
+    result.maxTowerHeight = st_cond.max_tower;
+    result.maxResources = st_cond.max_resources;
+    result.aiMastery = st_cond.mastery_lvl;
+    return result;
+}
+
+const std::array<int, DECK_SIZE> &arcomageMasterDeck() {
+    static const std::array<int, DECK_SIZE> deck = makeMasterDeck();
+    return deck;
+}
+
+int arcomageHandCardCount(const ArcomagePlayerState &player) {
+    int card_count = 0;
+    for (int i = 0; i < 10; ++i)
+        if (player.cards_at_hand[i] != -1)
+            ++card_count;
+    return card_count;
+}
+
+int arcomageEmptyCardSlot(const ArcomagePlayerState &player) {
+    for (int i = 0; i < 10; ++i)
+        if (player.cards_at_hand[i] == -1)
+            return i;
+    return -1;
+}
+
+void shuffleArcomageDeck(ArcomageDeckState *deck, const ArcomagePlayerState &player0, const ArcomagePlayerState &player1,
+                         RandomEngine *rng) {
+    const std::array<int, DECK_SIZE> &master = arcomageMasterDeck();
+    std::array<bool, DECK_SIZE> masterInUse = {};
+    std::array<bool, DECK_SIZE> card_taken_flags = {};
+
+    // Mark which cards are already in players' hands.
+    for (const ArcomagePlayerState *player : {&player0, &player1}) {
+        for (int j = 0; j < 10; ++j) {
+            if (player->cards_at_hand[j] <= -1)
+                continue;
+
+            for (int m = 0; m < DECK_SIZE; ++m) {
+                if (master[m] == player->cards_at_hand[j] && !masterInUse[m]) {
+                    masterInUse[m] = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < DECK_SIZE; ++i) {
+        int rand_deck_pos = 0;
+        do {
+            rand_deck_pos = rng->random(DECK_SIZE);
+        } while (card_taken_flags[rand_deck_pos]);
+
+        card_taken_flags[rand_deck_pos] = true;
+        deck->cards[i] = master[rand_deck_pos];
+        deck->cardsInUse[i] = masterInUse[rand_deck_pos];
+    }
+
+    deck->walkIndex = 0;
+}
+
+int drawArcomageCard(ArcomageDeckState *deck, const ArcomagePlayerState &player0, const ArcomagePlayerState &player1,
+                     RandomEngine *rng, bool *shuffled) {
+    if (shuffled)
+        *shuffled = false;
+
+    while (true) {
+        if (deck->walkIndex >= DECK_SIZE) {
+            shuffleArcomageDeck(deck, player0, player1, rng);
+            if (shuffled)
+                *shuffled = true;
+        }
+
+        int index = deck->walkIndex++;
+        if (!deck->cardsInUse[index])
+            return deck->cards[index];
+    }
+}
+
+void increaseArcomageResources(ArcomagePlayerState *player, const ArcomageRules &rules) {
+    player->resource_bricks += rules.quarryBonus + player->quarry_level;
+    player->resource_gems += rules.magicBonus + player->magic_level;
+    player->resource_beasts += rules.zooBonus + player->zoo_level;
+}
+
+bool canPlayArcomageCard(const ArcomagePlayerState &player, const ArcomageCard &card) {
+    return card.needed_quarry_level <= player.quarry_level &&
+           card.needed_magic_level <= player.magic_level &&
+           card.needed_zoo_level <= player.zoo_level &&
+           card.needed_bricks <= player.resource_bricks &&
+           card.needed_gems <= player.resource_gems &&
+           card.needed_beasts <= player.resource_beasts;
+}
+
+int damageArcomageBuildings(ArcomagePlayerState *player, int damage) {
+    int wall = player->wall_height;
+    int result = 0;
+
+    if (wall >= -damage) {  // wall absorbs all damage
+        result = damage;
+        player->wall_height += damage;
+    } else {
+        damage += wall;  // reduce damage by size of wall
+        player->wall_height = 0;
+        result = -wall;
+        player->tower_height += damage;  // apply remaining to tower
+    }
+
+    if (player->tower_height < 0)
+        player->tower_height = 0;
+
+    return result;
+}
+
+#define APPLY_TO_PLAYER(PLAYER, ENEMY, FIELD, VAL, RES)   \
+    if (VAL != 0) {                                       \
+        if (VAL == 99) {                                  \
+            if (PLAYER->FIELD < ENEMY->FIELD) {           \
+                PLAYER->FIELD = ENEMY->FIELD;             \
+                RES = ENEMY->FIELD - PLAYER->FIELD;       \
+            }                                             \
+        } else {                                          \
+            PLAYER->FIELD += (signed int)(VAL);           \
+            if (PLAYER->FIELD < 0) PLAYER->FIELD = 0;     \
+            RES = (signed int)(VAL);                      \
+        }                                                 \
+    }
+
+#define APPLY_TO_ENEMY(PLAYER, ENEMY, FIELD, VAL, RES) \
+    APPLY_TO_PLAYER(ENEMY, PLAYER, FIELD, VAL, RES)
+
+#define APPLY_TO_BOTH(PLAYER, ENEMY, FIELD, VAL, RES_P, RES_E) \
+    if (VAL != 0) {                                            \
+        if (VAL == 99) {                                       \
+            if (PLAYER->FIELD != ENEMY->FIELD) {               \
+                if (PLAYER->FIELD <= ENEMY->FIELD) {           \
+                    PLAYER->FIELD = ENEMY->FIELD;              \
+                    RES_P = ENEMY->FIELD - PLAYER->FIELD;      \
+                } else {                                       \
+                    ENEMY->FIELD = PLAYER->FIELD;              \
+                    RES_E = PLAYER->FIELD - ENEMY->FIELD;      \
+                }                                              \
+            }                                                  \
+        } else {                                               \
+            PLAYER->FIELD += (signed int)(VAL);                \
+            ENEMY->FIELD += (signed int)(VAL);                 \
+            if (PLAYER->FIELD < 0) {                           \
+                PLAYER->FIELD = 0;                             \
+            }                                                  \
+            if (ENEMY->FIELD < 0) {                            \
+                ENEMY->FIELD = 0;                              \
+            }                                                  \
+            RES_P = (signed int)(VAL);                         \
+            RES_E = (signed int)(VAL);                         \
+        }                                                      \
+    }
+
+
+ArcomageCardEffects applyArcomageCard(ArcomagePlayerState *player, ArcomagePlayerState *enemy, const ArcomageCard &card) {
+    ArcomageCardEffects effects;
+
+    switch (card.compare_param) {
+        case CHECK_LESSER_QUARRY : // Mother Lode & Copping the Tech
+            if (player->quarry_level < enemy->quarry_level)
+                goto desired_effects;
+            goto secondary_effects;
+        case CHECK_LESSER_MAGIC: // Parity
+            if (player->magic_level < enemy->magic_level) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_LESSER_ZOO:
+            if (player->zoo_level < enemy->zoo_level) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_EQUAL_QUARRY:
+            if (player->quarry_level == enemy->quarry_level) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_EQUAL_MAGIC:
+            if (player->magic_level == enemy->magic_level) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_EQUAL_ZOO:
+            if (player->zoo_level == enemy->zoo_level) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_GREATER_QUARRY:
+            if (player->quarry_level > enemy->quarry_level) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_GREATER_MAGIC: // Unicorn
+            if (player->magic_level > enemy->magic_level) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_GREATER_ZOO:
+            if (player->zoo_level > enemy->zoo_level) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_NO_WALL: // Foundations
+            if (!player->wall_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_HAVE_WALL:
+            if (player->wall_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_ENEMY_HAS_NO_WALL: // Spizzer
+            if (!enemy->wall_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_ENEMY_HAS_WALL: // Corrosion Cloud
+            if (enemy->wall_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_LESSER_WALL:
+            if (player->wall_height < enemy->wall_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_LESSER_TOWER:
+            if (player->tower_height < enemy->tower_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_EQUAL_WALL:
+            if (player->wall_height == enemy->wall_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_EQUAL_TOWER:
+            if (player->tower_height == enemy->tower_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_GREATER_WALL: // Elven Archers
+            if (player->wall_height > enemy->wall_height) goto desired_effects;
+            goto secondary_effects;
+        case CHECK_GREATER_TOWER:
+            if (player->tower_height > enemy->tower_height) goto desired_effects;
+            goto secondary_effects;
+        default:
+        desired_effects:
+            effects.extraCards = card.draw_extra_card_count;
+            effects.actions = card.draw_extra_card_count + (card.field_30 == 1);
+
+            APPLY_TO_PLAYER(player, enemy, quarry_level, card.to_player_quarry_lvl, effects.player.quarry);
+            APPLY_TO_PLAYER(player, enemy, magic_level, card.to_player_magic_lvl, effects.player.magic);
+            APPLY_TO_PLAYER(player, enemy, zoo_level, card.to_player_zoo_lvl, effects.player.zoo);
+            APPLY_TO_PLAYER(player, enemy, resource_bricks, card.to_player_bricks, effects.player.bricks);
+            APPLY_TO_PLAYER(player, enemy, resource_gems, card.to_player_gems, effects.player.gems);
+            APPLY_TO_PLAYER(player, enemy, resource_beasts, card.to_player_beasts, effects.player.beasts);
+            if (card.to_player_buildings) {
+                effects.player.wallDamage = damageArcomageBuildings(player, card.to_player_buildings);
+                effects.player.towerDamage = card.to_player_buildings - effects.player.wallDamage;
+            }
+            APPLY_TO_PLAYER(player, enemy, wall_height, card.to_player_wall, effects.player.wall);
+            APPLY_TO_PLAYER(player, enemy, tower_height, card.to_player_tower, effects.player.tower);
+
+            APPLY_TO_ENEMY(player, enemy, quarry_level, card.to_enemy_quarry_lvl, effects.enemy.quarry);
+            APPLY_TO_ENEMY(player, enemy, magic_level, card.to_enemy_magic_lvl, effects.enemy.magic);
+            APPLY_TO_ENEMY(player, enemy, zoo_level, card.to_enemy_zoo_lvl, effects.enemy.zoo);
+            APPLY_TO_ENEMY(player, enemy, resource_bricks, card.to_enemy_bricks, effects.enemy.bricks);
+            APPLY_TO_ENEMY(player, enemy, resource_gems, card.to_enemy_gems, effects.enemy.gems);
+            APPLY_TO_ENEMY(player, enemy, resource_beasts, card.to_enemy_beasts, effects.enemy.beasts);
+            if (card.to_enemy_buildings) {
+                effects.enemy.wallDamage = damageArcomageBuildings(enemy, card.to_enemy_buildings);
+                effects.enemy.towerDamage = card.to_enemy_buildings - effects.enemy.wallDamage;
+            }
+            APPLY_TO_ENEMY(player, enemy, wall_height, card.to_enemy_wall, effects.enemy.wall);
+            APPLY_TO_ENEMY(player, enemy, tower_height, card.to_enemy_tower, effects.enemy.tower);
+
+            APPLY_TO_BOTH(player, enemy, quarry_level, card.to_pl_enm_quarry_lvl, effects.player.quarry, effects.enemy.quarry);
+            APPLY_TO_BOTH(player, enemy, magic_level, card.to_pl_enm_magic_lvl, effects.player.magic, effects.enemy.magic);
+            APPLY_TO_BOTH(player, enemy, zoo_level, card.to_pl_enm_zoo_lvl, effects.player.zoo, effects.enemy.zoo);
+            APPLY_TO_BOTH(player, enemy, resource_bricks, card.to_pl_enm_bricks, effects.player.bricks, effects.enemy.bricks);
+            APPLY_TO_BOTH(player, enemy, resource_gems, card.to_pl_enm_gems, effects.player.gems, effects.enemy.gems);
+            APPLY_TO_BOTH(player, enemy, resource_beasts, card.to_pl_enm_beasts, effects.player.beasts, effects.enemy.beasts);
+            if (card.to_pl_enm_buildings) {
+                effects.player.wallDamage = damageArcomageBuildings(player, card.to_pl_enm_buildings);
+                effects.enemy.wallDamage = damageArcomageBuildings(enemy, card.to_pl_enm_buildings);
+                effects.player.towerDamage = card.to_pl_enm_buildings - effects.player.wallDamage;
+                effects.enemy.towerDamage = card.to_pl_enm_buildings - effects.enemy.wallDamage;
+            }
+            APPLY_TO_BOTH(player, enemy, wall_height, card.to_pl_enm_wall, effects.player.wall, effects.enemy.wall);
+            APPLY_TO_BOTH(player, enemy, tower_height, card.to_pl_enm_tower, effects.player.tower, effects.enemy.tower);
+            break;
+        case CHECK_ALWAYS_SECONDARY:
+        secondary_effects:
+            effects.extraCards = card.can_draw_extra_card2;
+            effects.actions = card.can_draw_extra_card2 + (card.field_4D == 1);
+
+            APPLY_TO_PLAYER(player, enemy, quarry_level, card.to_player_quarry_lvl2, effects.player.quarry);
+            APPLY_TO_PLAYER(player, enemy, magic_level, card.to_player_magic_lvl2, effects.player.magic);
+            APPLY_TO_PLAYER(player, enemy, zoo_level, card.to_player_zoo_lvl2, effects.player.zoo);
+            APPLY_TO_PLAYER(player, enemy, resource_bricks, card.to_player_bricks2, effects.player.bricks);
+            APPLY_TO_PLAYER(player, enemy, resource_gems, card.to_player_gems2, effects.player.gems);
+            APPLY_TO_PLAYER(player, enemy, resource_beasts, card.to_player_beasts2, effects.player.beasts);
+            if (card.to_player_buildings2) {
+                effects.player.wallDamage = damageArcomageBuildings(player, card.to_player_buildings2);
+                effects.player.towerDamage = card.to_player_buildings2 - effects.player.wallDamage;
+            }
+            APPLY_TO_PLAYER(player, enemy, wall_height, card.to_player_wall2, effects.player.wall);
+            APPLY_TO_PLAYER(player, enemy, tower_height, card.to_player_tower2, effects.player.tower);
+
+            APPLY_TO_ENEMY(player, enemy, quarry_level, card.to_enemy_quarry_lvl2, effects.enemy.quarry);
+            APPLY_TO_ENEMY(player, enemy, magic_level, card.to_enemy_magic_lvl2, effects.enemy.magic);
+            APPLY_TO_ENEMY(player, enemy, zoo_level, card.to_enemy_zoo_lvl2, effects.enemy.zoo);
+            APPLY_TO_ENEMY(player, enemy, resource_bricks, card.to_enemy_bricks2, effects.enemy.bricks);
+            APPLY_TO_ENEMY(player, enemy, resource_gems, card.to_enemy_gems2, effects.enemy.gems);
+            APPLY_TO_ENEMY(player, enemy, resource_beasts, card.to_enemy_beasts2, effects.enemy.beasts);
+            if (card.to_enemy_buildings2) {
+                effects.enemy.wallDamage = damageArcomageBuildings(enemy, card.to_enemy_buildings2);
+                effects.enemy.towerDamage = card.to_enemy_buildings2 - effects.enemy.wallDamage;
+            }
+            APPLY_TO_ENEMY(player, enemy, wall_height, card.to_enemy_wall2, effects.enemy.wall);
+            APPLY_TO_ENEMY(player, enemy, tower_height, card.to_enemy_tower2, effects.enemy.tower);
+
+            APPLY_TO_BOTH(player, enemy, quarry_level, card.to_pl_enm_quarry_lvl2, effects.player.quarry, effects.enemy.quarry);
+            APPLY_TO_BOTH(player, enemy, magic_level, card.to_pl_enm_magic_lvl2, effects.player.magic, effects.enemy.magic);
+            APPLY_TO_BOTH(player, enemy, zoo_level, card.to_pl_enm_zoo_lvl2, effects.player.zoo, effects.enemy.zoo);
+            APPLY_TO_BOTH(player, enemy, resource_bricks, card.to_pl_enm_bricks2, effects.player.bricks, effects.enemy.bricks);
+            APPLY_TO_BOTH(player, enemy, resource_gems, card.to_pl_enm_gems2, effects.player.gems, effects.enemy.gems);
+            APPLY_TO_BOTH(player, enemy, resource_beasts, card.to_pl_enm_beasts2, effects.player.beasts, effects.enemy.beasts);
+
+            if (card.to_pl_enm_buildings2) {
+                effects.player.wallDamage = damageArcomageBuildings(player, card.to_pl_enm_buildings2);
+                effects.enemy.wallDamage = damageArcomageBuildings(enemy, card.to_pl_enm_buildings2);
+                effects.player.towerDamage = card.to_pl_enm_buildings2 - effects.player.wallDamage;
+                effects.enemy.towerDamage = card.to_pl_enm_buildings2 - effects.enemy.wallDamage;
+            }
+            APPLY_TO_BOTH(player, enemy, wall_height, card.to_pl_enm_wall2, effects.player.wall, effects.enemy.wall);
+            APPLY_TO_BOTH(player, enemy, tower_height, card.to_pl_enm_tower2, effects.player.tower, effects.enemy.tower);
+            break;
+    }
+
+    return effects;
+}
+
+#undef APPLY_TO_BOTH
+#undef APPLY_TO_ENEMY
+#undef APPLY_TO_PLAYER
+
+int arcomageCardPower(const ArcomagePlayerState &player, const ArcomagePlayerState &enemy, const ArcomageCard &card,
+                      int mastery, const ArcomageRules &rules) {
+    enum class V_IND {
+        P_TOWER_M10,
+        P_WALL_M10,
+        E_TOWER,
+        E_WALL,
+        E_BUILDINGS,
+        E_QUARRY,
+        E_MAGIC,
+        E_ZOO,
+        E_RES
+    };
+    using enum V_IND;
+
+    // mastery coeffs
+    // base mastery focus on growing walls + tower
+    // second level high priority on resource gen
+    static constexpr IndexedArray<std::array<int, 2>, P_TOWER_M10, E_RES> mastery_coeff = {
+        {P_TOWER_M10,   {{10, 5}}},
+        {P_WALL_M10,    {{2, 1}}},
+        {E_TOWER,       {{1, 10}}},
+        {E_WALL,        {{1, 3}}},
+        {E_BUILDINGS,   {{1, 7}}},
+        {E_QUARRY,      {{1, 5}}},
+        {E_MAGIC,       {{1, 40}}},
+        {E_ZOO,         {{1, 40}}},
+        {E_RES,         {{1, 2}}}
+    };
+
+    int card_power = 0;
+    int element_power = 0;
+
+    if (card.to_player_tower == 99 || card.to_pl_enm_tower == 99 ||
+        card.to_player_tower2 == 99 || card.to_pl_enm_tower2 == 99) {
+        element_power = enemy.tower_height - player.tower_height;
+    } else {
+        element_power = card.to_player_tower + card.to_pl_enm_tower +
+                        card.to_player_tower2 + card.to_pl_enm_tower2;
+    }
+
+    if (player.tower_height >= 10) {
+        card_power += mastery_coeff[P_TOWER_M10][mastery] * element_power;
+    } else {
+        card_power += 20 * element_power;
+    }
+
+    if (card.to_player_wall == 99 || card.to_pl_enm_wall == 99 ||
+        card.to_player_wall2 == 99 || card.to_pl_enm_wall2 == 99) {
+        element_power = enemy.wall_height - player.wall_height;
+    } else {
+        element_power = card.to_player_wall + card.to_pl_enm_wall +
+                        card.to_player_wall2 + card.to_pl_enm_wall2;
+    }
+
+    if (player.wall_height >= 10) {
+        card_power += mastery_coeff[P_WALL_M10][mastery] * element_power;  // 1
+    } else {
+        card_power += 5 * element_power;
+    }
+
+    card_power +=
+        7 * (card.to_player_buildings + card.to_pl_enm_buildings +
+             card.to_player_buildings2 + card.to_pl_enm_buildings2);
+
+    if (card.to_player_quarry_lvl == 99 ||
+        card.to_pl_enm_quarry_lvl == 99 ||
+        card.to_player_quarry_lvl2 == 99 ||
+        card.to_pl_enm_quarry_lvl2 == 99) {
+        element_power = enemy.quarry_level - player.quarry_level;
+    } else {
+        element_power =
+            card.to_player_quarry_lvl + card.to_pl_enm_quarry_lvl +
+            card.to_player_quarry_lvl2 + card.to_pl_enm_quarry_lvl;
+    }
+
+    card_power += 40 * element_power;
+
+    if (card.to_player_magic_lvl == 99 || card.to_pl_enm_magic_lvl == 99 ||
+        card.to_player_magic_lvl2 == 99 ||
+        card.to_pl_enm_magic_lvl2 == 99) {
+        element_power = enemy.magic_level - player.magic_level;
+    } else {
+        element_power =
+            card.to_player_magic_lvl + card.to_pl_enm_magic_lvl +
+            card.to_player_magic_lvl2 + card.to_pl_enm_magic_lvl2;
+    }
+    card_power += 40 * element_power;
+
+    if (card.to_player_zoo_lvl == 99 || card.to_pl_enm_zoo_lvl == 99 ||
+        card.to_player_zoo_lvl2 == 99 || card.to_pl_enm_zoo_lvl2 == 99) {
+        element_power = enemy.zoo_level - player.zoo_level;
+    } else {
+        element_power = card.to_player_zoo_lvl + card.to_pl_enm_zoo_lvl +
+                        card.to_player_zoo_lvl2 + card.to_pl_enm_zoo_lvl2;
+    }
+    card_power += 40 * element_power;
+
+    if (card.to_player_bricks == 99 || card.to_pl_enm_bricks == 99 ||
+        card.to_player_bricks2 == 99 || card.to_pl_enm_bricks2 == 99) {
+        element_power = enemy.resource_bricks - player.resource_bricks;
+    } else {
+        element_power = card.to_player_bricks + card.to_pl_enm_bricks +
+                        card.to_player_bricks2 + card.to_pl_enm_bricks2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_player_gems == 99 || card.to_pl_enm_gems == 99 ||
+        card.to_player_gems2 == 99 || card.to_pl_enm_gems2 == 99) {
+        element_power = enemy.resource_gems - player.resource_gems;
+    } else {
+        element_power = card.to_player_gems + card.to_pl_enm_gems +
+                        card.to_player_gems2 + card.to_pl_enm_gems2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_player_beasts == 99 || card.to_pl_enm_beasts == 99 ||
+        card.to_player_beasts2 == 99 || card.to_pl_enm_beasts2 == 99) {
+        element_power = enemy.resource_beasts - player.resource_beasts;
+    } else {
+        element_power = card.to_player_beasts + card.to_pl_enm_beasts +
+                        card.to_player_beasts2 + card.to_pl_enm_beasts2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_enemy_tower == 99 || card.to_enemy_tower2 == 99) {
+        element_power = player.tower_height - enemy.tower_height;
+    } else {
+        element_power = -(card.to_enemy_tower + card.to_enemy_tower2);
+    }
+    card_power += mastery_coeff[E_TOWER][mastery] * element_power;
+
+    if (card.to_enemy_wall == 99 || card.to_enemy_wall2 == 99) {
+        element_power = player.wall_height - enemy.wall_height;
+    } else {
+        element_power = -(card.to_enemy_wall + card.to_enemy_wall2);
+    }
+    card_power += mastery_coeff[E_WALL][mastery] * element_power;
+
+    card_power -= mastery_coeff[E_BUILDINGS][mastery] *
+                  (card.to_enemy_buildings + card.to_enemy_buildings2);
+
+    if (card.to_enemy_quarry_lvl == 99 || card.to_enemy_quarry_lvl2 == 99) {
+        element_power = player.quarry_level - enemy.quarry_level;  // 5
+    } else {
+        element_power =
+            -(card.to_enemy_quarry_lvl + card.to_enemy_quarry_lvl2);  // 5
+    }
+    card_power += mastery_coeff[E_QUARRY][mastery] * element_power;
+
+    if (card.to_enemy_magic_lvl == 99 || card.to_enemy_magic_lvl2 == 99) {
+        element_power = player.magic_level - enemy.magic_level;  // 40
+    } else {
+        element_power =
+            -(card.to_enemy_magic_lvl + card.to_enemy_magic_lvl2);
+    }
+    card_power += mastery_coeff[E_MAGIC][mastery] * element_power;
+
+    if (card.to_enemy_zoo_lvl == 99 || card.to_enemy_zoo_lvl2 == 99) {
+        element_power = player.zoo_level - enemy.zoo_level;  // 40
+    } else {
+        element_power = -(card.to_enemy_zoo_lvl + card.to_enemy_zoo_lvl2);
+    }
+    card_power += mastery_coeff[E_ZOO][mastery] * element_power;
+
+    if (card.to_enemy_bricks == 99 || card.to_enemy_bricks2 == 99) {
+        element_power = player.resource_bricks - enemy.resource_bricks;  // 2
+    } else {
+        element_power = -(card.to_enemy_bricks + card.to_enemy_bricks2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.to_enemy_gems == 99 || card.to_enemy_gems2 == 99) {
+        element_power = player.resource_gems - enemy.resource_gems;  // 2
+    } else {
+        element_power = -(card.to_enemy_gems + card.to_enemy_gems2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.to_enemy_beasts == 99 || card.to_enemy_beasts2 == 99) {
+        element_power = player.resource_beasts - enemy.resource_beasts;  // 2
+    } else {
+        element_power = -(card.to_enemy_beasts + card.to_enemy_beasts2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.field_30 || card.field_4D) {
+        card_power *= 10;
+    }
+
+    if (card.card_resource_type == 1) {
+        element_power = player.resource_bricks - card.needed_bricks;
+    } else if (card.card_resource_type == 2) {
+        element_power = player.resource_gems - card.needed_gems;
+    } else if (card.card_resource_type == 3) {
+        element_power = player.resource_beasts - card.needed_beasts;
+    }
+    if (element_power > 3) {
+        element_power = 3;
+    }
+    card_power += 5 * element_power;
+
+    if (enemy.tower_height <= card.to_enemy_tower2 + card.to_enemy_tower) {
+        card_power += 9999;
+    }
+
+    if (card.to_enemy_tower2 + card.to_enemy_tower + card.to_enemy_wall +
+            card.to_enemy_wall2 + card.to_enemy_buildings +
+            card.to_enemy_buildings2 >=
+        enemy.wall_height + enemy.tower_height) {
+        card_power += 9999;
+    }
+
+    if ((card.to_player_tower2 + card.to_pl_enm_tower2 +
+         card.to_player_tower + card.to_pl_enm_tower +
+         player.tower_height) >= rules.maxTowerHeight) {
+        card_power += 9999;
+    }
+
+    return card_power;
+}
+
+ArcomageMove chooseArcomageAIMove(const ArcomagePlayerState &player, const ArcomagePlayerState &enemy, int mastery,
+                                  bool mustDiscard, const ArcomageRules &rules, RandomEngine *rng) {
+    ArcomageMove result;
+
+    int ai_player_cards_count = arcomageHandCardCount(player);
+    if (ai_player_cards_count == 0)
+        return result;
+
+    auto canPlay = [&](int slot) {
+        return player.cards_at_hand[slot] != -1 && canPlayArcomageCard(player, pCards[player.cards_at_hand[slot]]);
+    };
+
+    if (mastery == 0) {
+        // select card at random to play
+        int random_card_slot;
+        if (!mustDiscard) {
+            for (int i = 0; i < 10; ++i) {
+                random_card_slot = rng->randomInSegment(0, ai_player_cards_count - 1);
+                if (canPlay(random_card_slot)) {
+                    result.slot = random_card_slot;
+                    return result;
+                }
+            }
+        }
+
+        // if that fails discard card at random
+        result.discard = true;
+        result.slot = rng->randomInSegment(0, ai_player_cards_count - 1);
+        return result;
+    }
+
+    assert(mastery == 1 || mastery == 2);
+
+    // apply some cunning
+    struct CardPower {
+        int slot_index;
+        int card_power;
+    };
+    std::array<CardPower, 10> cards_power;
+
+    // wipe cards power array - set negative for unfilled card slots
+    for (int i = 0; i < 10; ++i) {
+        if (i >= ai_player_cards_count) {
+            cards_power[i].slot_index = -1;
+            cards_power[i].card_power = -9999;
+        } else {
+            cards_power[i].slot_index = i;
+            cards_power[i].card_power = 0;
+        }
+    }
+
+    // calculate how effective each card would be, empty slots go last
+    for (int i = 0; i < ai_player_cards_count; ++i) {
+        int card_id = player.cards_at_hand[cards_power[i].slot_index];
+        if (card_id == -1) {
+            cards_power[i].card_power = -9999;
+        } else {
+            cards_power[i].card_power = arcomageCardPower(player, enemy, pCards[card_id], mastery - 1, rules);
+        }
+    }
+
+    // bubble sort the card powers in order
+    for (int j = ai_player_cards_count - 1; j >= 0; --j)
+        for (int m = 0; m < j; ++m)
+            if (cards_power[m].card_power < cards_power[m + 1].card_power)
+                std::swap(cards_power[m], cards_power[m + 1]);
+
+    // if we have to discard pick the least powerful to chuck
+    int discard_slot = 0;
+    for (int i = ai_player_cards_count - 1; i > 0; --i) {
+        int card_id = player.cards_at_hand[cards_power[i].slot_index];
+        if (card_id != -1 && pCards[card_id].can_be_discarded)
+            discard_slot = cards_power[i].slot_index;
+    }
+
+    if (!mustDiscard) {
+        // try and play most powerful card
+        for (int i = 0; i < ai_player_cards_count - 1; ++i) {
+            if (canPlay(cards_power[i].slot_index) && cards_power[i].card_power) {
+                result.slot = cards_power[i].slot_index;
+                return result;
+            }
+        }
+    }
+
+    // fall back - have to discard
+    result.discard = true;
+    result.slot = discard_slot;
+    return result;
+}
+
+bool isArcomageGameOver(const ArcomagePlayerState &player0, const ArcomagePlayerState &player1, const ArcomageRules &rules) {
+    // check if victory conditions have been met
+    for (const ArcomagePlayerState *player : {&player0, &player1}) {
+        if (player->tower_height <= 0 || player->tower_height >= rules.maxTowerHeight)
+            return true;
+        if (player->resource_bricks >= rules.maxResources ||
+            player->resource_gems >= rules.maxResources ||
+            player->resource_beasts >= rules.maxResources)
+            return true;
+    }
+    return false;
+}
+
+static int maxArcomageResource(const ArcomagePlayerState &player) {
+    // Note that this is not exactly max, e.g. for bricks == gems > beasts it returns bricks. Retained for compatibility.
+    if (player.resource_gems > player.resource_bricks && player.resource_gems > player.resource_beasts)
+        return player.resource_gems;
+    if (player.resource_beasts > player.resource_gems && player.resource_beasts > player.resource_bricks)
+        return player.resource_beasts;
+    return player.resource_bricks;
+}
+
+ArcomageGameResult arcomageGameResult(const ArcomagePlayerState &player0, const ArcomagePlayerState &player1,
+                                      const ArcomageRules &rules) {
+    ArcomageGameResult result;
+    int &winner = result.winner;
+    int &victory_type = result.victoryType;
+
+    // check whether a tower was built
+    if (player0.tower_height < rules.maxTowerHeight && player1.tower_height >= rules.maxTowerHeight) {
+        winner = 2;
+        victory_type = 0;
+    } else if (player0.tower_height >= rules.maxTowerHeight && player1.tower_height < rules.maxTowerHeight) {
+        winner = 1;
+        victory_type = 0;
+    } else if (player0.tower_height >= rules.maxTowerHeight && player1.tower_height >= rules.maxTowerHeight) {
+        if (player0.tower_height == player1.tower_height) {
+            winner = 0;
+            victory_type = 4;
+        } else {
+            winner = (player0.tower_height <= player1.tower_height) + 1; // higher tower wins
+            victory_type = 0;
+        }
+    }
+
+    // check whether a tower was destroyed
+    if (player0.tower_height <= 0 && player1.tower_height > 0) {
+        winner = 2;
+        victory_type = 2;
+    } else if (player0.tower_height > 0 && player1.tower_height <= 0) {
+        winner = 1;
+        victory_type = 2;
+    } else if (player0.tower_height <= 0 && player1.tower_height <= 0) {
+        if (player0.tower_height == player1.tower_height) {
+            if (player0.wall_height == player1.wall_height) {
+                winner = 0;
+                victory_type = 4;
+            } else {
+                winner = (player0.wall_height <= player1.wall_height) + 1; // higher wall wins
+                victory_type = 1;
+            }
+        } else {
+            winner = (player0.tower_height <= player1.tower_height) + 1;
+            victory_type = 2;
+        }
+    }
+
+    // check whether resources were collected
+    int pl_resource = maxArcomageResource(player0);
+    int en_resource = maxArcomageResource(player1);
+    if (winner == -1 && victory_type == -1) {
+        if (pl_resource < rules.maxResources && en_resource >= rules.maxResources) {
+            winner = 2;
+            victory_type = 3;
+        } else if (pl_resource >= rules.maxResources && en_resource < rules.maxResources) {
+            winner = 1;
+            victory_type = 3;
+        } else if (pl_resource >= rules.maxResources && en_resource >= rules.maxResources) {
+            if (pl_resource == en_resource) {
+                winner = 0;
+                victory_type = 4;
+            } else {
+                winner = (pl_resource <= en_resource) + 1;
+                victory_type = 3;
+            }
+        }
+    } else if (winner == 0 && victory_type == 4) {
+        // draw on towers & walls, resources act as a tiebreak
+        if (pl_resource != en_resource) {
+            winner = (pl_resource <= en_resource) + 1;
+            victory_type = 5;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "GUI/UI/UIHouseEnums.h"
+
+class RandomEngine;
+
+enum class ArcomageCheck {
+    CHECK_ALWAYS_SECONDARY = 0,
+    CHECK_ALWAYS_PRIMARY = 1,
+    CHECK_LESSER_QUARRY = 2,
+    CHECK_LESSER_MAGIC = 3,
+    CHECK_LESSER_ZOO = 4,
+    CHECK_EQUAL_QUARRY = 5,
+    CHECK_EQUAL_MAGIC = 6,
+    CHECK_EQUAL_ZOO = 7,
+    CHECK_GREATER_QUARRY = 8,
+    CHECK_GREATER_MAGIC = 9,
+    CHECK_GREATER_ZOO = 10,
+    CHECK_NO_WALL = 11,
+    CHECK_HAVE_WALL = 12,
+    CHECK_ENEMY_HAS_NO_WALL = 13,
+    CHECK_ENEMY_HAS_WALL = 14,
+    CHECK_LESSER_WALL = 15,
+    CHECK_LESSER_TOWER = 16,
+    CHECK_EQUAL_WALL = 17,
+    CHECK_EQUAL_TOWER = 18,
+    CHECK_GREATER_WALL = 19,
+    CHECK_GREATER_TOWER = 20
+};
+using enum ArcomageCheck;
+
+struct ArcomageCard {
+    char pCardName[32];
+    int32_t slot = 0;
+    int8_t card_resource_type = 0;  // 1- brick, 2-gems, 3-beasts
+    int8_t needed_quarry_level = 0;
+    int8_t needed_magic_level = 0;
+    int8_t needed_zoo_level = 0;
+    int8_t needed_bricks = 0;
+    int8_t needed_gems = 0;
+    int8_t needed_beasts = 0;
+    bool can_be_discarded = true;
+    ArcomageCheck compare_param = CHECK_ALWAYS_PRIMARY;
+    int8_t field_30;  // play again
+    int8_t draw_extra_card_count = 0;
+    int8_t to_player_quarry_lvl = 0;
+    int8_t to_player_magic_lvl = 0;
+    int8_t to_player_zoo_lvl = 0;
+    int8_t to_player_bricks = 0;
+    int8_t to_player_gems = 0;
+    int8_t to_player_beasts = 0;
+    int8_t to_player_buildings = 0;
+    int8_t to_player_wall = 0;
+    int8_t to_player_tower = 0;
+    int8_t to_enemy_quarry_lvl = 0;
+    int8_t to_enemy_magic_lvl = 0;
+    int8_t to_enemy_zoo_lvl = 0;
+    int8_t to_enemy_bricks = 0;
+    int8_t to_enemy_gems = 0;
+    int8_t to_enemy_beasts = 0;
+    int8_t to_enemy_buildings = 0;
+    int8_t to_enemy_wall = 0;
+    int8_t to_enemy_tower = 0;
+    int8_t to_pl_enm_quarry_lvl = 0;
+    int8_t to_pl_enm_magic_lvl = 0;
+    int8_t to_pl_enm_zoo_lvl = 0;
+    int8_t to_pl_enm_bricks = 0;
+    int8_t to_pl_enm_gems = 0;
+    int8_t to_pl_enm_beasts = 0;
+    int8_t to_pl_enm_buildings = 0;
+    int8_t to_pl_enm_wall = 0;
+    int8_t to_pl_enm_tower = 0;
+    int8_t field_4D = 0;  // play again 2
+    int8_t can_draw_extra_card2 = 0;
+    int8_t to_player_quarry_lvl2 = 0;
+    int8_t to_player_magic_lvl2 = 0;
+    int8_t to_player_zoo_lvl2 = 0;
+    int8_t to_player_bricks2 = 0;
+    int8_t to_player_gems2 = 0;
+    int8_t to_player_beasts2 = 0;
+    int8_t to_player_buildings2 = 0;
+    int8_t to_player_wall2 = 0;
+    int8_t to_player_tower2 = 0;
+    int8_t to_enemy_quarry_lvl2 = 0;
+    int8_t to_enemy_magic_lvl2 = 0;
+    int8_t to_enemy_zoo_lvl2 = 0;
+    int8_t to_enemy_bricks2 = 0;
+    int8_t to_enemy_gems2 = 0;
+    int8_t to_enemy_beasts2 = 0;
+    int8_t to_enemy_buildings2 = 0;
+    int8_t to_enemy_wall2 = 0;
+    int8_t to_enemy_tower2 = 0;
+    int8_t to_pl_enm_quarry_lvl2 = 0;
+    int8_t to_pl_enm_magic_lvl2 = 0;
+    int8_t to_pl_enm_zoo_lvl2 = 0;
+    int8_t to_pl_enm_bricks2 = 0;
+    int8_t to_pl_enm_gems2 = 0;
+    int8_t to_pl_enm_beasts2 = 0;
+    int8_t to_pl_enm_buildings2 = 0;
+    int8_t to_pl_enm_wall2 = 0;
+    int8_t to_pl_enm_tower2 = 0;
+    int8_t field_6A = 0;  // unused??
+    int8_t field_6B = 0;  // unused??
+};
+
+#define DECK_SIZE 108
+
+extern ArcomageCard pCards[87];
+
+/**
+ * Arcomage game rules, i.e. start & win conditions. These differ between taverns.
+ */
+struct ArcomageRules {
+    int startTowerHeight = 0;
+    int startWallHeight = 0;
+    int startQuarryLevel = 0;
+    int startMagicLevel = 0;
+    int startZooLevel = 0;
+    int startBricks = 0;
+    int startGems = 0;
+    int startBeasts = 0;
+
+    int maxTowerHeight = 50; // Building a tower this high wins the game.
+    int maxResources = 100; // Collecting this many of any resource wins the game.
+
+    int minCardsAtHand = 5;
+    int quarryBonus = 1; // Acts as effective min level.
+    int magicBonus = 1;
+    int zooBonus = 1;
+
+    int aiMastery = 1; // Skill of the tavern AI, in [0, 2].
+};
+
+/**
+ * Rules core of a single Arcomage player. This is a value type, rules functions below don't allocate.
+ */
+struct ArcomagePlayerState {
+    int tower_height = 0;
+    int wall_height = 0;
+    int quarry_level = 0;
+    int magic_level = 0;
+    int zoo_level = 0;
+    int resource_bricks = 0;
+    int resource_gems = 0;
+    int resource_beasts = 0;
+    int cards_at_hand[10] {}; // Card ids, -1 for empty slots.
+};
+
+struct ArcomageDeckState {
+    std::array<int, DECK_SIZE> cards = {}; // Card ids in draw order.
+    std::array<bool, DECK_SIZE> cardsInUse = {}; // Cards that were in players' hands when the deck was shuffled.
+    int walkIndex = 0; // Index of the next card to draw.
+};
+
+/**
+ * Changes to a single player's stats made by a card, as reported by `applyArcomageCard`.
+ */
+struct ArcomagePlayerDelta {
+    int quarry = 0;
+    int magic = 0;
+    int zoo = 0;
+    int bricks = 0;
+    int gems = 0;
+    int beasts = 0;
+    int wall = 0;
+    int tower = 0;
+    int wallDamage = 0; // Building damage absorbed by the wall.
+    int towerDamage = 0; // Building damage that went through to the tower.
+};
+
+struct ArcomageCardEffects {
+    int extraCards = 0; // Number of cards that the player should draw.
+    int actions = 0; // Number of actions the player has left after playing the card.
+    ArcomagePlayerDelta player;
+    ArcomagePlayerDelta enemy;
+};
+
+struct ArcomageMove {
+    bool discard = false; // Play the card if false, discard it if true.
+    int slot = -1; // Hand slot, -1 if there is no valid move.
+};
+
+struct ArcomageGameResult {
+    int winner = -1; // 1 for the first player, 2 for the second one, 0 for a draw.
+    int victoryType = -1; // 0 - tower built, 1 - wall tiebreak, 2 - tower destroyed, 3 - resources, 4 - draw, 5 - resource tiebreak.
+};
+
+/**
+ * @param houseId                       Arcomage tavern.
+ * @return                              Rules for the provided tavern.
+ */
+ArcomageRules arcomageTavernRules(HouseId houseId);
+
+/**
+ * @return                              Card ids of a full Arcomage deck.
+ */
+const std::array<int, DECK_SIZE> &arcomageMasterDeck();
+
+int arcomageHandCardCount(const ArcomagePlayerState &player);
+
+/**
+ * @return                              First empty hand slot, or -1 if the player's hand is full.
+ */
+int arcomageEmptyCardSlot(const ArcomagePlayerState &player);
+
+/**
+ * Shuffles the master deck into `deck`. Cards that are currently in players' hands are marked as in use & won't be
+ * drawn.
+ */
+void shuffleArcomageDeck(ArcomageDeckState *deck, const ArcomagePlayerState &player0, const ArcomagePlayerState &player1,
+                         RandomEngine *rng);
+
+/**
+ * Draws the next card from the deck, reshuffling it if it's exhausted.
+ *
+ * @param[out] shuffled                 If not null, set to whether the deck was reshuffled.
+ * @return                              Id of the drawn card.
+ */
+int drawArcomageCard(ArcomageDeckState *deck, const ArcomagePlayerState &player0, const ArcomagePlayerState &player1,
+                     RandomEngine *rng, bool *shuffled = nullptr);
+
+void increaseArcomageResources(ArcomagePlayerState *player, const ArcomageRules &rules);
+
+bool canPlayArcomageCard(const ArcomagePlayerState &player, const ArcomageCard &card);
+
+/**
+ * Applies building damage to the player's wall first, and then to the tower.
+ *
+ * @param player                        Player to damage.
+ * @param damage                        Damage, negative.
+ * @return                              Part of the damage that was absorbed by the wall.
+ */
+int damageArcomageBuildings(ArcomagePlayerState *player, int damage);
+
+/**
+ * Applies the effects of a played card. Doesn't take the card's cost or draw any cards, this is up to the caller.
+ *
+ * @return                              Effects of the card.
+ */
+ArcomageCardEffects applyArcomageCard(ArcomagePlayerState *player, ArcomagePlayerState *enemy, const ArcomageCard &card);
+
+/**
+ * @return                              How good the provided card is for the player, according to the AI of the
+ *                                      provided mastery (0 or 1).
+ */
+int arcomageCardPower(const ArcomagePlayerState &player, const ArcomagePlayerState &enemy, const ArcomageCard &card,
+                      int mastery, const ArcomageRules &rules);
+
+/**
+ * @param player                        AI player.
+ * @param enemy                         AI player's opponent.
+ * @param mastery                       AI skill, in [0, 2].
+ * @param mustDiscard                   Whether the AI has to discard a card.
+ * @param rules                         Game rules.
+ * @param rng                           Random engine to use.
+ * @return                              Move that the AI wants to make.
+ */
+ArcomageMove chooseArcomageAIMove(const ArcomagePlayerState &player, const ArcomagePlayerState &enemy, int mastery,
+                                  bool mustDiscard, const ArcomageRules &rules, RandomEngine *rng);
+
+bool isArcomageGameOver(const ArcomagePlayerState &player0, const ArcomagePlayerState &player1, const ArcomageRules &rules);
+
+ArcomageGameResult arcomageGameResult(const ArcomagePlayerState &player0, const ArcomagePlayerState &player1,
+                                      const ArcomageRules &rules);
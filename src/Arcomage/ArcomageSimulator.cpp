@@ -0,0 +1,138 @@
+#include "ArcomageSimulator.h"
+
+#include <array>
+
+#include "Library/Random/RandomEngine.h"
+
+// Games that go on for this long are considered stalled. Normal games take less than a hundred turns.
+static constexpr int MAX_TURNS = 5000;
+
+// Number of failed AI moves in a row after which the game is considered stalled.
+static constexpr int MAX_FAILED_MOVES = 100;
+
+namespace {
+
+class ArcomageSimulator {
+ public:
+    ArcomageSimulator(const ArcomageRules &rules, int mastery0, int mastery1, RandomEngine *rng) : _rules(rules), _rng(rng) {
+        _mastery = {mastery0, mastery1};
+
+        for (ArcomagePlayerState &player : _players) {
+            player.tower_height = rules.startTowerHeight;
+            player.wall_height = rules.startWallHeight;
+            player.quarry_level = rules.startQuarryLevel;
+            player.magic_level = rules.startMagicLevel;
+            player.zoo_level = rules.startZooLevel;
+            player.resource_bricks = rules.startBricks;
+            player.resource_gems = rules.startGems;
+            player.resource_beasts = rules.startBeasts;
+            for (int &card : player.cards_at_hand)
+                card = -1;
+        }
+    }
+
+    ArcomageGameResult run() {
+        shuffleArcomageDeck(&_deck, _players[0], _players[1], _rng);
+        for (int i = 0; i < _rules.minCardsAtHand; ++i)
+            drawCard(1);
+
+        for (int turn = 0; turn < MAX_TURNS; turn++) {
+            increaseArcomageResources(&_players[_currentPlayer], _rules);
+
+            bool turnNotFinished = true;
+            while (turnNotFinished) {
+                drawCard(_currentPlayer);
+                while (true) {
+                    turnNotFinished = playerTurn(_currentPlayer);
+                    if (_failedMoves >= MAX_FAILED_MOVES)
+                        return ArcomageGameResult();
+                    if (arcomageHandCardCount(_players[_currentPlayer]) <= _rules.minCardsAtHand) {
+                        _mustDiscard = false;
+                        break;
+                    }
+                    _mustDiscard = true;
+                }
+            }
+
+            if (isArcomageGameOver(_players[0], _players[1], _rules))
+                return arcomageGameResult(_players[0], _players[1], _rules);
+            _currentPlayer ^= 1;
+        }
+
+        return ArcomageGameResult();
+    }
+
+ private:
+    void drawCard(int playerIndex) {
+        int card = drawArcomageCard(&_deck, _players[0], _players[1], _rng);
+        int slot = arcomageEmptyCardSlot(_players[playerIndex]);
+        if (slot != -1)
+            _players[playerIndex].cards_at_hand[slot] = card;
+    }
+
+    /**
+     * @return                          Whether the player has actions left, mirrors `PlayerTurn`.
+     */
+    bool playerTurn(int playerIndex) {
+        ArcomagePlayerState &player = _players[playerIndex];
+        ArcomagePlayerState &enemy = _players[playerIndex ^ 1];
+        int actionsLeft = 0;
+
+        while (true) {
+            // Hand is topped up once the card drawing animation finishes.
+            while (arcomageHandCardCount(player) <= _rules.minCardsAtHand && _failedMoves < MAX_FAILED_MOVES)
+                drawCard(playerIndex);
+
+            ArcomageMove move = chooseArcomageAIMove(player, enemy, _mastery[playerIndex], _mustDiscard, _rules, _rng);
+            int card = move.slot == -1 ? -1 : player.cards_at_hand[move.slot];
+            if (card == -1) {
+                _failedMoves++;
+            } else if (move.discard) {
+                if (pCards[card].can_be_discarded) {
+                    player.cards_at_hand[move.slot] = -1;
+                    _mustDiscard = false;
+                    _failedMoves = 0;
+                } else {
+                    _failedMoves++;
+                }
+            } else {
+                const ArcomageCard &cardData = pCards[card];
+                player.resource_bricks -= cardData.needed_bricks;
+                player.resource_gems -= cardData.needed_gems;
+                player.resource_beasts -= cardData.needed_beasts;
+                player.cards_at_hand[move.slot] = -1;
+                _failedMoves = 0;
+
+                ArcomageCardEffects effects = applyArcomageCard(&player, &enemy, cardData);
+                for (int i = 0; i < effects.extraCards; i++)
+                    drawCard(playerIndex);
+                _mustDiscard = arcomageHandCardCount(player) > _rules.minCardsAtHand;
+                actionsLeft = effects.actions;
+            }
+
+            if (actionsLeft > 1) {
+                --actionsLeft;
+            } else {
+                break;
+            }
+        }
+
+        return actionsLeft > 0;
+    }
+
+ private:
+    const ArcomageRules &_rules;
+    RandomEngine *_rng = nullptr;
+    std::array<int, 2> _mastery = {};
+    std::array<ArcomagePlayerState, 2> _players;
+    ArcomageDeckState _deck;
+    int _currentPlayer = 0;
+    bool _mustDiscard = false;
+    int _failedMoves = 0;
+};
+
+} // namespace
+
+ArcomageGameResult simulateArcomageGame(const ArcomageRules &rules, int mastery0, int mastery1, RandomEngine *rng) {
+    return ArcomageSimulator(rules, mastery0, mastery1, rng).run();
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "ArcomageRules.h"
+
+class RandomEngine;
+
+/**
+ * Plays out a whole Arcomage game between two AI players without any UI, following the same turn structure as
+ * `ArcomageGame::Loop`.
+ *
+ * Player 0 moves first, player 1 starts with a full hand, same as in the tavern game.
+ *
+ * @param rules                         Game rules.
+ * @param mastery0                      AI skill of the first player, in [0, 2].
+ * @param mastery1                      AI skill of the second player, in [0, 2].
+ * @param rng                           Random engine to use. Results are deterministic for a given random state.
+ * @return                              Game result. Winner is -1 if the game has stalled, e.g. because both players
+ *                                      ended up holding only cards that can be neither played nor discarded.
+ */
+ArcomageGameResult simulateArcomageGame(const ArcomageRules &rules, int mastery0, int mastery1, RandomEngine *rng);
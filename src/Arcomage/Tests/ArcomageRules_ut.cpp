@@ -0,0 +1,128 @@
+#include <map>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Arcomage/ArcomageRules.h"
+#include "Arcomage/ArcomageSimulator.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+static ArcomagePlayerState makeTestPlayer() {
+    ArcomagePlayerState result;
+    result.tower_height = 20;
+    result.wall_height = 10;
+    result.quarry_level = 2;
+    result.magic_level = 2;
+    result.zoo_level = 2;
+    result.resource_bricks = 10;
+    result.resource_gems = 10;
+    result.resource_beasts = 10;
+    for (int &card : result.cards_at_hand)
+        card = -1;
+    return result;
+}
+
+UNIT_TEST(ArcomageRules, MasterDeck) {
+    std::map<int, int> counts;
+    for (int card : arcomageMasterDeck())
+        counts[card]++;
+
+    EXPECT_EQ(counts.size(), 87);
+    EXPECT_EQ(counts.begin()->first, 0);
+    EXPECT_EQ(counts.rbegin()->first, 86);
+}
+
+UNIT_TEST(ArcomageRules, ShuffleSkipsCardsInHands) {
+    ArcomagePlayerState player0 = makeTestPlayer();
+    ArcomagePlayerState player1 = makeTestPlayer();
+    player0.cards_at_hand[0] = 86; // Only one copy of this one in the deck.
+
+    MersenneTwisterRandomEngine rng;
+    ArcomageDeckState deck;
+    shuffleArcomageDeck(&deck, player0, player1, &rng);
+
+    for (int i = 0; i < DECK_SIZE; i++)
+        EXPECT_NE(drawArcomageCard(&deck, player0, player1, &rng), 86);
+}
+
+UNIT_TEST(ArcomageRules, DamageBuildings) {
+    ArcomagePlayerState player = makeTestPlayer();
+
+    EXPECT_EQ(damageArcomageBuildings(&player, -5), -5);
+    EXPECT_EQ(player.wall_height, 5);
+    EXPECT_EQ(player.tower_height, 20);
+
+    EXPECT_EQ(damageArcomageBuildings(&player, -8), -5);
+    EXPECT_EQ(player.wall_height, 0);
+    EXPECT_EQ(player.tower_height, 17);
+
+    EXPECT_EQ(damageArcomageBuildings(&player, -100), 0);
+    EXPECT_EQ(player.tower_height, 0);
+}
+
+UNIT_TEST(ArcomageRules, ApplyCard) {
+    ArcomagePlayerState player = makeTestPlayer();
+    ArcomagePlayerState enemy = makeTestPlayer();
+
+    ArcomageCard card = {};
+    card.compare_param = CHECK_ALWAYS_PRIMARY;
+    card.field_30 = 1;
+    card.to_player_wall = 3;
+    card.to_enemy_buildings = -15;
+
+    ArcomageCardEffects effects = applyArcomageCard(&player, &enemy, card);
+    EXPECT_EQ(player.wall_height, 13);
+    EXPECT_EQ(enemy.wall_height, 0);
+    EXPECT_EQ(enemy.tower_height, 15);
+    EXPECT_EQ(effects.actions, 1);
+    EXPECT_EQ(effects.extraCards, 0);
+    EXPECT_EQ(effects.player.wall, 3);
+    EXPECT_EQ(effects.enemy.wallDamage, -10);
+    EXPECT_EQ(effects.enemy.towerDamage, -5);
+}
+
+UNIT_TEST(ArcomageRules, GameResult) {
+    ArcomageRules rules = arcomageTavernRules(HOUSE_TAVERN_HARMONDALE);
+    ArcomagePlayerState player0 = makeTestPlayer();
+    ArcomagePlayerState player1 = makeTestPlayer();
+    EXPECT_FALSE(isArcomageGameOver(player0, player1, rules));
+
+    player1.tower_height = 0;
+    EXPECT_TRUE(isArcomageGameOver(player0, player1, rules));
+    EXPECT_EQ(arcomageGameResult(player0, player1, rules).winner, 1);
+    EXPECT_EQ(arcomageGameResult(player0, player1, rules).victoryType, 2);
+
+    player1.tower_height = 20;
+    player1.resource_gems = rules.maxResources;
+    EXPECT_TRUE(isArcomageGameOver(player0, player1, rules));
+    EXPECT_EQ(arcomageGameResult(player0, player1, rules).winner, 2);
+    EXPECT_EQ(arcomageGameResult(player0, player1, rules).victoryType, 3);
+}
+
+UNIT_TEST(ArcomageSimulator, Deterministic) {
+    for (HouseId tavern : allArcomageTaverns()) {
+        ArcomageRules rules = arcomageTavernRules(tavern);
+
+        for (int seed = 1; seed <= 10; seed++) {
+            MersenneTwisterRandomEngine rng0, rng1;
+            rng0.seed(seed);
+            rng1.seed(seed);
+
+            ArcomageGameResult result0 = simulateArcomageGame(rules, 2, rules.aiMastery, &rng0);
+            ArcomageGameResult result1 = simulateArcomageGame(rules, 2, rules.aiMastery, &rng1);
+            EXPECT_EQ(result0.winner, result1.winner);
+            EXPECT_EQ(result0.victoryType, result1.victoryType);
+            EXPECT_EQ(rng0.random(1000), rng1.random(1000));
+        }
+    }
+}
+
+UNIT_TEST(ArcomageSimulator, GamesFinish) {
+    ArcomageRules rules = arcomageTavernRules(HOUSE_TAVERN_HARMONDALE);
+    MersenneTwisterRandomEngine rng;
+
+    int finished = 0;
+    for (int i = 0; i < 100; i++)
+        finished += simulateArcomageGame(rules, 1, 1, &rng).winner != -1;
+    EXPECT_GE(finished, 90);
+}
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "Arcomage/ArcomageRules.h"
+#include "Arcomage/ArcomageSimulator.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+#include "Utility/Format.h"
+#include "Utility/ThreadPool.h"
+#include "Utility/UnicodeCrt.h"
+
+#include "ArcomageSimOptions.h"
+
+// Games are split into chunks of this size, each chunk gets its own random engine. This way the results don't depend
+// on the number of threads.
+static constexpr int GAMES_PER_CHUNK = 256;
+
+struct ArcomageSimStats {
+    int games = 0;
+    int stalled = 0;
+    std::array<int, 3> winners = {}; // Draws, first player wins, second player wins.
+
+    ArcomageSimStats &operator+=(const ArcomageSimStats &other) {
+        games += other.games;
+        stalled += other.stalled;
+        for (int i = 0; i < 3; i++)
+            winners[i] += other.winners[i];
+        return *this;
+    }
+};
+
+static ArcomageSimStats runChunk(const ArcomageRules &rules, int mastery0, int mastery1, int seed, int games) {
+    MersenneTwisterRandomEngine rng;
+    rng.seed(seed);
+
+    ArcomageSimStats result;
+    for (int i = 0; i < games; i++) {
+        ArcomageGameResult game = simulateArcomageGame(rules, mastery0, mastery1, &rng);
+        result.games++;
+        if (game.winner == -1) {
+            result.stalled++;
+        } else {
+            result.winners[game.winner]++;
+        }
+    }
+    return result;
+}
+
+static double percent(int count, int total) {
+    return total == 0 ? 0.0 : 100.0 * count / total;
+}
+
+int runSimulation(const ArcomageSimOptions &options) {
+    int threadCount = options.threads;
+    if (threadCount == 0)
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    ThreadPool pool(threadCount);
+
+    std::vector<HouseId> taverns;
+    for (HouseId tavern : allArcomageTaverns())
+        taverns.push_back(tavern);
+    if (options.tavern != 0)
+        taverns = {taverns[options.tavern - 1]};
+
+    auto startTime = std::chrono::steady_clock::now();
+    int totalGames = 0;
+
+    fmt::print("{:>6} {:>9} {:>8} {:>8} {:>8} {:>8}\n", "Tavern", "Mastery", "P1 win%", "P2 win%", "Draw%", "Stalled");
+    for (HouseId tavern : taverns) {
+        ArcomageRules rules = arcomageTavernRules(tavern);
+        int mastery1 = options.mastery1 == -1 ? rules.aiMastery : options.mastery1;
+
+        std::vector<std::future<ArcomageSimStats>> chunks;
+        for (int start = 0, chunk = 0; start < options.games; start += GAMES_PER_CHUNK, chunk++) {
+            int games = std::min(GAMES_PER_CHUNK, options.games - start);
+            int seed = options.seed * 1000003 + std::to_underlying(tavern) * 7919 + chunk;
+            chunks.push_back(pool.submit([=] { return runChunk(rules, options.mastery0, mastery1, seed, games); }));
+        }
+
+        ArcomageSimStats stats;
+        for (std::future<ArcomageSimStats> &chunk : chunks)
+            stats += chunk.get();
+        totalGames += stats.games;
+
+        fmt::print("{:>6} {:>9} {:>8.2f} {:>8.2f} {:>8.2f} {:>8}\n",
+                   std::to_underlying(tavern) - std::to_underlying(HOUSE_FIRST_ARCOMAGE_TAVERN) + 1,
+                   fmt::format("{} vs {}", options.mastery0, mastery1),
+                   percent(stats.winners[1], stats.games),
+                   percent(stats.winners[2], stats.games),
+                   percent(stats.winners[0], stats.games),
+                   stats.stalled);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    fmt::print("Played {} games in {:.2f}s on {} threads, {:.0f} games/s.\n", totalGames, seconds, threadCount,
+               seconds > 0 ? totalGames / seconds : 0.0);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+        UnicodeCrt _(argc, argv);
+        ArcomageSimOptions options = ArcomageSimOptions::parse(argc, argv);
+        if (options.helpPrinted)
+            return 1;
+
+        return runSimulation(options);
+    } catch (const std::exception &e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,21 @@
+#include "ArcomageSimOptions.h"
+
+#include <memory>
+
+#include "Library/Cli/CliApp.h"
+
+ArcomageSimOptions ArcomageSimOptions::parse(int argc, char **argv) {
+    ArcomageSimOptions result;
+    std::unique_ptr<CliApp> app = std::make_unique<CliApp>("Headless Arcomage simulator, plays out AI vs AI games and prints out the stats.\n");
+
+    app->set_help_flag("-h,--help", "Print help and exit.");
+    app->add_option("-g,--games", result.games, "Number of games to play in each tavern.")->check(CLI::PositiveNumber)->option_text("COUNT");
+    app->add_option("-j,--threads", result.threads, "Number of worker threads, 0 to use all cores.")->check(CLI::NonNegativeNumber)->option_text("COUNT");
+    app->add_option("-s,--seed", result.seed, "Random seed.")->option_text("SEED");
+    app->add_option("-t,--tavern", result.tavern, "Tavern number to use the rules of, 1-13. Runs all taverns if not set.")->check(CLI::Range(1, 13))->option_text("NUMBER");
+    app->add_option("--mastery0", result.mastery0, "AI skill of the first player, 0-2.")->check(CLI::Range(0, 2))->option_text("LEVEL");
+    app->add_option("--mastery1", result.mastery1, "AI skill of the second player, 0-2. Uses tavern's AI skill if not set.")->check(CLI::Range(0, 2))->option_text("LEVEL");
+
+    app->parse(argc, argv, result.helpPrinted);
+    return result;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+struct ArcomageSimOptions {
+    int games = 10000; // Number of games to simulate per tavern.
+    int threads = 0; // Number of worker threads, zero means use all cores.
+    int seed = 1;
+    int tavern = 0; // Tavern number, 1-based. Zero means all taverns.
+    int mastery0 = 2; // AI skill of the first player.
+    int mastery1 = -1; // AI skill of the second player, -1 means use the tavern's one.
+    bool helpPrinted = false; // True means that help message was already printed.
+
+    static ArcomageSimOptions parse(int argc, char **argv);
+};
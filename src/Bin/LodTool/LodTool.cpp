@@ -2,14 +2,34 @@
 
 #include <cstdio>
 
+#include "Library/Lod/LodJournal.h"
 #include "Library/Lod/LodReader.h"
 #include "Library/LodFormats/LodFormats.h"
 #include "Library/Serialization/Serialization.h"
 
+#include "Utility/Streams/OutputStream.h"
+#include "Utility/Exception.h"
 #include "Utility/Format.h"
 #include "Utility/String.h"
 #include "Utility/UnicodeCrt.h"
 
+class StdoutOutputStream : public OutputStream {
+ public:
+    virtual void write(const void *data, size_t size) override {
+        if (size > 0 && fwrite(data, size, 1, stdout) != 1)
+            throw Exception("Could not write to stdout");
+    }
+
+    virtual void flush() override {
+        if (fflush(stdout) != 0)
+            throw Exception("Could not flush stdout");
+    }
+
+    virtual void close() override {
+        flush();
+    }
+};
+
 int runLs(const LodToolOptions &options) {
     LodReader reader(options.lodPath, LOD_ALLOW_DUPLICATES);
     fmt::println("{}", fmt::join(reader.ls(), "\n"));
@@ -51,12 +71,22 @@ int runDump(const LodToolOptions &options) {
 int runCat(const LodToolOptions &options) {
     LodReader reader(options.lodPath, LOD_ALLOW_DUPLICATES);
     Blob data = reader.read(options.cat.entry);
-    if (!options.cat.raw) {
-        LodFileFormat format = lod::magic(data, options.cat.entry);
-        if (format == LOD_FILE_COMPRESSED || format == LOD_FILE_PSEUDO_IMAGE)
-            data = lod::decodeCompressed(data);
+
+    // Compressed entries are streamed out as they are decompressed, there's no point in holding them in memory.
+    StdoutOutputStream stream;
+    LodFileFormat format = options.cat.raw ? LOD_FILE_RAW : lod::magic(data, options.cat.entry);
+    if (format == LOD_FILE_COMPRESSED || format == LOD_FILE_PSEUDO_IMAGE) {
+        lod::decodeCompressed(data, &stream);
+    } else {
+        stream.write(data.data(), data.size());
     }
-    return fwrite(data.data(), data.size(), 1, stdout) != 1;
+    stream.close();
+    return 0;
+}
+
+int runExport(const LodToolOptions &options) {
+    exportLod(options.lodPath, options.export_.outputPath);
+    return 0;
 }
 
 int main(int argc, char **argv) {
@@ -71,6 +101,7 @@ int main(int argc, char **argv) {
         case LodToolOptions::SUBCOMMAND_LS: return runLs(options);
         case LodToolOptions::SUBCOMMAND_DUMP: return runDump(options);
         case LodToolOptions::SUBCOMMAND_CAT: return runCat(options);
+        case LodToolOptions::SUBCOMMAND_EXPORT: return runExport(options);
         }
     } catch (const std::exception &e) {
         fmt::print(stderr, "{}\n", e.what());
@@ -22,6 +22,10 @@ LodToolOptions LodToolOptions::parse(int argc, char **argv) {
     cat->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
     cat->add_option("ENTRY", result.cat.entry, "Name of the entry to print.")->required()->option_text(" ");
 
+    CLI::App *exportLod = app->add_subcommand("export", "Convert a lod journal (e.g. a quicksave) into a vanilla lod file.", result.subcommand, SUBCOMMAND_EXPORT)->fallthrough();
+    exportLod->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
+    exportLod->add_option("OUTPUT", result.export_.outputPath, "Path to the lod file to write.")->required()->option_text(" ");
+
     app->parse(argc, argv, result.helpPrinted);
     return result;
 }
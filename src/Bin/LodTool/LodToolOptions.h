@@ -7,6 +7,7 @@ struct LodToolOptions {
         SUBCOMMAND_LS,
         SUBCOMMAND_DUMP,
         SUBCOMMAND_CAT,
+        SUBCOMMAND_EXPORT,
     };
     using enum Subcommand;
 
@@ -15,10 +16,15 @@ struct LodToolOptions {
         bool raw = false;
     };
 
+    struct ExportOptions {
+        std::string outputPath;
+    };
+
     Subcommand subcommand = SUBCOMMAND_DUMP;
     std::string lodPath;
     bool helpPrinted = false; // True means that help message was already printed.
     CatOptions cat;
+    ExportOptions export_;
 
     static LodToolOptions parse(int argc, char **argv);
 };
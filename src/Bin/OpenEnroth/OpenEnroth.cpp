@@ -1,5 +1,6 @@
 #include <cstdio>
 #include <cassert>
+#include <filesystem>
 #include <utility>
 #include <ranges>
 
@@ -18,6 +19,7 @@
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/Trace/EventTrace.h"
 
+#include "Utility/Memory/Blob.h"
 #include "Utility/Streams/FileInputStream.h"
 #include "Utility/Format.h"
 #include "Utility/UnicodeCrt.h"
@@ -73,14 +75,22 @@ int runRetrace(const OpenEnrothOptions &options) {
             if (options.retrace.checkCanonical)
                 oldTraceJson = readTextFile(tracePath);
 
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
+            std::string savePath = std::filesystem::path(tracePath).replace_extension(".mm7").string();
 
             EventTrace oldTrace = EventTrace::loadFromFile(tracePath, application->window());
             EngineTraceStateAccessor::prepareForPlayback(engine->config.get(), oldTrace.header.config);
 
-            recorder->startRecording(game, savePath, tracePath, TRACE_RECORDING_LOAD_EXISTING_SAVE);
+            // Retraced trace is written out in the same format.
+            EngineTraceRecordingFlags recordingFlags = TRACE_RECORDING_LOAD_EXISTING_SAVE;
+            if (EventTrace::detectFormat(Blob::fromFile(tracePath)) == EVENT_TRACE_BINARY)
+                recordingFlags |= TRACE_RECORDING_BINARY;
+
+            recorder->startRecording(game, savePath, tracePath, recordingFlags);
             engine->config->graphics.FPSLimit.setValue(0);
-            player->playTrace(game, std::move(oldTrace.events), tracePath, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS);
+            EngineTracePlaybackFlags flags = TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS;
+            if (options.retrace.fastForward)
+                flags |= TRACE_PLAYBACK_FAST_FORWARD;
+            player->playTrace(game, std::move(oldTrace.events), tracePath, flags);
             recorder->finishRecording(game);
 
             if (options.retrace.checkCanonical) {
@@ -109,8 +119,11 @@ int runPlay(const OpenEnrothOptions &options) {
         for (const std::string &tracePath : options.play.traces) {
             fmt::println(stderr, "Playing back '{}'...", tracePath);
 
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
-            player->playTrace(game, savePath, tracePath, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS , [&] {
+            std::string savePath = std::filesystem::path(tracePath).replace_extension(".mm7").string();
+            EngineTracePlaybackFlags flags = TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS;
+            if (options.play.fastForward)
+                flags |= TRACE_PLAYBACK_FAST_FORWARD;
+            player->playTrace(game, savePath, tracePath, flags, [&] {
                 int fps = options.play.speed * 1000 / engine->config->debug.TraceFrameTimeMs.value();
                 engine->config->graphics.FPSLimit.setValue(std::max(1, fps));
             });
@@ -31,12 +31,19 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     app->add_flag_callback(
         "-v,--verbose", [&] { result.logLevel = LOG_TRACE; },
         "Set log level to 'trace'.");
+    app->add_option(
+        "--profile", result.profilePath,
+        "Enable the profiler and write out the recorded zones in Chrome trace format on exit. Output can be opened in "
+        "'chrome://tracing' or Perfetto.")->option_text("PATH");
     app->set_help_flag("-h,--help", "Print help and exit.");
 
     CLI::App *play = app->add_subcommand("play", "Play provided traces.", result.subcommand, SUBCOMMAND_PLAY)->fallthrough();
     play->add_option(
         "--speed", result.play.speed,
         "Playback speed, default is '1.0'.")->option_text("SPEED");
+    play->add_flag(
+        "--fast-forward", result.play.fastForward,
+        "Only draw the world & HUD on frames that are followed by input.");
     play->add_option(
         "TRACE", result.play.traces,
         "Path to trace file(s) to play.")->required()->option_text("...");
@@ -53,6 +60,9 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     retrace->add_flag(
         "--check-canonical", result.retrace.checkCanonical,
         "Check whether all passed traces are stored in canonical representation and return an error if not.");
+    retrace->add_flag(
+        "--fast-forward", result.retrace.fastForward,
+        "Only draw the world & HUD on frames that are followed by input.");
     retrace->add_flag(
         "--glob", globTraces,
         "Glob passed trace paths.")->group(""); // group("") hides this option. It's here so that we don't have to jump through hoops in cmake.
@@ -19,11 +19,13 @@ struct OpenEnrothOptions : public GameStarterOptions {
     struct RetraceOptions {
         std::vector<std::string> traces;
         bool checkCanonical = false;
+        bool fastForward = false;
     };
 
     struct PlayOptions {
         std::vector<std::string> traces;
         float speed = 1.0f;
+        bool fastForward = false;
     };
 
     Subcommand subcommand = SUBCOMMAND_GAME;
@@ -0,0 +1,128 @@
+#include "TraceToolOptions.h"
+
+#include <cassert>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Library/Serialization/Serialization.h"
+#include "Library/Trace/EventTrace.h"
+
+#include "Utility/Memory/Blob.h"
+#include "Utility/Format.h"
+#include "Utility/UnicodeCrt.h"
+
+int runConvert(const TraceToolOptions &options) {
+    EventTraceFormat inputFormat = EventTrace::detectFormat(Blob::fromFile(options.convert.inputPath));
+    EventTraceFormat outputFormat = options.convert.format.value_or(inputFormat == EVENT_TRACE_JSON ? EVENT_TRACE_BINARY : EVENT_TRACE_JSON);
+
+    EventTrace trace = EventTrace::loadFromFile(options.convert.inputPath, nullptr);
+    EventTrace::saveToFile(options.convert.outputPath, trace, outputFormat);
+
+    fmt::println("Converted '{}' ({}) into '{}' ({}), {} events.", options.convert.inputPath, toString(inputFormat),
+                 options.convert.outputPath, toString(outputFormat), trace.events.size());
+    return 0;
+}
+
+static std::vector<std::string> collectTraces(const std::vector<std::string> &paths) {
+    std::vector<std::string> result;
+    for (const std::string &path : paths) {
+        if (!std::filesystem::is_directory(path)) {
+            result.push_back(path);
+            continue;
+        }
+
+        for (const std::filesystem::directory_entry &entry : std::filesystem::recursive_directory_iterator(path))
+            if (entry.is_regular_file() && entry.path().extension() == ".json")
+                result.push_back(entry.path().generic_string());
+    }
+    std::ranges::sort(result);
+    return result;
+}
+
+/**
+ * @param path                          Path to the trace file.
+ * @param iterations                    Number of times to load the trace.
+ * @return                              Best load time, in milliseconds.
+ */
+static double measureLoadTime(const std::string &path, int iterations) {
+    double result = std::numeric_limits<double>::max();
+    for (int i = 0; i < iterations; i++) {
+        auto startTime = std::chrono::steady_clock::now();
+        EventTrace trace = EventTrace::loadFromFile(path, nullptr);
+        result = std::min(result, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+    }
+    return result;
+}
+
+int runBench(const TraceToolOptions &options) {
+    std::string binaryPath = (std::filesystem::temp_directory_path() / "TraceTool_bench.bin").string();
+
+    size_t totalJsonSize = 0, totalBinarySize = 0;
+    double totalJsonMs = 0, totalBinaryMs = 0;
+    int count = 0;
+
+    fmt::println("{:<60} {:>10} {:>10} {:>10} {:>10}", "Trace", "JSON KiB", "Bin KiB", "JSON ms", "Bin ms");
+    for (const std::string &path : collectTraces(options.bench.paths)) {
+        try {
+            if (EventTrace::detectFormat(Blob::fromFile(path)) != EVENT_TRACE_JSON)
+                continue;
+
+            EventTrace::saveToFile(binaryPath, EventTrace::loadFromFile(path, nullptr), EVENT_TRACE_BINARY);
+        } catch (const std::exception &) {
+            continue; // Not a trace, test data folder has other json files.
+        }
+
+        size_t jsonSize = std::filesystem::file_size(path);
+        size_t binarySize = std::filesystem::file_size(binaryPath);
+        double jsonMs = measureLoadTime(path, options.bench.iterations);
+        double binaryMs = measureLoadTime(binaryPath, options.bench.iterations);
+
+        fmt::println("{:<60} {:>10.1f} {:>10.1f} {:>10.2f} {:>10.2f}", std::filesystem::path(path).filename().string(),
+                     jsonSize / 1024.0, binarySize / 1024.0, jsonMs, binaryMs);
+
+        totalJsonSize += jsonSize;
+        totalBinarySize += binarySize;
+        totalJsonMs += jsonMs;
+        totalBinaryMs += binaryMs;
+        count++;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(binaryPath, ec);
+
+    if (count == 0) {
+        fmt::println(stderr, "No json traces found.");
+        return 1;
+    }
+
+    fmt::println("{:<60} {:>10.1f} {:>10.1f} {:>10.2f} {:>10.2f}", fmt::format("Total ({} traces)", count),
+                 totalJsonSize / 1024.0, totalBinarySize / 1024.0, totalJsonMs, totalBinaryMs);
+    fmt::println("Binary traces are {:.1f}x smaller and load {:.1f}x faster.",
+                 static_cast<double>(totalJsonSize) / std::max<size_t>(totalBinarySize, 1),
+                 totalJsonMs / std::max(totalBinaryMs, 0.001));
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+        UnicodeCrt _(argc, argv);
+        TraceToolOptions options = TraceToolOptions::parse(argc, argv);
+        if (options.helpPrinted)
+            return 1;
+
+        switch (options.subcommand) {
+        default: assert(false); [[fallthrough]];
+        case TraceToolOptions::SUBCOMMAND_CONVERT: return runConvert(options);
+        case TraceToolOptions::SUBCOMMAND_BENCH: return runBench(options);
+        }
+    } catch (const std::exception &e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+}
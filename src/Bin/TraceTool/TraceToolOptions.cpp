@@ -0,0 +1,31 @@
+#include "TraceToolOptions.h"
+
+#include <memory>
+
+#include "Library/Cli/CliApp.h"
+
+TraceToolOptions TraceToolOptions::parse(int argc, char **argv) {
+    TraceToolOptions result;
+    std::unique_ptr<CliApp> app = std::make_unique<CliApp>("OpenEnroth event trace manipulation tool.\n");
+
+    app->set_help_flag("-h,--help", "Print help and exit.");
+    app->require_subcommand();
+
+    CLI::App *convert = app->add_subcommand("convert", "Convert a trace between json and binary formats.", result.subcommand, SUBCOMMAND_CONVERT)->fallthrough();
+    convert->add_option(
+        "--format", result.convert.format,
+        "Format to convert into, one of 'json', 'binary'. Default is to use the format that the input file is not in.")->option_text("FORMAT");
+    convert->add_option("TRACE", result.convert.inputPath, "Path to trace file.")->check(CLI::ExistingFile)->required()->option_text(" ");
+    convert->add_option("OUTPUT", result.convert.outputPath, "Path to the trace file to write.")->required()->option_text(" ");
+
+    CLI::App *bench = app->add_subcommand("bench", "Compare trace load times for json and binary formats.", result.subcommand, SUBCOMMAND_BENCH)->fallthrough();
+    bench->add_option(
+        "-i,--iterations", result.bench.iterations,
+        "Number of times to load each trace, best time is reported. Default is 3.")->check(CLI::PositiveNumber)->option_text("COUNT");
+    bench->add_option(
+        "PATH", result.bench.paths,
+        "Json trace files, or folders to look for json traces in, e.g. test data folder.")->check(CLI::ExistingPath)->required()->option_text("...");
+
+    app->parse(argc, argv, result.helpPrinted);
+    return result;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Library/Trace/EventTraceEnums.h"
+
+struct TraceToolOptions {
+    enum class Subcommand {
+        SUBCOMMAND_CONVERT,
+        SUBCOMMAND_BENCH,
+    };
+    using enum Subcommand;
+
+    struct ConvertOptions {
+        std::string inputPath;
+        std::string outputPath;
+        std::optional<EventTraceFormat> format; // Target format, default is to flip the format of the input file.
+    };
+
+    struct BenchOptions {
+        std::vector<std::string> paths; // Trace files or folders to look for json traces in.
+        int iterations = 3;
+    };
+
+    Subcommand subcommand = SUBCOMMAND_CONVERT;
+    bool helpPrinted = false; // True means that help message was already printed.
+    ConvertOptions convert;
+    BenchOptions bench;
+
+    static TraceToolOptions parse(int argc, char **argv);
+};
@@ -1,6 +1,8 @@
 #include "Engine/AssetsManager.h"
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "Engine/Graphics/ImageLoader.h"
 #include "Engine/Graphics/Image.h"
@@ -31,6 +33,48 @@ void AssetsManager::releaseAllTextures() {
     ReloadFonts();
 }
 
+void AssetsManager::trimImages(size_t cpuBudget, size_t gpuBudget) {
+    uint64_t frameStart = _lastTrimStamp;
+    _lastTrimStamp = GraphicsImage::currentUseStamp();
+
+    if (cpuBudget == 0 && gpuBudget == 0)
+        return; // No limits, don't even bother computing the usage.
+
+    CacheUsage total = imageUsage();
+    if ((cpuBudget == 0 || total.cpuBytes <= cpuBudget) && (gpuBudget == 0 || total.gpuBytes <= gpuBudget))
+        return;
+
+    std::vector<LruCandidate<GraphicsImage *>> cpuCandidates;
+    std::vector<LruCandidate<GraphicsImage *>> gpuCandidates;
+    for (const auto *map : {&images, &bitmaps, &sprites}) {
+        for (const auto &[_, image] : *map) {
+            if (image->lastUse() > frameStart)
+                continue; // Used in the current frame.
+            if (image->cpuBytes() > 0)
+                cpuCandidates.push_back({image, image->lastUse(), image->cpuBytes()});
+            if (image->gpuBytes() > 0)
+                gpuCandidates.push_back({image, image->lastUse(), image->gpuBytes()});
+        }
+    }
+
+    for (GraphicsImage *image : selectLruVictims(std::move(cpuCandidates), total.cpuBytes, cpuBudget))
+        image->releaseImageData();
+    for (GraphicsImage *image : selectLruVictims(std::move(gpuCandidates), total.gpuBytes, gpuBudget))
+        image->releaseRenderId();
+}
+
+CacheUsage AssetsManager::imageUsage() const {
+    CacheUsage result;
+    for (const auto *map : {&images, &bitmaps, &sprites}) {
+        result.entries += map->size();
+        for (const auto &[_, image] : *map) {
+            result.cpuBytes += image->cpuBytes();
+            result.gpuBytes += image->gpuBytes();
+        }
+    }
+    return result;
+}
+
 bool AssetsManager::releaseImage(const std::string &name) {
     std::string filename = toLower(name);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <memory>
@@ -7,6 +8,8 @@
 #include "Library/Color/ColorTable.h"
 #include "GUI/GUIFont.h"
 
+#include "Utility/CacheBudget.h"
+
 class GraphicsImage;
 
 class AssetsManager {
@@ -15,6 +18,24 @@ class AssetsManager {
 
     void releaseAllTextures();
 
+    /**
+     * Frees the decoded data and the textures of the least recently used images until the cache fits into the
+     * provided budgets. Images themselves are not destroyed as they are referenced all over the place, and their data
+     * is reloaded on next access.
+     *
+     * Images that were accessed since the last call to this function are never evicted, so this is supposed to be
+     * called once per frame.
+     *
+     * @param cpuBudget                 Max size of the decoded image data, in bytes. Zero means no limit.
+     * @param gpuBudget                 Max size of the uploaded textures, in bytes. Zero means no limit.
+     */
+    void trimImages(size_t cpuBudget, size_t gpuBudget);
+
+    /**
+     * @return                          Memory used by the images created through this assets manager.
+     */
+    [[nodiscard]] CacheUsage imageUsage() const;
+
     // TODO(captainurist): These are called back from GraphicsImage::Release, which is a questionable design.
     bool releaseImage(const std::string &name);
     bool releaseSprite(const std::string &name);
@@ -50,6 +71,7 @@ class AssetsManager {
     std::unordered_map<std::string, GraphicsImage *> bitmaps;
     std::unordered_map<std::string, GraphicsImage *> sprites;
     std::unordered_map<std::string, GraphicsImage *> images;
+    uint64_t _lastTrimStamp = 0;
 };
 
 extern AssetsManager *assets;
@@ -11,8 +11,12 @@
 #include "GUI/GUIWindow.h"
 #include "GUI/GUIButton.h"
 
+#include "Engine/Components/Random/EngineRandomComponent.h"
 #include "Engine/SaveLoad.h"
+#include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
+#include "Engine/Party.h"
+#include "Engine/Time/Timer.h"
 #include "Engine/mm7_data.h"
 
 #include "Library/Platform/Application/PlatformApplication.h"
@@ -216,6 +220,52 @@ void EngineController::loadGame(const std::string &path) {
     skipLoadingScreen();
 }
 
+EngineSnapshot EngineController::makeSnapshot() {
+    if (current_screen_type != SCREEN_GAME)
+        throw Exception("Can't make an engine snapshot outside of the game screen");
+
+    EngineSnapshot result;
+    runGameRoutine([&] { result.saveLod = ::SaveGameToMemory(); });
+    result.randomState = ::application->component<EngineRandomComponent>()->saveState();
+    result.partyPos = pParty->pos;
+    result.partyLastPos = pParty->lastPos;
+    result.partySpeed = pParty->speed;
+    result.partyRoundingDt = pParty->_roundingDt;
+    result.eventTimer = raw(*pEventTimer);
+    result.miscTimer = raw(*pMiscTimer);
+    result.platformTime = Duration::fromRealtimeMilliseconds(::platform->tickCount());
+    return result;
+}
+
+void EngineController::restoreSnapshot(const EngineSnapshot &snapshot) {
+    if (current_screen_type != SCREEN_GAME)
+        throw Exception("Can't restore an engine snapshot outside of the game screen");
+
+    // Same as QuickLoadGame. Game routine runs from inside the game loop, which then picks up the game state change,
+    // leaves the current map without updating the world, and loads the map from the snapshot.
+    runGameRoutine([&] {
+        ::LoadGameFromMemory(snapshot.saveLod);
+        uGameState = GAME_STATE_LOADING_GAME;
+    });
+    skipLoadingScreen();
+
+    // Map loading consumes random numbers, so random state is restored last.
+    ::application->component<EngineRandomComponent>()->restoreState(snapshot.randomState);
+
+    // Then restore the state that got lost in the save round trip. Loading screen took some frames, so the timers are
+    // rebased on the current platform time, so that the next frame gets the same dt as it would in the original run.
+    pParty->pos = snapshot.partyPos;
+    pParty->lastPos = snapshot.partyLastPos;
+    pParty->speed = snapshot.partySpeed;
+    pParty->_roundingDt = snapshot.partyRoundingDt;
+
+    Duration platformTimeShift = Duration::fromRealtimeMilliseconds(::platform->tickCount()) - snapshot.platformTime;
+    raw(*pEventTimer) = snapshot.eventTimer;
+    raw(*pEventTimer)._lastFrameTime += platformTimeShift;
+    raw(*pMiscTimer) = snapshot.miscTimer;
+    raw(*pMiscTimer)._lastFrameTime += platformTimeShift;
+}
+
 void EngineController::runGameRoutine(GameRoutine routine) {
     _state->gameRoutine = std::move(routine);
     _state.yieldExecution();
@@ -7,6 +7,7 @@
 #include "Library/Platform/Interface/PlatformEvents.h"
 
 #include "EngineControlStateHandle.h"
+#include "EngineSnapshot.h"
 
 class GUIButton;
 class PlatformEvent;
@@ -85,6 +86,30 @@ class EngineController {
      */
     void loadGame(const std::string &path);
 
+    /**
+     * Makes an in-memory snapshot of the current game state. This is a lot cheaper than saving the game as nothing is
+     * written to disk, and the game state is not altered in any way.
+     *
+     * Restoring the snapshot reloads the current map, so only the state that's stored in saves, plus the state listed
+     * in `EngineSnapshot`, is restored. This is enough for the game to replay the same way from the snapshot, but
+     * things like UI state, sound & particles are not restored.
+     *
+     * @return                          Engine snapshot.
+     * @throws Exception                If not on the game screen.
+     */
+    [[nodiscard]] EngineSnapshot makeSnapshot();
+
+    /**
+     * Restores the game state from an in-memory snapshot. Unlike `loadGame`, this doesn't go through the menus and
+     * doesn't touch the disk, the snapshot is loaded in-game, the same way quick load works. The snapshot is not
+     * consumed, so it's possible to restore from it several times, e.g. to run several tests starting from the same
+     * game state.
+     *
+     * @param snapshot                  Snapshot to restore, as returned by `makeSnapshot`.
+     * @throws Exception                If not on the game screen.
+     */
+    void restoreSnapshot(const EngineSnapshot &snapshot);
+
     /**
      * Runs the provided routine in game thread and returns once it's finished. This is mainly for running OpenGL code
      * as the corresponding context is bound in the main thread.
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Engine/Components/Random/EngineRandomComponent.h"
+#include "Engine/Time/Duration.h"
+#include "Engine/Time/Timer.h"
+
+#include "Library/Geometry/Vec.h"
+
+#include "Utility/Memory/Blob.h"
+
+/**
+ * In-memory snapshot of the engine state, see `EngineController::makeSnapshot`.
+ *
+ * Everything that's stored in saves - party, timers, NPC data, actors and sprite objects of the current map - lives in
+ * an in-memory save LOD, so restoring a snapshot goes through the same code path as loading a save, minus the disk.
+ *
+ * Vanilla saves are lossy though - party position is stored as ints, horizontal party speed is dropped, and
+ * `pMiscTimer` is not stored at all. This state is kept in the snapshot separately, and is reapplied after the save is
+ * loaded back.
+ */
+struct EngineSnapshot {
+    Blob saveLod; // Save LOD, as returned by `SaveGameToMemory`.
+    EngineRandomState randomState; // State of `grng` & `vrng`.
+
+    Vec3f partyPos; // `pParty->pos`, at full precision.
+    Vec3f partyLastPos; // `pParty->lastPos`, at full precision.
+    Vec3f partySpeed; // `pParty->speed`, all three components.
+    Duration partyRoundingDt; // `pParty->_roundingDt`.
+    RawTimer eventTimer; // State of `pEventTimer`.
+    RawTimer miscTimer; // State of `pMiscTimer`.
+    Duration platformTime; // Platform time at the moment the snapshot was made, used to rebase the timers on restore.
+};
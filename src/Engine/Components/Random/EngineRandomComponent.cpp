@@ -62,6 +62,24 @@ void EngineRandomComponent::seed(int seed) {
     }
 }
 
+EngineRandomState EngineRandomComponent::saveState() const {
+    EngineRandomState result;
+    result.type = _type;
+    result.grng = _grngs[_type]->clone();
+    result.vrng = _vrngs[_type]->clone();
+    return result;
+}
+
+void EngineRandomComponent::restoreState(const EngineRandomState &state) {
+    assert(state.grng && state.vrng);
+
+    _type = state.type;
+    _grngs[_type] = state.grng->clone();
+    _vrngs[_type] = state.vrng->clone();
+    _tracingGrngs[_type] = std::make_unique<TracingRandomEngine>(application()->platform(), _grngs[_type].get());
+    swizzleGlobals();
+}
+
 void EngineRandomComponent::installNotify() {
     for (RandomEngineType type : _grngs.indices()) {
         _vrngs[type] = createRandomEngine(type);
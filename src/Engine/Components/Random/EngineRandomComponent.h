@@ -5,12 +5,21 @@
 #include "Engine/Random/RandomEnums.h"
 
 #include "Library/Platform/Application/PlatformApplicationAware.h"
+#include "Library/Random/RandomEngine.h"
 
 #include "Utility/IndexedArray.h"
 
-class RandomEngine;
 class Platform;
 
+/**
+ * Copy of the state of the currently active random engines, see `EngineRandomComponent::saveState`.
+ */
+struct EngineRandomState {
+    RandomEngineType type = RANDOM_ENGINE_MERSENNE_TWISTER;
+    std::unique_ptr<RandomEngine> grng;
+    std::unique_ptr<RandomEngine> vrng;
+};
+
 class EngineRandomComponent : public PlatformApplicationAware {
  public:
     EngineRandomComponent();
@@ -29,6 +38,19 @@ class EngineRandomComponent : public PlatformApplicationAware {
      */
     void seed(int seed);
 
+    /**
+     * @return                          Copy of the state of the currently active `grng` and `vrng`.
+     */
+    [[nodiscard]] EngineRandomState saveState() const;
+
+    /**
+     * Restores the state of the random engines, switching to the random engine type that was active when the state
+     * was saved. The provided state is copied, and thus can be restored several times.
+     *
+     * @param state                     State to restore, as returned by `saveState`.
+     */
+    void restoreState(const EngineRandomState &state);
+
  private:
     virtual void installNotify() override;
     virtual void removeNotify() override;
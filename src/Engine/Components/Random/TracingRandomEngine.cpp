@@ -32,6 +32,10 @@ void TracingRandomEngine::seed(int seed) {
     _base->seed(seed);
 }
 
+std::unique_ptr<RandomEngine> TracingRandomEngine::clone() const {
+    return _base->clone(); // All the state is in the base engine, and tracing is not part of it.
+}
+
 template<class T>
 void TracingRandomEngine::printTrace(const char *function, const T &value) const {
     fmt::println(stderr, "TracingRandomEngine::{} called at {}ms, returning {}, stacktrace:",
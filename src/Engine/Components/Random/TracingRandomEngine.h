@@ -14,6 +14,7 @@ class TracingRandomEngine : public RandomEngine {
     virtual int random(int hi) override;
     virtual int peek(int hi) const override;
     virtual void seed(int seed) override;
+    virtual std::unique_ptr<RandomEngine> clone() const override;
 
  private:
     template<class T>
@@ -6,13 +6,15 @@ enum class EngineTracePlaybackFlag {
     TRACE_PLAYBACK_SKIP_RANDOM_CHECKS = 0x1,
     TRACE_PLAYBACK_SKIP_TIME_CHECKS = 0x2,
     TRACE_PLAYBACK_SKIP_STATE_CHECKS = 0x4,
+    TRACE_PLAYBACK_FAST_FORWARD = 0x8, // Don't draw the world & HUD on frames that are not followed by input.
 };
 using enum EngineTracePlaybackFlag;
 MM_DECLARE_FLAGS(EngineTracePlaybackFlags, EngineTracePlaybackFlag)
 MM_DECLARE_OPERATORS_FOR_FLAGS(EngineTracePlaybackFlags)
 
 enum class EngineTraceRecordingFlag {
-    TRACE_RECORDING_LOAD_EXISTING_SAVE = 0x1
+    TRACE_RECORDING_LOAD_EXISTING_SAVE = 0x1,
+    TRACE_RECORDING_BINARY = 0x2, // Save the trace in binary format instead of JSON.
 };
 using enum EngineTraceRecordingFlag;
 MM_DECLARE_FLAGS(EngineTraceRecordingFlags, EngineTraceRecordingFlag)
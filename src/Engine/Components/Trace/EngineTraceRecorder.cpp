@@ -32,6 +32,7 @@ void EngineTraceRecorder::startRecording(EngineController *game, const std::stri
 
     _savePath = savePath;
     _tracePath = tracePath;
+    _traceFormat = (flags & TRACE_RECORDING_BINARY) ? EVENT_TRACE_BINARY : EVENT_TRACE_JSON;
     _trace = std::make_unique<EventTrace>();
     _configSnapshot = std::make_unique<ConfigPatch>(ConfigPatch::fromConfig(engine->config.get()));
 
@@ -79,7 +80,7 @@ void EngineTraceRecorder::finishRecording(EngineController *game) {
     _trace->events = component<EngineTraceSimpleRecorder>()->finishRecording();
     _trace->header.endState = EngineTraceStateAccessor::makeGameState();
 
-    EventTrace::saveToFile(_tracePath, *_trace);
+    EventTrace::saveToFile(_tracePath, *_trace, _traceFormat);
 
     logger->info("Trace saved to {} and {}",
                  absolute(std::filesystem::path(_savePath)).generic_string(),
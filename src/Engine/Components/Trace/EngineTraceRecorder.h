@@ -6,6 +6,8 @@
 
 #include "Library/Platform/Application/PlatformApplicationAware.h"
 
+#include "Library/Trace/EventTraceEnums.h"
+
 #include "EngineTraceEnums.h"
 
 class EngineController;
@@ -75,6 +77,7 @@ class EngineTraceRecorder : private PlatformApplicationAware {
  private:
     std::string _savePath;
     std::string _tracePath;
+    EventTraceFormat _traceFormat = EVENT_TRACE_JSON;
     std::unique_ptr<EventTrace> _trace;
     std::unique_ptr<ConfigPatch> _configSnapshot;
 };
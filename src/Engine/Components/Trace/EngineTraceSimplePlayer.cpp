@@ -1,9 +1,11 @@
 #include "EngineTraceSimplePlayer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <utility>
 
 #include "Engine/Components/Control/EngineController.h"
+#include "Engine/Engine.h"
 #include "Engine/Random/Random.h"
 
 #include "Library/Platform/Application/PlatformApplication.h"
@@ -12,6 +14,31 @@
 #include "Utility/ScopeGuard.h"
 #include "Utility/Exception.h"
 
+// When fast-forwarding, the world is still drawn on this many frames before each input event. Input handling uses the
+// render lists from the last drawn frame for picking, and the pointed object is updated once per frame from the same
+// lists, so we need a margin of more than one frame here.
+static constexpr int FAST_FORWARD_DRAW_MARGIN = 3;
+
+/**
+ * @param events                        Trace events.
+ * @return                              Vector with an element for each paint event in `events`, set to `true` if the
+ *                                      world needs to be drawn on that frame.
+ */
+static std::vector<bool> framesToDraw(const std::vector<std::unique_ptr<PlatformEvent>> &events) {
+    std::vector<bool> result;
+    int framesToInput = FAST_FORWARD_DRAW_MARGIN;
+    for (auto pos = events.rbegin(); pos != events.rend(); pos++) {
+        if ((*pos)->type == EVENT_PAINT) {
+            result.push_back(framesToInput < FAST_FORWARD_DRAW_MARGIN);
+            framesToInput++;
+        } else {
+            framesToInput = 0;
+        }
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
 EngineTraceSimplePlayer::EngineTraceSimplePlayer() = default;
 EngineTraceSimplePlayer::~EngineTraceSimplePlayer() = default;
 
@@ -25,11 +52,21 @@ void EngineTraceSimplePlayer::playTrace(EngineController *game, std::vector<std:
     _tracePath = tracePath;
     _flags = flags;
 
+    std::vector<bool> drawnFrames;
+    if (flags & TRACE_PLAYBACK_FAST_FORWARD)
+        drawnFrames = framesToDraw(events);
+    MM_AT_SCOPE_EXIT(engine->setWorldDrawingSkipped(false));
+
     if (tickCallback)
         tickCallback();
 
+    size_t frameIndex = 0;
     for (std::unique_ptr<PlatformEvent> &event : events) {
         if (event->type == EVENT_PAINT) {
+            if (!drawnFrames.empty())
+                engine->setWorldDrawingSkipped(!drawnFrames[frameIndex]);
+            frameIndex++;
+
             game->tick(1);
 
             if (tickCallback)
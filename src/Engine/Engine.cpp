@@ -1,6 +1,7 @@
 #include <cstring>
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -32,6 +33,7 @@
 #include "Engine/LodTextureCache.h"
 #include "Engine/LodSpriteCache.h"
 #include "Engine/Localization.h"
+#include "Engine/MapAssetManifest.h"
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/Chest.h"
 #include "Engine/Objects/ObjectList.h"
@@ -79,8 +81,11 @@
 
 #include "Library/Logger/Logger.h"
 #include "Library/BuildInfo/BuildInfo.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/DataPath.h"
+#include "Utility/TaskGraph.h"
+#include "Utility/ThreadPool.h"
 
 /*
 
@@ -122,6 +127,8 @@ Engine *engine;
 GameState uGameState;
 
 void Engine::drawWorld() {
+    MM_PROFILE_ZONE("Engine::drawWorld");
+
     engine->SetSaturateFaces(pParty->_497FC5_check_party_perception_against_level());
 
     pCamera3D->_viewPitch = pParty->_viewPitch;
@@ -152,6 +159,18 @@ void Engine::drawWorld() {
         pParty->_viewPrevPitch = pParty->_viewPitch;
 
         pParty->lastEyeLevel = pParty->eyeLevel;
+        if (_worldDrawingSkipped) {
+            if (!PauseGameDrawing()) {
+                if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+                    pIndoor->UpdateWithoutDrawing();
+                } else {
+                    assert(uCurrentlyLoadedLevelType == LEVEL_OUTDOOR);
+                    pOutdoor->UpdateWithoutDrawing();
+                }
+            }
+            return;
+        }
+
         render->BeginScene3D();
 
         // if ( !render->pRenderD3D )
@@ -180,8 +199,23 @@ void Engine::drawWorld() {
 }
 
 void Engine::drawHUD() {
+    MM_PROFILE_ZONE("Engine::drawHUD");
+
     // 2d from now on
     render->BeginScene2D();
+
+    if (_worldDrawingSkipped) {
+        // Only the parts of the HUD that update game state. Windows update their state in the same call that draws
+        // them, so these are still drawn, but into a frame that's never presented.
+        if (nuklear->Mode(WINDOW_GameUI) != nuklear->NUKLEAR_MODE_EXCLUSIVE) {
+            GameUI_UpdatePortraits();
+            GUI_UpdateWindows();
+            pParty->updateCharactersAndHirelingsEmotions();
+        }
+        mouse->Activate();
+        return;
+    }
+
     nuklear->Draw(nuklear->NUKLEAR_STAGE_PRE, WINDOW_GameUI, 1);
     if (nuklear->Mode(WINDOW_GameUI) == nuklear->NUKLEAR_MODE_EXCLUSIVE) {
         nuklear->Draw(nuklear->NUKLEAR_STAGE_POST, WINDOW_GameUI, 1);
@@ -202,10 +236,27 @@ void Engine::drawHUD() {
 
 //----- (0044103C) --------------------------------------------------------
 void Engine::Draw() {
+    Profiler::markFrame(); // Frame boundary is here, so that the zone below is accounted for in the frame it belongs to.
+    MM_PROFILE_ZONE("Engine::Draw");
+
     drawWorld();
     drawHUD();
 
-    render->Present();
+    if (!_worldDrawingSkipped)
+        render->Present();
+
+    trimAssetCaches();
+}
+
+void Engine::trimAssetCaches() {
+    constexpr size_t MiB = 1024 * 1024;
+
+    size_t lodBudget = config->graphics.LodCacheBudget.value() * MiB;
+    pBitmaps_LOD->trim(lodBudget);
+    pSprites_LOD->trim(lodBudget);
+    pIcons_LOD->trim(lodBudget);
+
+    assets->trimImages(config->graphics.ImageCpuBudget.value() * MiB, config->graphics.ImageGpuBudget.value() * MiB);
 }
 
 
@@ -282,8 +333,31 @@ void Engine::DrawGUI() {
             pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
                                      fmt::format("Party Sector ID:       {}/{}\n", sector_id, pIndoor->pSectors.size()));
             debug_info_offset += 16;
+
+            DetectionCacheStats detectionStats = detectionCacheStats();
+            pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
+                                     fmt::format("Detection cache:       {} hits, {} misses\n", detectionStats.hits, detectionStats.misses));
+            debug_info_offset += 16;
+
+            pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
+                                     fmt::format("PVS sectors:           {}/{}\n", pIndoor->pvs.visibleCount(sector_id), pIndoor->pvs.sectorCount()));
+            debug_info_offset += 16;
         }
 
+        CacheUsage imageUsage = assets->imageUsage();
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
+                                 fmt::format("Images:                {} / {} MiB CPU, {} MiB GPU\n", imageUsage.entries,
+                                             imageUsage.cpuBytes >> 20, imageUsage.gpuBytes >> 20));
+        debug_info_offset += 16;
+
+        CacheUsage bitmapsUsage = pBitmaps_LOD->usage();
+        CacheUsage spritesUsage = pSprites_LOD->usage();
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
+                                 fmt::format("LOD caches:            {} / {} MiB bitmaps, {} / {} MiB sprites\n",
+                                             bitmapsUsage.entries, bitmapsUsage.cpuBytes >> 20,
+                                             spritesUsage.entries, spritesUsage.cpuBytes >> 20));
+        debug_info_offset += 16;
+
         std::string floor_level_str;
 
         if (uGameState == GAME_STATE_CHANGE_LOCATION) {
@@ -308,6 +382,19 @@ void Engine::DrawGUI() {
 
         pPrimaryWindow->DrawText(assets->pFontArrus.get(), {16, debug_info_offset}, colorTable.White, floor_level_str);
     }
+
+    if (engine->config->debug.ShowProfiler.value()) {
+        int profiler_offset = 16;
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), {330, profiler_offset}, colorTable.White, "Zone                                ms/frame   calls/frame");
+        profiler_offset += 16;
+
+        std::vector<ProfilerZoneStats> zones = Profiler::frameStats();
+        for (size_t i = 0; i < zones.size() && i < 16; i++) {
+            pPrimaryWindow->DrawText(assets->pFontArrus.get(), {330, profiler_offset}, colorTable.White,
+                                     fmt::format("{:<36} {:8.2f} {:10.1f}", zones[i].name, zones[i].ms, zones[i].calls));
+            profiler_offset += 16;
+        }
+    }
 }
 
 //----- (0047A815) --------------------------------------------------------
@@ -479,6 +566,10 @@ Engine::Engine(std::shared_ptr<GameConfig> config) {
     this->mouse = EngineIocContainer::ResolveMouse();
     this->nuklear = EngineIocContainer::ResolveNuklear();
     this->particle_engine = EngineIocContainer::ResolveParticleEngine();
+    this->particle_engine->setCapacity(config->graphics.ParticleCapacity.value());
+    config->graphics.ParticleCapacity.addListener([particleEngine = this->particle_engine, config = config.get()] {
+        particleEngine->setCapacity(config->graphics.ParticleCapacity.value());
+    });
     this->vis = EngineIocContainer::ResolveVis();
 
     uNumStationaryLights_in_pStationaryLightsStack = 0;
@@ -566,6 +657,8 @@ void PlayButtonClickSound() {
 
 //----- (0046BDC0) --------------------------------------------------------
 void UpdateUserInput_and_MapSpecificStuff() {
+    MM_PROFILE_ZONE("UpdateUserInput_and_MapSpecificStuff");
+
     if (dword_6BE364_game_settings_1 & GAME_SETTINGS_0080_SKIP_USER_INPUT_THIS_FRAME) {
         dword_6BE364_game_settings_1 &= ~GAME_SETTINGS_0080_SKIP_USER_INPUT_THIS_FRAME;
         return;
@@ -610,6 +703,7 @@ void DoPrepareWorld(bool bLoading, int _1_fullscreen_loading_2_box) {
     std::string mapExt = pCurrentMapName.substr(pos + 1);  // This magically works even when pos == std::string::npos, in this case
                                                       // maxExt == pCurrentMapName.
 
+    beginMapAssetCapture(mapName);
     Level_LoadEvtAndStr(mapName);
 
     v5 = pMapStats->GetMapInfo(pCurrentMapName);
@@ -688,6 +782,8 @@ void MM7_LoadLods() {
 
 //----- (004651F4) --------------------------------------------------------
 void Engine::MM7_Initialize() {
+    int64_t startNs = Profiler::now();
+
     grng->seed(platform->tickCount());
     vrng->seed(platform->tickCount());
 
@@ -708,9 +804,6 @@ void Engine::MM7_Initialize() {
 
     MM7_LoadLods();
 
-    localization = new Localization();
-    localization->Initialize();
-
     auto triLoad = [](const std::string &name) {
         TriBlob result;
         result.mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture(name) : Blob();
@@ -718,43 +811,40 @@ void Engine::MM7_Initialize() {
         return result;
     };
 
+    localization = new Localization();
     pSpriteFrameTable = new SpriteFrameTable;
-    deserialize(triLoad("dsft.bin"), pSpriteFrameTable);
-
     pTextureFrameTable = new TextureFrameTable;
-    deserialize(triLoad("dtft.bin"), pTextureFrameTable);
-
     pTileTable = new TileTable;
-    deserialize(triLoad("dtile.bin"), pTileTable);
-
     pPlayerFrameTable = new PlayerFrameTable;
-    deserialize(triLoad("dpft.bin"), pPlayerFrameTable);
-
     pIconsFrameTable = new IconFrameTable;
-    deserialize(triLoad("dift.bin"), pIconsFrameTable);
-
     pDecorationList = new DecorationList;
-    deserialize(triLoad("ddeclist.bin"), pDecorationList);
-
     pObjectList = new ObjectList;
-    deserialize(triLoad("dobjlist.bin"), pObjectList);
-
     pMonsterList = new MonsterList;
-    deserialize(triLoad("dmonlist.bin"), pMonsterList);
-
     pChestList = new ChestDescList;
-    deserialize(triLoad("dchest.bin"), pChestList);
-
     pOverlayList = new OverlayList;
-    deserialize(triLoad("doverlay.bin"), pOverlayList);
-
-    // TODO(captainurist): move to TableSnapshots.h/cpp
-    Blob sounds_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dsounds.bin") : Blob();
-    Blob sounds_mm8;
-    Blob sounds_mm7 = engine->_gameResourceManager->getEventsFile("dsounds.bin");
-
     pSoundList = new SoundList;
-    pSoundList->FromFile(sounds_mm6, sounds_mm7, sounds_mm8);
+
+    // All of these are independent.
+    TaskGraph graph;
+    graph.add([] { localization->Initialize(); });
+    graph.add([&] { deserialize(triLoad("dsft.bin"), pSpriteFrameTable); });
+    graph.add([&] { deserialize(triLoad("dtft.bin"), pTextureFrameTable); });
+    graph.add([&] { deserialize(triLoad("dtile.bin"), pTileTable); });
+    graph.add([&] { deserialize(triLoad("dpft.bin"), pPlayerFrameTable); });
+    graph.add([&] { deserialize(triLoad("dift.bin"), pIconsFrameTable); });
+    graph.add([&] { deserialize(triLoad("ddeclist.bin"), pDecorationList); });
+    graph.add([&] { deserialize(triLoad("dobjlist.bin"), pObjectList); });
+    graph.add([&] { deserialize(triLoad("dmonlist.bin"), pMonsterList); });
+    graph.add([&] { deserialize(triLoad("dchest.bin"), pChestList); });
+    graph.add([&] { deserialize(triLoad("doverlay.bin"), pOverlayList); });
+    graph.add([] {
+        // TODO(captainurist): move to TableSnapshots.h/cpp
+        Blob sounds_mm6 = pIcons_LOD_mm6 ? pIcons_LOD_mm6->LoadCompressedTexture("dsounds.bin") : Blob();
+        Blob sounds_mm8;
+        Blob sounds_mm7 = engine->_gameResourceManager->getEventsFile("dsounds.bin");
+        pSoundList->FromFile(sounds_mm6, sounds_mm7, sounds_mm8);
+    });
+    graph.run(&ThreadPool::shared());
 
     if (!config->debug.NoSound.value())
         pAudioPlayer->Initialize();
@@ -763,77 +853,87 @@ void Engine::MM7_Initialize() {
     pMediaPlayer->Initialize();
 
     dword_6BE364_game_settings_1 |= GAME_SETTINGS_4000;
+
+    logger->info("Primary initialization took {} ms.", (Profiler::now() - startNs) / 1'000'000);
 }
 
 //----- (00465D0B) --------------------------------------------------------
 void Engine::SecondaryInitialization() {
+    int64_t startNs = Profiler::now();
+
     mouse->Initialize();
 
+    GameResourceManager *resources = engine->_gameResourceManager.get();
     pMapStats = new MapStats();
-    pMapStats->Initialize(engine->_gameResourceManager->getEventsFile("MapStats.txt"));
-
     pMonsterStats = new MonsterStats();
-    pMonsterStats->Initialize(engine->_gameResourceManager->getEventsFile("monsters.txt"));
-    pMonsterStats->InitializePlacements(engine->_gameResourceManager->getEventsFile("placemon.txt"));
-
     pSpellStats = new SpellStats();
-    pSpellStats->Initialize(engine->_gameResourceManager->getEventsFile("spells.txt"));
-
     pFactionTable = new FactionTable();
-    pFactionTable->Initialize(engine->_gameResourceManager->getEventsFile("hostile.txt"));
-
     pStorylineText = new StorylineText();
-    pStorylineText->Initialize(engine->_gameResourceManager->getEventsFile("history.txt"));
-
     pItemTable = new ItemTable();
-    pItemTable->Initialize(engine->_gameResourceManager.get());
-
-    initializeBuildings(engine->_gameResourceManager->getEventsFile("2dEvents.txt"));
-
-    //pPaletteManager->SetMistColor(128, 128, 128);
-    //pPaletteManager->RecalculateAll();
-    pObjectList->InitializeSprites();
-    pOverlayList->InitializeSprites();
-
-    for (unsigned i = 0; i < 4; ++i) {
-        static const char *pUIAnimNames[4] = {"glow03", "glow05", "torchA", "wizeyeA"};
-        static unsigned short _4E98D0[4][4] = { {479, 0, 329, 0}, {585, 0, 332, 0}, {468, 0, 0, 0}, {606, 0, 0, 0} };
-
-        // pUIAnims[i]->uIconID = pIconsFrameTable->FindIcon(pUIAnimNames[i]);
-        pUIAnims[i]->icon = pIconsFrameTable->GetIcon(pUIAnimNames[i]);
-
-        pUIAnims[i]->uAnimLength = 0_ticks;
-        pUIAnims[i]->uAnimTime = 0;
-        pUIAnims[i]->x = _4E98D0[i][0];
-        pUIAnims[i]->y = _4E98D0[i][2];
-    }
-
-    // TODO(pskelton): dropping this causes std::bad_alloc in headless mode
-    UI_Create();
+    pNPCStats = new NPCStats();
 
-    spell_fx_renedrer->LoadAnimations();
+    // Table loaders run on the thread pool. Sprite & UI initialization goes through the asset caches, the palette
+    // manager and the renderer, so it stays on the main thread, running while the tables are loaded.
+    TaskGraph graph;
+    graph.add([=] { pMapStats->Initialize(resources->getEventsFile("MapStats.txt")); });
+    int monsters = graph.add([=] { pMonsterStats->Initialize(resources->getEventsFile("monsters.txt")); });
+    graph.add([=] { pMonsterStats->InitializePlacements(resources->getEventsFile("placemon.txt")); }, {monsters});
+    graph.add([=] { pSpellStats->Initialize(resources->getEventsFile("spells.txt")); });
+    graph.add([=] { pFactionTable->Initialize(resources->getEventsFile("hostile.txt")); });
+    graph.add([=] { pStorylineText->Initialize(resources->getEventsFile("history.txt")); });
+    graph.add([=] { pItemTable->Initialize(resources); });
+    graph.add([=] { initializeBuildings(resources->getEventsFile("2dEvents.txt")); });
+    graph.add([=] { pNPCStats->Initialize(resources); });
+    graph.add([=] { initializeQuests(resources->getEventsFile("quests.txt")); });
+    graph.add([=] { initializeAutonotes(resources->getEventsFile("autonote.txt")); });
+    graph.add([=] { initializeAwards(resources->getEventsFile("awards.txt")); });
+    graph.add([=] { initializeTransitions(resources->getEventsFile("trans.txt")); });
+    graph.add([=] { initializeMerchants(resources->getEventsFile("merchant.txt")); });
+    graph.add([=] { initializeMessageScrolls(resources->getEventsFile("scroll.txt")); });
+    graph.add([=] { engine->_globalEventMap = EventMap::load(resources->getEventsFile("global.evt")); });
+
+    int sprites = graph.add([] {
+        //pPaletteManager->SetMistColor(128, 128, 128);
+        //pPaletteManager->RecalculateAll();
+        pObjectList->InitializeSprites();
+        pOverlayList->InitializeSprites();
+    }, {}, TASK_MAIN_THREAD);
+
+    graph.add([this] {
+        for (unsigned i = 0; i < 4; ++i) {
+            static const char *pUIAnimNames[4] = {"glow03", "glow05", "torchA", "wizeyeA"};
+            static unsigned short _4E98D0[4][4] = {
+                {479, 0, 329, 0}, {585, 0, 332, 0}, {468, 0, 0, 0}, {606, 0, 0, 0}
+            };
+
+            // pUIAnims[i]->uIconID = pIconsFrameTable->FindIcon(pUIAnimNames[i]);
+            pUIAnims[i]->icon = pIconsFrameTable->GetIcon(pUIAnimNames[i]);
+
+            pUIAnims[i]->uAnimLength = 0_ticks;
+            pUIAnims[i]->uAnimTime = 0;
+            pUIAnims[i]->x = _4E98D0[i][0];
+            pUIAnims[i]->y = _4E98D0[i][2];
+        }
 
-    for (unsigned i = 0; i < 7; ++i) {
-        std::string container_name = fmt::format("HDWTR{:03}", i);
-        render->hd_water_tile_anim[i] = assets->getBitmap(container_name);
-    }
+        // TODO(pskelton): dropping this causes std::bad_alloc in headless mode
+        UI_Create();
 
-    pNPCStats = new NPCStats();
-    pNPCStats->Initialize(engine->_gameResourceManager.get());
+        spell_fx_renedrer->LoadAnimations();
 
-    initializeQuests(engine->_gameResourceManager->getEventsFile("quests.txt"));
-    initializeAutonotes(engine->_gameResourceManager->getEventsFile("autonote.txt"));
-    initializeAwards(engine->_gameResourceManager->getEventsFile("awards.txt"));
-    initializeTransitions(engine->_gameResourceManager->getEventsFile("trans.txt"));
-    initializeMerchants(engine->_gameResourceManager->getEventsFile("merchant.txt"));
-    initializeMessageScrolls(engine->_gameResourceManager->getEventsFile("scroll.txt"));
+        for (unsigned i = 0; i < 7; ++i) {
+            std::string container_name = fmt::format("HDWTR{:03}", i);
+            render->hd_water_tile_anim[i] = assets->getBitmap(container_name);
+        }
+    }, {sprites}, TASK_MAIN_THREAD);
 
-    engine->_globalEventMap = EventMap::load(engine->_gameResourceManager->getEventsFile("global.evt"));
+    graph.run(&ThreadPool::shared());
 
     pBitmaps_LOD->reserveLoadedTextures();
     pSprites_LOD->reserveLoadedSprites();
 
     Initialize_GamesLOD_NewLOD();
+
+    logger->info("Secondary initialization took {} ms.", (Profiler::now() - startNs) / 1'000'000);
 }
 
 void Engine::Initialize() {
@@ -936,6 +1036,8 @@ void Engine::ResetCursor_Palettes_LODs_Level_Audio_SFT_Windows() {
     // Render billboards are used in hit tests, but we're releasing textures, so can't use them anymore.
     render->uNumBillboardsToDraw = 0;
 
+    finishMapAssetCapture();
+
     pBitmaps_LOD->releaseUnreserved();
     pSprites_LOD->releaseUnreserved();
     pIcons_LOD->releaseUnreserved();
@@ -1074,7 +1176,7 @@ void InitializeTurnBasedAnimations(void *_this) {
 
 //----- (0046BDA8) --------------------------------------------------------
 unsigned int GetGravityStrength() {
-    return engine->config->gameplay.Gravity.value();
+    return engine->config->snapshot().gravity;
 }
 
 void sub_44861E_set_texture_indoor(unsigned int uFaceCog,
@@ -90,6 +90,12 @@ class Engine {
     void StackPartyTorchLight();
     void DrawParticles();
     void Draw();
+
+    /**
+     * Evicts the least recently used images from the asset caches so that they fit into the memory budgets set in
+     * the graphics config.
+     */
+    void trimAssetCaches();
     void drawWorld();
     void drawHUD();
     void DrawGUI();
@@ -105,9 +111,21 @@ class Engine {
     inline bool IsFog() const { return is_fog; }
     inline void SetFog(bool is_fog) { this->is_fog = is_fog; } // fog off rather than on??
 
+    /**
+     * @param skipped                   Whether `Draw` should skip drawing the 3D world and the HUD. Game state updates
+     *                                  done by the drawing code - camera & party view, lights, fog, trail particles,
+     *                                  portrait animations and windows - still run, but level geometry, billboards,
+     *                                  decals, particles and the HUD are not drawn, and the frame is not presented.
+     *                                  Note that mouse & keyboard picking use the render lists built when drawing the
+     *                                  world, so these will be stale until the world is drawn again.
+     */
+    inline void setWorldDrawingSkipped(bool skipped) { _worldDrawingSkipped = skipped; }
+    inline bool isWorldDrawingSkipped() const { return _worldDrawingSkipped; }
+
     bool is_underwater = false;
     bool is_saturate_faces = false;
     bool is_fog = false; // keeps track of whether fog enabled in d3d
+    bool _worldDrawingSkipped = false;
 
     std::shared_ptr<GameConfig> config;
     int uNumStationaryLights_in_pStationaryLightsStack;
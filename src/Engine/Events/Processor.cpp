@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <tuple>
 #include <vector>
 
 #include "Engine/Engine.h"
@@ -16,6 +18,7 @@
 
 #include "GUI/UI/UIStatusBar.h"
 
+#include "Library/Geometry/TriggerVolumes.h"
 #include "Library/Logger/Logger.h"
 
 struct MapTimer {
@@ -34,6 +37,12 @@ static std::vector<MapTimer> onLongTimerTriggers;
 static std::vector<MapTimer> onTimerTriggers;
 
 static std::vector<int> decorationsWithEvents;
+static TriggerVolumes decorationTriggerVolumes; // Volume id is an index into decorationsWithEvents.
+static TriggerVolumeTracker partyTriggerTracker;
+static TriggerVolumeTracker actorTriggerTracker;
+static TriggerVolumeTracker spriteObjectTriggerTracker;
+static bool hasActorTriggeredDecorations = false;
+static bool hasSpriteObjectTriggeredDecorations = false;
 
 // Was in original code and ensures that timers are checked not more often than 30 game seconds.
 // Do not needed in practice but can be considered optimization to avoid checking timers too often.
@@ -47,38 +56,91 @@ void initDecorationEvents() {
     int id = pDecorationList->GetDecorIdByName("Event Trigger");
 
     decorationsWithEvents.clear();
+    decorationTriggerVolumes.clear();
+    hasActorTriggeredDecorations = false;
+    hasSpriteObjectTriggeredDecorations = false;
     for (int i = 0; i < pLevelDecorations.size(); ++i) {
         if (pLevelDecorations[i].uDecorationDescID == id) {
             decorationsWithEvents.push_back(i);
+            decorationTriggerVolumes.add(pLevelDecorations[i].vPosition, pLevelDecorations[i].uTriggerRange);
+            if (pLevelDecorations[i].uFlags & LEVEL_DECORATION_TRIGGERED_BY_MONSTER)
+                hasActorTriggeredDecorations = true;
+            if (pLevelDecorations[i].uFlags & LEVEL_DECORATION_TRIGGERED_BY_OBJECT)
+                hasSpriteObjectTriggeredDecorations = true;
         }
     }
 }
 
 void checkDecorationEvents() {
-    for (int decorationId : decorationsWithEvents) {
-        const LevelDecoration &decoration = pLevelDecorations[decorationId];
+    if (decorationTriggerVolumes.empty())
+        return;
 
-        if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_TOUCH) {
-            if ((decoration.vPosition - pParty->pos.toInt()).length() < decoration.uTriggerRange) {
-                eventProcessor(decoration.uEventID, Pid(OBJECT_Decoration, decorationId), 1);
-            }
+    // Trigger volumes that an entity is inside of are only recomputed when it moves, see TriggerVolumeTracker.
+    // Events are then fired in the same order as a loop over all decorations & all entities would fire them: by
+    // decoration, then party, actors and sprite objects, each in index order.
+    //
+    // Events can move entities around, so just like in a loop over all decorations & all entities, a trigger is
+    // re-checked against the current entity position right before firing, and is dropped if the entity is no longer
+    // inside the volume. The one difference is that an entity that was moved into a volume by an event fired earlier
+    // in the same frame triggers it on the next frame, and not right away.
+    struct DecorationTrigger {
+        int volumeId;
+        int entityKind;
+        int entityId;
+
+        bool operator<(const DecorationTrigger &other) const {
+            return std::tie(volumeId, entityKind, entityId) <
+                   std::tie(other.volumeId, other.entityKind, other.entityId);
         }
+    };
+    static std::vector<DecorationTrigger> triggers;
+    triggers.clear();
+
+    for (int volumeId : partyTriggerTracker.update(decorationTriggerVolumes, 0, pParty->pos.toInt()))
+        if (pLevelDecorations[decorationsWithEvents[volumeId]].uFlags & LEVEL_DECORATION_TRIGGERED_BY_TOUCH)
+            triggers.push_back({volumeId, 0, 0});
+
+    // Most maps don't have decorations triggered by actors or sprite objects, no point in tracking these.
+    if (hasActorTriggeredDecorations) {
+        actorTriggerTracker.truncate(pActors.size());
+        for (int i = 0; i < pActors.size(); i++)
+            for (int volumeId : actorTriggerTracker.update(decorationTriggerVolumes, i, pActors[i].pos))
+                if (pLevelDecorations[decorationsWithEvents[volumeId]].uFlags & LEVEL_DECORATION_TRIGGERED_BY_MONSTER)
+                    triggers.push_back({volumeId, 1, i});
+    }
 
-        if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_MONSTER) {
-            for (int i = 0; i < pActors.size(); i++) {
-                if ((decoration.vPosition - pActors[i].pos).length() < decoration.uTriggerRange) {
-                    eventProcessor(decoration.uEventID, Pid(), 1);
-                }
-            }
-        }
+    if (hasSpriteObjectTriggeredDecorations) {
+        spriteObjectTriggerTracker.truncate(pSpriteObjects.size());
+        for (int i = 0; i < pSpriteObjects.size(); i++)
+            for (int volumeId :
+                 spriteObjectTriggerTracker.update(decorationTriggerVolumes, i, pSpriteObjects[i].vPosition))
+                if (pLevelDecorations[decorationsWithEvents[volumeId]].uFlags & LEVEL_DECORATION_TRIGGERED_BY_OBJECT)
+                    triggers.push_back({volumeId, 2, i});
+    }
 
-        if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_OBJECT) {
-            for (int i = 0; i < pSpriteObjects.size(); i++) {
-                if ((decoration.vPosition - pSpriteObjects[i].vPosition).length() < decoration.uTriggerRange) {
-                    eventProcessor(decoration.uEventID, Pid(), 1);
-                }
-            }
+    std::sort(triggers.begin(), triggers.end());
+
+    int revision = decorationTriggerVolumes.revision();
+    for (const DecorationTrigger &trigger : triggers) {
+        if (decorationTriggerVolumes.revision() != revision)
+            break; // Level was reloaded by one of the events.
+
+        bool inside = false;
+        if (trigger.entityKind == 0) {
+            inside = decorationTriggerVolumes.contains(trigger.volumeId, pParty->pos.toInt());
+        } else if (trigger.entityKind == 1) {
+            inside = trigger.entityId < pActors.size() &&
+                     decorationTriggerVolumes.contains(trigger.volumeId, pActors[trigger.entityId].pos);
+        } else {
+            inside = trigger.entityId < pSpriteObjects.size() &&
+                     decorationTriggerVolumes.contains(trigger.volumeId, pSpriteObjects[trigger.entityId].vPosition);
         }
+        if (!inside)
+            continue;
+
+        int decorationId = decorationsWithEvents[trigger.volumeId];
+        const LevelDecoration &decoration = pLevelDecorations[decorationId];
+        eventProcessor(decoration.uEventID, trigger.entityKind == 0 ? Pid(OBJECT_Decoration, decorationId) : Pid(), 1);
     }
 }
 
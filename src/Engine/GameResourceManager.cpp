@@ -1,6 +1,7 @@
 #include "Engine/GameResourceManager.h"
 
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/DataPath.h"
 
@@ -16,5 +17,7 @@ void GameResourceManager::openGameResources() {
 }
 
 Blob GameResourceManager::getEventsFile(const std::string &filename) {
-    return lod::decodeCompressed(_eventsLodReader.read(filename));
+    MM_PROFILE_ZONE("GameResourceManager::getEventsFile");
+
+    return lod::decodeCompressed(_eventsLodReader.read(filename)); // LodReader is thread-safe for reading.
 }
@@ -14,6 +14,10 @@ class GameResourceManager {
 
     void openGameResources();
 
+    /**
+     * @param filename                  Name of the file in the events LOD.
+     * @return                          Decompressed file contents. This method is thread-safe.
+     */
     Blob getEventsFile(const std::string &filename);
 
  private:
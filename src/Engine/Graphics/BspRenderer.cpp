@@ -4,7 +4,7 @@
 #include "Engine/Graphics/PortalFunctions.h"
 #include "Engine/Engine.h"
 
-#include "Library/Logger/Logger.h"
+#include "Library/Profiler/Profiler.h"
 
 BspRenderer *pBspRenderer = new BspRenderer();
 
@@ -13,19 +13,21 @@ void BspRenderer::AddFaceToRenderList_d3d(int node_id, int uFaceID) {
     int pTransitionSector;  // ax@11
     // int dotdist;                              // edx@15
 
+    // Nothing holds pointers into `nodes` across this call, so it's safe to grow it here.
+    if (num_nodes + 1 >= nodes.size())
+        nodes.resize(nodes.size() * 2);
+
     nodes[num_nodes].viewing_portal_id = -1;
 
     if (uFaceID >= pIndoor->pFaces.size()) return;
     BLVFace *pFace = &pIndoor->pFaces[uFaceID];
 
     if (!pFace->isPortal()) {
-        if (num_faces < 1500) {
-            // add face and return
-            faces[num_faces].uFaceID = uFaceID;
-            faces[num_faces++].uNodeID = node_id;
-        } else {
-            logger->info("Too many faces in BLV render");
-        }
+        // add face and return
+        if (num_faces >= faces.size())
+            faces.resize(faces.size() * 2);
+        faces[num_faces].uFaceID = uFaceID;
+        faces[num_faces++].uNodeID = node_id;
         return;
     }
 
@@ -57,6 +59,14 @@ void BspRenderer::AddFaceToRenderList_d3d(int node_id, int uFaceID) {
         AddBspNodeToRenderList(++num_nodes - 1);
         return;
     }
+
+    // skip portals leading into sectors that can never be seen from the party sector
+    pTransitionSector = pFace->uSectorID;
+    if (nodes[node_id].uSectorID == pTransitionSector)
+        pTransitionSector = pFace->uBackSectorID;
+    if (!pIndoor->pvs.isVisible(nodes[0].uSectorID, pTransitionSector))
+        return;
+
     // check if portal is visible on screen
 
     static RenderVertexSoft static_subAddFaceToRenderList_d3d_stru_F7AA08[64];
@@ -78,9 +88,6 @@ void BspRenderer::AddFaceToRenderList_d3d(int node_id, int uFaceID) {
 
     if (pNewNumVertices) {
         // current portal visible through previous
-        pTransitionSector = pFace->uSectorID;
-        if (nodes[node_id].uSectorID == pTransitionSector)
-            pTransitionSector = pFace->uBackSectorID;
         nodes[num_nodes].uSectorID = pTransitionSector;
         nodes[num_nodes].uFaceID = uFaceID;
 
@@ -100,7 +107,6 @@ void BspRenderer::AddFaceToRenderList_d3d(int node_id, int uFaceID) {
 
         if (bFrustumbuilt) {
             // add portal sector to drawing list
-            assert(num_nodes < 150);
             nodes[num_nodes].viewing_portal_id = uFaceID;
             AddBspNodeToRenderList(++num_nodes - 1);
         }
@@ -137,6 +143,8 @@ void BspRenderer::MakeVisibleSectorList() {
 
 //----- (0043F953) --------------------------------------------------------
 void PrepareBspRenderList_BLV() {
+    MM_PROFILE_ZONE("PrepareBspRenderList_BLV");
+
     // reset faces list
     pBspRenderer->num_faces = 0;
 
@@ -185,10 +193,11 @@ void AddNodeBSPFaces(int node_id, int uFirstNode) {
     int v8;                   // ebx@10
     int v9;               // di@18
 
-    BspRenderer_ViewportNode *node = &pBspRenderer->nodes[node_id];
+    // Not holding a pointer to the node here, nodes can be reallocated by the recursive calls below.
+    int uSectorID = pBspRenderer->nodes[node_id].uSectorID;
 
     while (1) {
-        pSector = &pIndoor->pSectors[node->uSectorID];
+        pSector = &pIndoor->pSectors[uSectorID];
         pNode = &pIndoor->pNodes[uFirstNode];
         pFace = &pIndoor->pFaces[pSector->pFaceIDs[pNode->uBSPFaceIDOffset]];
         // check if we are in front or behind face
@@ -196,7 +205,7 @@ void AddNodeBSPFaces(int node_id, int uFirstNode) {
              pCamera3D->vCameraPos.x * pFace->facePlane.normal.x +
              pCamera3D->vCameraPos.y * pFace->facePlane.normal.y +
              pCamera3D->vCameraPos.z * pFace->facePlane.normal.z;  // plane equation
-        if (pFace->isPortal() && pFace->uSectorID != node->uSectorID) v5 = -v5;
+        if (pFace->isPortal() && pFace->uSectorID != uSectorID) v5 = -v5;
 
         if (v5 <= 0)
             v6 = pNode->uFront;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include "Engine/Graphics/Camera.h"
 
@@ -23,11 +24,12 @@ struct BspRenderer {
     void AddFaceToRenderList_d3d(int node_id, int uFaceID);
     void MakeVisibleSectorList();
 
+    // Both lists grow as needed. Only the first `num_faces` / `num_nodes` elements are valid.
     unsigned int num_faces = 0;
-    std::array<BspFace, 1500> faces = {{}};
+    std::vector<BspFace> faces = std::vector<BspFace>(1500);
 
     unsigned int num_nodes = 0;
-    std::array<BspRenderer_ViewportNode, 150> nodes = {{}};
+    std::vector<BspRenderer_ViewportNode> nodes = std::vector<BspRenderer_ViewportNode>(150);
 
     unsigned int uNumVisibleNotEmptySectors = 0;
     std::array<int, 150> pVisibleSectorIDs_toDrawDecorsActorsEtcFrom = {{}};
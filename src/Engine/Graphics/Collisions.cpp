@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "Engine/Events/Processor.h"
 #include "Engine/Graphics/DecorationList.h"
@@ -10,6 +11,7 @@
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Objects/Actor.h"
+#include "Engine/Objects/ObjectGrid.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/TurnEngine/TurnEngine.h"
@@ -434,31 +436,33 @@ void CollideIndoorWithGeometry(bool ignore_ethereal) {
 }
 
 void CollideOutdoorWithModels(bool ignore_ethereal) {
-    for (BSPModel &model : pOutdoor->pBModels) {
+    static std::vector<int> faceIds; // Static to avoid allocations, this is called for every actor on every frame.
+    pOutdoor->faceTree.queryBox(collision_state.bbox, &faceIds);
+
+    for (int id : faceIds) {
+        auto [modelIndex, faceIndex] = pOutdoor->faceTreeRefs[id];
+        BSPModel &model = pOutdoor->pBModels[modelIndex];
         if (!collision_state.bbox.intersects(model.pBoundingBox))
             continue;
 
-        for (ODMFace &mface : model.pFaces) {
-            if (!collision_state.bbox.intersects(mface.pBoundingBox))
-                continue;
+        ODMFace &mface = model.pFaces[faceIndex];
 
-            // TODO: we should really either merge two face classes, or template the functions down the chain call here.
-            BLVFace face;
-            face.facePlane = mface.facePlane;
-            face.uAttributes = mface.uAttributes;
-            face.pBounding = mface.pBoundingBox;
-            face.zCalc = mface.zCalc;
-            face.uPolygonType = mface.uPolygonType;
-            face.uNumVertices = mface.uNumVertices;
-            face.resource = mface.resource;
-            face.pVertexIDs = mface.pVertexIDs.data();
-
-            if (face.Ethereal() || face.isPortal()) // TODO: this doesn't respect ignore_ethereal parameter
-                continue;
+        // TODO: we should really either merge two face classes, or template the functions down the chain call here.
+        BLVFace face;
+        face.facePlane = mface.facePlane;
+        face.uAttributes = mface.uAttributes;
+        face.pBounding = mface.pBoundingBox;
+        face.zCalc = mface.zCalc;
+        face.uPolygonType = mface.uPolygonType;
+        face.uNumVertices = mface.uNumVertices;
+        face.resource = mface.resource;
+        face.pVertexIDs = mface.pVertexIDs.data();
 
-            Pid pid = Pid::odmFace(model.index, mface.index);
-            CollideBodyWithFace(&face, pid, ignore_ethereal, model.index);
-        }
+        if (face.Ethereal() || face.isPortal()) // TODO: this doesn't respect ignore_ethereal parameter
+            continue;
+
+        Pid pid = Pid::odmFace(model.index, mface.index);
+        CollideBodyWithFace(&face, pid, ignore_ethereal, model.index);
     }
 }
 
@@ -533,41 +537,57 @@ bool CollideWithActor(int actor_idx, int override_radius) {
     return CollideWithCylinder(actor->pos.toFloat(), radius, actor->height, Pid(OBJECT_Actor, actor_idx), true);
 }
 
-void _46ED8A_collide_against_sprite_objects(Pid pid) {
-    for (unsigned i = 0; i < pSpriteObjects.size(); ++i) {
-        if (pSpriteObjects[i].uObjectDescID == 0)
-            continue;
+static void collideWithSpriteObject(int id, Pid pid) {
+    if (pSpriteObjects[id].uObjectDescID == 0)
+        return;
 
-        ObjectDesc *object = &pObjectList->pObjects[pSpriteObjects[i].uObjectDescID];
-        if (object->uFlags & OBJECT_DESC_NO_COLLISION)
-            continue;
+    ObjectDesc *object = &pObjectList->pObjects[pSpriteObjects[id].uObjectDescID];
+    if (object->uFlags & OBJECT_DESC_NO_COLLISION)
+        return;
 
-        // This code is very close to what we have in CollideWithCylinder, but factoring out common parts just
-        // seemed not worth it.
+    // This code is very close to what we have in CollideWithCylinder, but factoring out common parts just
+    // seemed not worth it.
 
-        BBoxf bbox = BBoxf::forCylinder(pSpriteObjects[i].vPosition.toFloat(), object->uRadius, object->uHeight);
-        if (!collision_state.bbox.intersects(bbox))
-            continue;
+    BBoxf bbox = BBoxf::forCylinder(pSpriteObjects[id].vPosition.toFloat(), object->uRadius, object->uHeight);
+    if (!collision_state.bbox.intersects(bbox))
+        return;
 
-        float dist_x = pSpriteObjects[i].vPosition.x - collision_state.position_lo.x;
-        float dist_y = pSpriteObjects[i].vPosition.y - collision_state.position_lo.y;
-        float sum_radius = object->uHeight + collision_state.radius_lo;
+    float dist_x = pSpriteObjects[id].vPosition.x - collision_state.position_lo.x;
+    float dist_y = pSpriteObjects[id].vPosition.y - collision_state.position_lo.y;
+    float sum_radius = object->uHeight + collision_state.radius_lo;
 
-        Vec3f dir = collision_state.direction;
-        float closest_dist = dist_x * dir.y - dist_y * dir.x;
-        if (std::abs(closest_dist) > sum_radius)
-            continue;
+    Vec3f dir = collision_state.direction;
+    float closest_dist = dist_x * dir.y - dist_y * dir.x;
+    if (std::abs(closest_dist) > sum_radius)
+        return;
 
-        float dist_dot_dir = dist_x * dir.x + dist_y * dir.y;
-        if (dist_dot_dir <= 0)
-            continue;
+    float dist_dot_dir = dist_x * dir.x + dist_y * dir.y;
+    if (dist_dot_dir <= 0)
+        return;
 
-        float closest_z = collision_state.position_lo.z + dir.z * dist_dot_dir;
-        if (closest_z < bbox.z1 - collision_state.radius_lo || closest_z > bbox.z2 + collision_state.radius_lo)
-            continue;
+    float closest_z = collision_state.position_lo.z + dir.z * dist_dot_dir;
+    if (closest_z < bbox.z1 - collision_state.radius_lo || closest_z > bbox.z2 + collision_state.radius_lo)
+        return;
+
+    if (dist_dot_dir < collision_state.adjusted_move_distance)
+        collideWithActor(id, pid);
+}
 
-        if (dist_dot_dir < collision_state.adjusted_move_distance)
-            collideWithActor(i, pid);
+void _46ED8A_collide_against_sprite_objects(Pid pid) {
+    static std::vector<int> ids;
+    findSpriteObjectsNear(collision_state.bbox, &ids);
+
+    int revision = spriteObjectGridRevision();
+    for (size_t k = 0; k < ids.size(); k++) {
+        collideWithSpriteObject(ids[k], pid);
+
+        // Sprite objects created during the collision are not in the query results. Vanilla code would process
+        // them if they landed after the current one, so we fall back to a linear scan for the rest of the list.
+        if (spriteObjectGridRevision() != revision) {
+            for (unsigned i = ids[k] + 1; i < pSpriteObjects.size(); ++i)
+                collideWithSpriteObject(i, pid);
+            break;
+        }
     }
 }
 
@@ -837,6 +857,7 @@ void ProcessActorCollisionsODM(Actor &actor, bool isFlying) {
 
 void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *faceId, int *faceEvent) {
     constexpr float closestdist = 0.5f; // Closest allowed approach to collision surface - needs adjusting
+    static std::vector<int> actorIds;
 
     collision_state.ignored_face_id = -1;
     collision_state.total_move_distance = 0;
@@ -861,8 +882,9 @@ void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *
             CollideIndoorWithDecorations();
             // TODO(captainurist): why there is no call to _46ED8A_collide_against_sprite_objects?
             //                     See ProcessPartyCollisionsODM.
-            if (!engine->config->gameplay.NoPartyActorCollisions.value()) {
-                for (int k = 0; k < pActors.size(); ++k)
+            if (!engine->config->snapshot().noPartyActorCollisions) {
+                findActorsNear(collision_state.bbox, &actorIds);
+                for (int k : actorIds)
                     CollideWithActor(k, 0);
             }
             if (CollideIndoorWithPortals())
@@ -970,6 +992,7 @@ void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *
 
 void ProcessPartyCollisionsODM(Vec3f *partyNewPos, Vec3f *partyInputSpeed, bool *partyIsOnWater, int *floorFaceId, bool *partyNotOnModel, bool *partyHasHitModel, int *triggerID) {
     constexpr float closestdist = 0.5f;  // Closest allowed approach to collision surface - needs adjusting
+    static std::vector<int> actorIds;
 
     // --(Collisions)-------------------------------------------------------------------
     collision_state.ignored_face_id = -1;
@@ -995,8 +1018,9 @@ void ProcessPartyCollisionsODM(Vec3f *partyNewPos, Vec3f *partyInputSpeed, bool
         CollideOutdoorWithModels(true);
         CollideOutdoorWithDecorations(WorldPosToGridCellX(pParty->pos.x), WorldPosToGridCellY(pParty->pos.y));
         _46ED8A_collide_against_sprite_objects(Pid::character(0));
-        if (!engine->config->gameplay.NoPartyActorCollisions.value()) {
-            for (size_t actor_id = 0; actor_id < pActors.size(); ++actor_id)
+        if (!engine->config->snapshot().noPartyActorCollisions) {
+            findActorsNear(collision_state.bbox, &actorIds);
+            for (int actor_id : actorIds)
                 CollideWithActor(actor_id, 0);
         }
 
@@ -7,6 +7,8 @@
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/AssetsManager.h"
 
+static uint64_t imageUseClock = 0;
+
 GraphicsImage::GraphicsImage(bool lazy_initialization): _lazyInitialization(lazy_initialization) {}
 
 GraphicsImage::~GraphicsImage() = default;
@@ -15,7 +17,9 @@ GraphicsImage *GraphicsImage::Create(RgbaImage image) {
     GraphicsImage *result = new GraphicsImage(false);
     result->_initialized = true;
     result->_rgbaImage = std::move(image);
+    result->_loadedSize = result->_rgbaImage.size();
     result->_renderId = render->CreateTexture(result->_rgbaImage);
+    result->_gpuBytes = result->_rgbaImage.pixels().size_bytes();
     return result;
 }
 
@@ -31,28 +35,37 @@ GraphicsImage *GraphicsImage::Create(std::unique_ptr<ImageLoader> loader) {
 }
 
 ssize_t GraphicsImage::width() {
-    return rgba().width();
+    return size().w;
 }
 
 ssize_t GraphicsImage::height() {
-    return rgba().height();
+    return size().h;
 }
 
 Sizei GraphicsImage::size() {
+    // Image data might have been released by the assets manager, but the size doesn't change on reload.
+    if (!_initialized && _loadedSize.w > 0) {
+        markUsed();
+        return _loadedSize;
+    }
+
     return rgba().size();
 }
 
 RgbaImage &GraphicsImage::rgba() {
+    markUsed();
     LoadImageData();
     return _rgbaImage;
 }
 
 const Palette &GraphicsImage::palette() {
+    markUsed();
     LoadImageData();
     return _palette;
 }
 
 const GrayscaleImage &GraphicsImage::indexed() {
+    markUsed();
     LoadImageData();
     return _indexedImage;
 }
@@ -76,10 +89,15 @@ void GraphicsImage::Release() {
 }
 
 [[nodiscard]] TextureRenderId GraphicsImage::renderId(bool load) {
-    if (load) {
+    markUsed();
+
+    // Note that we don't need the image data if the texture is still there.
+    if (load && !_renderId) {
         LoadImageData();
-        if (!_renderId)
+        if (!_renderId) {
             _renderId = render->CreateTexture(_rgbaImage);
+            _gpuBytes = _rgbaImage.pixels().size_bytes();
+        }
     }
 
     return _renderId;
@@ -91,6 +109,32 @@ void GraphicsImage::releaseRenderId() {
 
     render->DeleteTexture(_renderId);
     _renderId = TextureRenderId();
+    _gpuBytes = 0;
+}
+
+void GraphicsImage::releaseImageData() {
+    if (!_loader || !_initialized)
+        return;
+
+    _initialized = false;
+    _rgbaImage = RgbaImage();
+    _indexedImage = GrayscaleImage();
+}
+
+size_t GraphicsImage::cpuBytes() const {
+    return _rgbaImage.pixels().size_bytes() + _indexedImage.pixels().size_bytes();
+}
+
+size_t GraphicsImage::gpuBytes() const {
+    return _gpuBytes;
+}
+
+uint64_t GraphicsImage::currentUseStamp() {
+    return imageUseClock;
+}
+
+void GraphicsImage::markUsed() {
+    _lastUse = ++imageUseClock;
 }
 
 bool GraphicsImage::LoadImageData() {
@@ -100,8 +144,13 @@ bool GraphicsImage::LoadImageData() {
     _initialized = _loader->Load(&_rgbaImage, &_indexedImage, &_palette);
     // TODO(captainurist): _initialized == false happens, investigate
 
-    if (_initialized)
-        _renderId = render->CreateTexture(_rgbaImage);
+    if (_initialized) {
+        _loadedSize = _rgbaImage.size();
+        if (!_renderId) {
+            _renderId = render->CreateTexture(_rgbaImage);
+            _gpuBytes = _rgbaImage.pixels().size_bytes();
+        }
+    }
 
     return _initialized;
 }
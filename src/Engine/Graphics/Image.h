@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <memory>
 
@@ -38,9 +39,40 @@ class GraphicsImage {
     [[nodiscard]] TextureRenderId renderId(bool load = true);
     void releaseRenderId();
 
+    /**
+     * Frees the decoded image data, it will be loaded again on next access. Does nothing for images that were not
+     * created from an `ImageLoader`, as there is no way to reload them.
+     */
+    void releaseImageData();
+
+    /**
+     * @return                          Size of the decoded image data in main memory, in bytes.
+     */
+    [[nodiscard]] size_t cpuBytes() const;
+
+    /**
+     * @return                          Size of the uploaded texture, in bytes.
+     */
+    [[nodiscard]] size_t gpuBytes() const;
+
+    /**
+     * @return                          Use stamp of the last access to the image data or texture of this image.
+     */
+    [[nodiscard]] uint64_t lastUse() const {
+        return _lastUse;
+    }
+
+    /**
+     * @return                          Current value of the use stamp counter. All images accessed after this call
+     *                                  will have `lastUse` greater than the returned value.
+     */
+    [[nodiscard]] static uint64_t currentUseStamp();
+
  protected:
     ~GraphicsImage(); // Call Release() instead.
 
+    void markUsed();
+
  protected:
     bool _lazyInitialization = false;
     bool _initialized = false;
@@ -50,6 +82,9 @@ class GraphicsImage {
     GrayscaleImage _indexedImage;
     Palette _palette;
     TextureRenderId _renderId;
+    Sizei _loadedSize; // Size of the image as of the last load, so that we don't need to reload it just to get the size.
+    size_t _gpuBytes = 0;
+    uint64_t _lastUse = 0;
 
     bool LoadImageData();
 };
@@ -2,7 +2,10 @@
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
 #include <ranges>
+#include <span>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -35,6 +38,7 @@
 #include "Engine/Time/Timer.h"
 #include "Engine/TurnEngine/TurnEngine.h"
 #include "Engine/Localization.h"
+#include "Engine/LodTextureCache.h"
 #include "Engine/MapInfo.h"
 #include "Engine/LOD.h"
 
@@ -46,15 +50,23 @@
 
 #include "Library/Logger/Logger.h"
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/Memory/FreeDeleter.h"
 #include "Utility/Math/TrigLut.h"
 #include "Utility/Math/FixPoint.h"
 #include "Utility/Exception.h"
+#include "Utility/DataPath.h"
 
 IndoorLocation *pIndoor = nullptr;
 BLVRenderParams *pBLVRenderParams = new BLVRenderParams;
 
+// Half-size of the box around the probe point that's checked against sector bounds in `GetSector`.
+static constexpr Vec3i SECTOR_PROBE_HALF_SIZE = Vec3i(5, 5, 64);
+
+// Cell size for `IndoorLocation::sectorGrid`, in map units.
+static constexpr int SECTOR_GRID_CELL_SIZE = 512;
+
 // TODO(captainurist): move to SoundEnums.h?
 static constexpr IndexedArray<SoundId, MAP_FIRST, MAP_LAST> pDoorSoundIDsByLocationID = {
     {MAP_EMERALD_ISLAND,            SOUND_wood_door0101},
@@ -221,6 +233,16 @@ void IndoorLocation::Draw() {
     trail_particle_generator.UpdateParticles();
 }
 
+void IndoorLocation::UpdateWithoutDrawing() {
+    // Game state updates from Draw & PrepareDrawLists_BLV, in the same order.
+    pBLVRenderParams->Reset();
+
+    pMobileLightsStack->uNumLightsActive = 0;
+    engine->StackPartyTorchLight();
+
+    trail_particle_generator.UpdateParticles();
+}
+
 //----- (004C0EF2) --------------------------------------------------------
 void BLVFace::FromODM(ODMFace *face) {
     this->facePlane = face->facePlane;
@@ -275,6 +297,8 @@ void IndoorLocation::Release() {
     this->pDoors.clear();
     this->pLights.clear();
     this->pMapOutlines.clear();
+    this->sectorGrid = BBoxGrid();
+    this->pvs = IndoorPvs();
 
     render->ReleaseBSP();
 
@@ -319,6 +343,29 @@ void IndoorLocation::Load(const std::string &filename, int num_days_played, int
     deserialize(lod::decodeCompressed(pGames_LOD->read(blv_filename)), &location); // read throws if file doesn't exist.
     reconstruct(location, this);
 
+    // Face textures are decoded lazily on first draw, start decoding them in the background right away. Animated faces
+    // draw textures from the texture frame table instead, and invisible faces aren't drawn at all.
+    std::vector<std::string> textureNames;
+    for (BLVFace &face : pFaces)
+        if (face.Visible() && !face.IsTextureFrameTable())
+            textureNames.push_back(*face.GetTexture()->GetName());
+    pBitmaps_LOD->prefetch(textureNames);
+
+    // Sector 0 is a dummy, so it gets an empty box. The rest are expanded by the XY half-size of the probe box used in
+    // sector lookup, so that grid cells don't miss sectors that the probe only touches.
+    std::vector<BBoxi> sectorBoxes(pSectors.size());
+    for (size_t i = 1; i < pSectors.size(); i++) {
+        sectorBoxes[i] = pSectors[i].pBounding;
+        sectorBoxes[i].x1 -= SECTOR_PROBE_HALF_SIZE.x;
+        sectorBoxes[i].x2 += SECTOR_PROBE_HALF_SIZE.x;
+        sectorBoxes[i].y1 -= SECTOR_PROBE_HALF_SIZE.y;
+        sectorBoxes[i].y2 += SECTOR_PROBE_HALF_SIZE.y;
+    }
+    if (!sectorBoxes.empty())
+        sectorBoxes[0].x1 = sectorBoxes[0].x2 + 1;
+    sectorGrid = BBoxGrid(sectorBoxes, SECTOR_GRID_CELL_SIZE);
+    invalidateDetectionCache();
+
     std::string dlv_filename = filename;
     dlv_filename.replace(dlv_filename.length() - 4, 4, ".dlv");
 
@@ -367,21 +414,27 @@ void IndoorLocation::Load(const std::string &filename, int num_days_played, int
 
     reconstruct(delta, this);
 
+    // Door data comes from the delta, so this has to be done after it's loaded.
+    std::string pvs_filename = blv_filename;
+    pvs_filename.replace(pvs_filename.length() - 4, 4, ".pvs");
+    pvs = IndoorPvs::load(*this, makeDataPath("data", pvs_filename));
+
     if (respawnTimed || respawnInitial)
         dlv.lastRespawnDay = num_days_played;
     if (respawnTimed)
         dlv.respawnCount++;
 }
 
-//----- (0049AC17) --------------------------------------------------------
-int IndoorLocation::GetSector(int sX, int sY, int sZ) {
-    if (uCurrentlyLoadedLevelType != LEVEL_INDOOR)
-        return 0;
-
-    if (pSectors.size() < 2) {
-        // assert(false);
-        return 0;
-    }
+/**
+ * Sector lookup shared by `IndoorLocation::GetSector` and `IndoorLocation::GetSectorSlow`.
+ *
+ * @param candidates                    Ids of the sectors to check, in ascending order. Must include all the sectors
+ *                                      whose bounding boxes intersect the probe box around (X, Y, Z).
+ */
+static int findSector(IndoorLocation *location, int sX, int sY, int sZ, std::span<const int> candidates) {
+    std::vector<BLVSector> &pSectors = location->pSectors;
+    std::vector<BLVFace> &pFaces = location->pFaces;
+    int floorChecksEps = engine->config->snapshot().floorChecksEps;
 
      // holds faces the coords are above
     int FoundFaceStore[5] = { 0 };
@@ -391,12 +444,12 @@ int IndoorLocation::GetSector(int sX, int sY, int sZ) {
     bool singleSectorFound = false;
 
     // loop through sectors
-    for (unsigned i = 1; i < pSectors.size(); ++i) {
+    for (int i : candidates) {
         if (NumFoundFaceStore >= 5) break;
 
         BLVSector *pSector = &pSectors[i];
 
-        if (!pSector->pBounding.intersectsCuboid(Vec3i(sX, sY, sZ), Vec3i(5, 5, 64)))
+        if (!pSector->pBounding.intersectsCuboid(Vec3i(sX, sY, sZ), SECTOR_PROBE_HALF_SIZE))
             continue;  // outside sector bounding
 
         if (!backupboundingsector) backupboundingsector = i;
@@ -427,7 +480,7 @@ int IndoorLocation::GetSector(int sX, int sY, int sZ) {
                 continue;
 
             // add found faces into store
-            if (pFace->Contains(Vec3i(sX, sY, 0), MODEL_INDOOR, engine->config->gameplay.FloorChecksEps.value(), FACE_XY_PLANE))
+            if (pFace->Contains(Vec3i(sX, sY, 0), MODEL_INDOOR, floorChecksEps, FACE_XY_PLANE))
                 FoundFaceStore[NumFoundFaceStore++] = uFaceID;
             if (NumFoundFaceStore >= 5)
                 break; // TODO(captainurist): we do get here sometimes (e.g. in dragon cave), increase limit?
@@ -436,7 +489,7 @@ int IndoorLocation::GetSector(int sX, int sY, int sZ) {
 
     // only one face found
     if (NumFoundFaceStore == 1)
-        return this->pFaces[FoundFaceStore[0]].uSectorID;
+        return pFaces[FoundFaceStore[0]].uSectorID;
 
     // only one sector found
     if (singleSectorFound) return *foundSector;
@@ -459,19 +512,19 @@ int IndoorLocation::GetSector(int sX, int sY, int sZ) {
         int CalcZDist = MinZDist;
         for (int s = 0; s < NumFoundFaceStore; ++s) {
             // calc distance between this face and party
-            if (this->pFaces[FoundFaceStore[s]].uPolygonType == POLYGON_Floor)
-                CalcZDist = sZ - this->pVertices[*this->pFaces[FoundFaceStore[s]].pVertexIDs].z;
-            if (this->pFaces[FoundFaceStore[s]].uPolygonType == POLYGON_InBetweenFloorAndWall) {
-                CalcZDist = sZ - this->pFaces[FoundFaceStore[s]].zCalc.calculate(sX, sY);
+            if (pFaces[FoundFaceStore[s]].uPolygonType == POLYGON_Floor)
+                CalcZDist = sZ - location->pVertices[*pFaces[FoundFaceStore[s]].pVertexIDs].z;
+            if (pFaces[FoundFaceStore[s]].uPolygonType == POLYGON_InBetweenFloorAndWall) {
+                CalcZDist = sZ - pFaces[FoundFaceStore[s]].zCalc.calculate(sX, sY);
             }
 
             // use this face if its smaller than the current min - prefer faces below party
             if (CalcZDist < MinZDist) {
                 if (CalcZDist >= 0) {
-                    pSectorID = this->pFaces[FoundFaceStore[s]].uSectorID;
+                    pSectorID = pFaces[FoundFaceStore[s]].uSectorID;
                     MinZDist = CalcZDist;
                 } else {
-                    backupID = this->pFaces[FoundFaceStore[s]].uSectorID;
+                    backupID = pFaces[FoundFaceStore[s]].uSectorID;
                     backupDist = std::abs(CalcZDist);
                 }
             }
@@ -480,7 +533,7 @@ int IndoorLocation::GetSector(int sX, int sY, int sZ) {
         if (pSectorID == 0) {
             if (backupID == 0) {
                 assert(false); // doesnt choose - so default to first - SHOULDNT GET HERE
-                pSectorID = this->pFaces[FoundFaceStore[0]].uSectorID;
+                pSectorID = pFaces[FoundFaceStore[0]].uSectorID;
             } else {
                 // there is a face above the party to use
                 pSectorID = backupID;
@@ -491,6 +544,31 @@ int IndoorLocation::GetSector(int sX, int sY, int sZ) {
     return pSectorID;
 }
 
+//----- (0049AC17) --------------------------------------------------------
+int IndoorLocation::GetSector(int sX, int sY, int sZ) {
+    if (uCurrentlyLoadedLevelType != LEVEL_INDOOR)
+        return 0;
+
+    if (pSectors.size() < 2) {
+        // assert(false);
+        return 0;
+    }
+
+    return findSector(this, sX, sY, sZ, sectorGrid.query(sX, sY));
+}
+
+int IndoorLocation::GetSectorSlow(int sX, int sY, int sZ) {
+    if (uCurrentlyLoadedLevelType != LEVEL_INDOOR)
+        return 0;
+
+    if (pSectors.size() < 2)
+        return 0;
+
+    std::vector<int> candidates(pSectors.size() - 1);
+    std::iota(candidates.begin(), candidates.end(), 1);
+    return findSector(this, sX, sY, sZ, candidates);
+}
+
 //----- (00498A41) --------------------------------------------------------
 void BLVFace::_get_normals(Vec3f *outU, Vec3f *outV) {
     // TODO(captainurist): code looks very similar to Camera3D::GetFacetOrientation
@@ -716,7 +794,8 @@ void BLV_UpdateDoors() {
             }
         }
 
-        // adjust verts to how open the door is
+        // adjust verts to how open the door is, this also moves the portals attached to the door
+        invalidateDetectionCache();
         for (int j = 0; j < door->uNumVertices; ++j) {
             pIndoor->pVertices[door->pVertexIDs[j]].x =
                 fixpoint_mul(door->vDirection.x, openDistance) + door->pXOffsets[j];
@@ -779,6 +858,8 @@ void BLV_UpdateDoors() {
 
 //----- (0046F90C) --------------------------------------------------------
 void UpdateActors_BLV() {
+    MM_PROFILE_ZONE("UpdateActors_BLV");
+
     if (engine->config->debug.NoActors.value())
         return;
 
@@ -1010,6 +1091,8 @@ void PrepareToLoadBLV(bool bLoading) {
     // INDOOR initialize actors
     alertStatus = false;
 
+    Actor::prefetchSprites(pActors);
+
     for (unsigned i = 0; i < pActors.size(); ++i) {
         if (pActors[i].attributes & ACTOR_UNKNOW7) {
             if (map_id == MAP_INVALID) {
@@ -1074,6 +1157,7 @@ int BLV_GetFloorLevel(const Vec3i &pos, int uSectorID, int *pFaceID) {
     int blv_floor_id[5] = { 0 };
 
     BLVSector *pSector = &pIndoor->pSectors[uSectorID];
+    int floorChecksEps = engine->config->snapshot().floorChecksEps;
 
     // loop over all floor faces
     for (unsigned i = 0; i < pSector->uNumFloors; ++i) {
@@ -1084,7 +1168,7 @@ int BLV_GetFloorLevel(const Vec3i &pos, int uSectorID, int *pFaceID) {
         if (pFloor->Ethereal())
             continue;
 
-        if (!pFloor->Contains(pos, MODEL_INDOOR, engine->config->gameplay.FloorChecksEps.value(), FACE_XY_PLANE))
+        if (!pFloor->Contains(pos, MODEL_INDOOR, floorChecksEps, FACE_XY_PLANE))
             continue;
 
         // TODO: Does POLYGON_Ceiling really belong here?
@@ -1115,7 +1199,7 @@ int BLV_GetFloorLevel(const Vec3i &pos, int uSectorID, int *pFaceID) {
             if (portal->uPolygonType != POLYGON_Floor)
                 continue;
 
-            if(!portal->Contains(pos, MODEL_INDOOR, engine->config->gameplay.FloorChecksEps.value(), FACE_XY_PLANE))
+            if(!portal->Contains(pos, MODEL_INDOOR, floorChecksEps, FACE_XY_PLANE))
                 continue;
 
             blv_floor_z[FacesFound] = -29000;
@@ -1377,42 +1461,50 @@ bool Check_LOS_Obscurred_Outdoors_Bmodels(const Vec3i &target, const Vec3i &from
 
     BBoxi bbox = BBoxi::forPoints(from, target);
 
-    for (BSPModel &model : pOutdoor->pBModels) {
-        if (CalcDistPointToLine(target.x, target.y, from.x, from.y, model.vPosition.x, model.vPosition.y) <= model.sBoundingRadius + 128) {
-            for (ODMFace &face : model.pFaces) {
-                float dirDotNormal = dot(dir, face.facePlane.normal);
-                bool FaceIsParallel = fuzzyIsNull(dirDotNormal);
-                if (FaceIsParallel)
-                    continue;
+    // Face tree only returns the faces with bounds intersecting the segment bounds, in model order.
+    static std::vector<int> faceIds;
+    pOutdoor->faceTree.queryBox(bbox, &faceIds);
+
+    int lastModelIndex = -1;
+    bool modelInRange = false;
+    for (int id : faceIds) {
+        auto [modelIndex, faceIndex] = pOutdoor->faceTreeRefs[id];
+        BSPModel &model = pOutdoor->pBModels[modelIndex];
+        if (modelIndex != lastModelIndex) {
+            lastModelIndex = modelIndex;
+            modelInRange = CalcDistPointToLine(target.x, target.y, from.x, from.y, model.vPosition.x, model.vPosition.y) <= model.sBoundingRadius + 128;
+        }
+        if (!modelInRange)
+            continue;
 
-                // bounds check
-                if (!bbox.intersects(face.pBoundingBox))
-                    continue;
+        ODMFace &face = model.pFaces[faceIndex];
+        float dirDotNormal = dot(dir, face.facePlane.normal);
+        bool FaceIsParallel = fuzzyIsNull(dirDotNormal);
+        if (FaceIsParallel)
+            continue;
 
-                // point target plane distacne
-                float NegFacePlaceDist = -face.facePlane.signedDistanceTo(target.toFloat());
+        // point target plane distacne
+        float NegFacePlaceDist = -face.facePlane.signedDistanceTo(target.toFloat());
 
-                // are we on same side of plane
-                if (dirDotNormal <= 0) {
-                    // angle obtuse - is target underneath plane
-                    if (NegFacePlaceDist > 0)
-                        continue;  // can never hit
-                } else {
-                    // angle acute - is target above plane
-                    if (NegFacePlaceDist < 0)
-                        continue;  // can never hit
-                }
+        // are we on same side of plane
+        if (dirDotNormal <= 0) {
+            // angle obtuse - is target underneath plane
+            if (NegFacePlaceDist > 0)
+                continue;  // can never hit
+        } else {
+            // angle acute - is target above plane
+            if (NegFacePlaceDist < 0)
+                continue;  // can never hit
+        }
 
-                if (std::abs(NegFacePlaceDist) / 16384.0f <= std::abs(dirDotNormal)) {
-                    // calc how far along line interesction is
-                    float IntersectionDist = NegFacePlaceDist /  dirDotNormal;
-                    // less than zero means intersection is behind target point
-                    if (IntersectionDist >= 0) {
-                        Vec3i pos = target + (IntersectionDist * dir).toInt();
-                        if (face.Contains(pos, model.index)) {
-                            return true;
-                        }
-                    }
+        if (std::abs(NegFacePlaceDist) / 16384.0f <= std::abs(dirDotNormal)) {
+            // calc how far along line interesction is
+            float IntersectionDist = NegFacePlaceDist /  dirDotNormal;
+            // less than zero means intersection is behind target point
+            if (IntersectionDist >= 0) {
+                Vec3i pos = target + (IntersectionDist * dir).toInt();
+                if (face.Contains(pos, model.index)) {
+                    return true;
                 }
             }
         }
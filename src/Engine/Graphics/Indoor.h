@@ -9,7 +9,10 @@
 #include "Engine/EngineIocContainer.h"
 #include "Engine/SpawnPoint.h"
 
+#include "Library/Geometry/BBoxGrid.h"
+
 #include "BSPModel.h"
+#include "IndoorPvs.h"
 #include "LocationInfo.h"
 #include "LocationTime.h"
 #include "LocationFunctions.h"
@@ -209,10 +212,22 @@ struct IndoorLocation {
         return GetSector(pos.x, pos.y, pos.z);
     }
 
+    /**
+     * Same as `GetSector`, but doesn't use `sectorGrid` and checks all the sectors in the level instead. This is
+     * slow, and exists only to check that the grid lookup returns the same results.
+     */
+    int GetSectorSlow(int sX, int sY, int sZ);
+
     void Release();
     void Load(const std::string &filename, int num_days_played, int respawn_interval_days, bool *indoor_was_respawned);
     void Draw();
 
+    /**
+     * Runs the game state updates that `Draw` does - party sector lookup, party torchlight & trail particles -
+     * without drawing anything. Used when world drawing is skipped, see `Engine::setWorldDrawingSkipped`.
+     */
+    void UpdateWithoutDrawing();
+
     /**
      * @offset 0x4488F7
      */
@@ -239,6 +254,8 @@ struct IndoorLocation {
     std::vector<int16_t> ptr_0002B4_doors_ddata;
     std::vector<uint16_t> ptr_0002B8_sector_lrdata;
     std::vector<SpawnPoint> pSpawnPoints;
+    BBoxGrid sectorGrid; // Sector bounding boxes, built on load, used by `GetSector`.
+    IndoorPvs pvs; // Sector-to-sector visibility, loaded or computed on load, used by `BspRenderer`.
     LocationInfo dlv;
     LocationTime stru1;
     std::array<char, 875> _visible_outlines;
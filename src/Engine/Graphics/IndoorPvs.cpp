@@ -0,0 +1,343 @@
+#include "IndoorPvs.h"
+
+#include <cassert>
+#include <algorithm>
+#include <bit>
+#include <exception>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Engine/Graphics/Indoor.h"
+
+#include "Library/Binary/BinarySerialization.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Streams/TempFileOutputStream.h"
+#include "Utility/Memory/Blob.h"
+#include "Utility/Exception.h"
+
+// Bump this when changing the algorithm or the file format, this will invalidate all the cached files.
+static constexpr uint32_t PVS_VERSION = 1;
+
+// Tolerance for the plane side checks. Portal planes are stored in floats and vertices are on an integer grid, so
+// this is pretty generous.
+static constexpr float PVS_EPSILON = 8.0f;
+
+// Max length of a portal chain. Sectors further down a chain are treated as visible.
+static constexpr int PVS_MAX_CHAIN_LENGTH = 128;
+
+// Max number of portal crossings to check per source sector. When exceeded, we fall back to plain connectivity.
+static constexpr int PVS_MAX_STEPS = 20000;
+
+namespace {
+struct PvsPortal {
+    int frontSector = 0; // Sector on the positive side of the portal plane, this is `BLVFace::uSectorID`.
+    int backSector = 0;
+    Planef plane;
+    std::vector<Vec3f> vertices;
+    bool movable = false; // Whether any of the portal vertices can be moved by a door.
+};
+
+struct PvsStep {
+    int portal = 0;
+    float sign = 0; // 1 if crossing into the front sector, -1 if crossing into the back sector.
+};
+
+class PvsBuilder {
+ public:
+    explicit PvsBuilder(const IndoorLocation &location) : _sectorPortals(location.pSectors.size()) {
+        std::unordered_set<int> doorVertices;
+        std::unordered_set<int> doorFaces;
+        for (const BLVDoor &door : location.pDoors) {
+            for (int i = 0; i < door.uNumVertices; i++)
+                doorVertices.insert(door.pVertexIDs[i]);
+            for (int i = 0; i < door.uNumFaces; i++)
+                doorFaces.insert(door.pFaceIDs[i]);
+        }
+
+        int sectorCount = location.pSectors.size();
+        for (int faceId = 0; faceId < static_cast<int>(location.pFaces.size()); faceId++) {
+            const BLVFace &face = location.pFaces[faceId];
+            if (!face.isPortal() || face.uSectorID == face.uBackSectorID)
+                continue;
+            if (face.uSectorID <= 0 || face.uBackSectorID <= 0 || face.uSectorID >= sectorCount || face.uBackSectorID >= sectorCount)
+                continue;
+
+            PvsPortal &portal = _portals.emplace_back();
+            portal.frontSector = face.uSectorID;
+            portal.backSector = face.uBackSectorID;
+            portal.plane = face.facePlane;
+            portal.movable = doorFaces.contains(faceId);
+            for (int i = 0; i < face.uNumVertices; i++) {
+                portal.vertices.push_back(location.pVertices[face.pVertexIDs[i]].toFloat());
+                portal.movable |= doorVertices.contains(face.pVertexIDs[i]);
+            }
+
+            int portalId = _portals.size() - 1;
+            _sectorPortals[portal.frontSector].push_back(portalId);
+            _sectorPortals[portal.backSector].push_back(portalId);
+        }
+
+        _inChain.resize(_portals.size());
+    }
+
+    /**
+     * @param sector                    Source sector.
+     * @param[out] visible              Flags for the sectors that might be visible from inside `sector`.
+     */
+    void collect(int sector, std::vector<bool> *visible) {
+        _visible = visible;
+        _steps = 0;
+        (*_visible)[sector] = true;
+
+        if (!walk(sector)) {
+            // Too many chains, the location is too open for this to be useful anyway.
+            flood(sector);
+        }
+
+        assert(_chain.empty());
+        _visible = nullptr;
+    }
+
+    /**
+     * @param sector                    Sector id.
+     * @return                          Ids of the sectors that share a portal with `sector`.
+     */
+    std::vector<int> neighbours(int sector) const {
+        std::vector<int> result;
+        for (int portalId : _sectorPortals[sector])
+            result.push_back(otherSector(_portals[portalId], sector));
+        return result;
+    }
+
+ private:
+    static int otherSector(const PvsPortal &portal, int sector) {
+        return portal.frontSector == sector ? portal.backSector : portal.frontSector;
+    }
+
+    static bool hasVertexBeyond(const PvsPortal &portal, const PvsPortal &plane, float sign) {
+        return std::ranges::any_of(portal.vertices, [&](const Vec3f &v) { return sign * plane.plane.signedDistanceTo(v) > -PVS_EPSILON; });
+    }
+
+    static bool hasVertexBefore(const PvsPortal &portal, const PvsPortal &plane, float sign) {
+        return std::ranges::any_of(portal.vertices, [&](const Vec3f &v) { return sign * plane.plane.signedDistanceTo(v) < PVS_EPSILON; });
+    }
+
+    /**
+     * Checks whether a line of sight can pass through all the portals in the current chain, and then through the
+     * provided portal. A line crosses each plane only once, so after passing a portal it stays on its far side, and
+     * before reaching a portal it's on its near side. If there is a portal pair in the chain that violates this,
+     * then there is no such line.
+     */
+    bool isPassable(const PvsStep &next) const {
+        const PvsPortal &nextPortal = _portals[next.portal];
+        if (nextPortal.movable)
+            return true;
+
+        for (const PvsStep &step : _chain) {
+            const PvsPortal &portal = _portals[step.portal];
+            if (portal.movable)
+                continue;
+            if (!hasVertexBeyond(nextPortal, portal, step.sign) || !hasVertexBefore(portal, nextPortal, next.sign))
+                return false;
+        }
+        return true;
+    }
+
+    bool walk(int sector) {
+        for (int portalId : _sectorPortals[sector]) {
+            if (_inChain[portalId])
+                continue;
+
+            const PvsPortal &portal = _portals[portalId];
+            int target = otherSector(portal, sector);
+            PvsStep step = {portalId, target == portal.frontSector ? 1.0f : -1.0f};
+            if (!isPassable(step))
+                continue;
+
+            if (++_steps > PVS_MAX_STEPS)
+                return false;
+
+            (*_visible)[target] = true;
+
+            if (_chain.size() + 1 >= PVS_MAX_CHAIN_LENGTH) {
+                flood(target);
+                continue;
+            }
+
+            _chain.push_back(step);
+            _inChain[portalId] = true;
+            bool completed = walk(target);
+            _inChain[portalId] = false;
+            _chain.pop_back();
+            if (!completed)
+                return false;
+        }
+        return true;
+    }
+
+    void flood(int sector) {
+        std::vector<int> queue = {sector};
+        (*_visible)[sector] = true;
+        while (!queue.empty()) {
+            int current = queue.back();
+            queue.pop_back();
+            for (int portalId : _sectorPortals[current]) {
+                int target = otherSector(_portals[portalId], current);
+                if (!(*_visible)[target]) {
+                    (*_visible)[target] = true;
+                    queue.push_back(target);
+                }
+            }
+        }
+    }
+
+ private:
+    std::vector<PvsPortal> _portals;
+    std::vector<std::vector<int>> _sectorPortals; // Sector id => portal ids.
+    std::vector<PvsStep> _chain;
+    std::vector<bool> _inChain; // Portal id => whether it's in `_chain`.
+    std::vector<bool> *_visible = nullptr;
+    int _steps = 0;
+};
+} // namespace
+
+IndoorPvs::IndoorPvs(int sectorCount) : _sectorCount(sectorCount), _rowSize((sectorCount + 63) / 64) {
+    _bits.resize(static_cast<size_t>(_sectorCount) * _rowSize);
+}
+
+IndoorPvs IndoorPvs::compute(const IndoorLocation &location) {
+    int sectorCount = location.pSectors.size();
+    IndoorPvs result(sectorCount);
+    result._fingerprint = fingerprint(location);
+
+    PvsBuilder builder(location);
+    std::vector<std::vector<bool>> base(sectorCount, std::vector<bool>(sectorCount));
+    for (int sector = 1; sector < sectorCount; sector++)
+        builder.collect(sector, &base[sector]);
+
+    // The renderer starts the portal walk from the party sector, but the camera might be standing in the neighbouring
+    // sector (e.g. eye level is above the stairs that the party is on), and portals right next to the camera are not
+    // clipped at all. So we merge in the sets of all the neighbouring sectors.
+    for (int sector = 1; sector < sectorCount; sector++) {
+        std::vector<int> sources = builder.neighbours(sector);
+        sources.push_back(sector);
+        for (int source : sources)
+            for (int target = 0; target < sectorCount; target++)
+                if (base[source][target])
+                    result.setVisible(sector, target);
+    }
+
+    // Dummy sector 0 sees everything, it's not a real location for the camera.
+    for (int target = 0; target < sectorCount; target++)
+        result.setVisible(0, target);
+
+    return result;
+}
+
+IndoorPvs IndoorPvs::load(const IndoorLocation &location, const std::string &cachePath) {
+    uint64_t expectedFingerprint = fingerprint(location);
+
+    try {
+        IndoorPvs result = fromBlob<IndoorPvs>(Blob::fromFile(cachePath));
+        if (result._fingerprint == expectedFingerprint && result._sectorCount == static_cast<int>(location.pSectors.size()))
+            return result;
+        logger->info("PVS cache '{}' is out of date, recomputing.", cachePath);
+    } catch (const std::exception &e) {
+        // Note that `Blob::fromFile` throws `std::system_error` if the file doesn't exist.
+        logger->info("Could not read PVS cache '{}', recomputing: {}", cachePath, e.what());
+    }
+
+    IndoorPvs result = compute(location);
+
+    try {
+        TempFileOutputStream stream(cachePath);
+        serialize(result, &stream);
+        stream.close();
+    } catch (const std::exception &e) {
+        logger->warning("Could not write PVS cache '{}': {}", cachePath, e.what());
+    }
+
+    return result;
+}
+
+uint64_t IndoorPvs::fingerprint(const IndoorLocation &location) {
+    // FNV-1a.
+    uint64_t result = 14695981039346656037ull;
+    auto hash = [&](int64_t value) {
+        for (int i = 0; i < 8; i++) {
+            result ^= (value >> (i * 8)) & 0xFF;
+            result *= 1099511628211ull;
+        }
+    };
+
+    hash(PVS_VERSION);
+    hash(location.pSectors.size());
+    hash(location.pFaces.size());
+    for (int faceId = 0; faceId < static_cast<int>(location.pFaces.size()); faceId++) {
+        const BLVFace &face = location.pFaces[faceId];
+        if (!face.isPortal())
+            continue;
+
+        hash(faceId);
+        hash(face.uSectorID);
+        hash(face.uBackSectorID);
+        for (int i = 0; i < face.uNumVertices; i++) {
+            const Vec3i &v = location.pVertices[face.pVertexIDs[i]];
+            hash(face.pVertexIDs[i]);
+            hash(v.x);
+            hash(v.y);
+            hash(v.z);
+        }
+    }
+
+    hash(location.pDoors.size());
+    for (const BLVDoor &door : location.pDoors) {
+        for (int i = 0; i < door.uNumVertices; i++)
+            hash(door.pVertexIDs[i]);
+        for (int i = 0; i < door.uNumFaces; i++)
+            hash(door.pFaceIDs[i]);
+    }
+
+    return result;
+}
+
+int IndoorPvs::visibleCount(int fromSector) const {
+    if (fromSector < 0 || fromSector >= _sectorCount)
+        return _sectorCount;
+
+    int result = 0;
+    for (int i = 0; i < _rowSize; i++)
+        result += std::popcount(_bits[fromSector * _rowSize + i]);
+    return result;
+}
+
+void serialize(const IndoorPvs &src, OutputStream *dst) {
+    serialize(PVS_VERSION, dst);
+    serialize(src._fingerprint, dst);
+    serialize(src._sectorCount, dst);
+    serialize(src._bits, dst);
+}
+
+void deserialize(InputStream &src, IndoorPvs *dst) {
+    uint32_t version = 0;
+    deserialize(src, &version);
+    if (version != PVS_VERSION)
+        throw Exception("Unsupported PVS version {}", version);
+
+    uint64_t fingerprint = 0;
+    int sectorCount = 0;
+    deserialize(src, &fingerprint);
+    deserialize(src, &sectorCount);
+    if (sectorCount < 0)
+        throw Exception("Invalid PVS sector count {}", sectorCount);
+
+    IndoorPvs result(sectorCount);
+    result._fingerprint = fingerprint;
+    deserialize(src, &result._bits);
+    if (result._bits.size() != static_cast<size_t>(result._sectorCount) * result._rowSize)
+        throw Exception("Invalid PVS size {}", result._bits.size());
+
+    *dst = std::move(result);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct IndoorLocation;
+class InputStream;
+class OutputStream;
+
+/**
+ * Potential visibility set for an indoor location - for each pair of sectors, whether the second sector might ever be
+ * visible from anywhere inside the first one.
+ *
+ * The set is conservative, i.e. it only rules out sectors that are guaranteed to be invisible. It's built by walking
+ * portal chains from each sector and dropping the chains that fold back on themselves, e.g. when the next portal lies
+ * entirely behind one of the portals already passed. Portals that can be moved by doors are treated as if they can be
+ * seen through from any direction, so the result holds for all door states.
+ *
+ * Computing the set for a large dungeon takes a noticeable amount of time, so it's cached on disk, see
+ * `IndoorPvs::load`.
+ */
+class IndoorPvs {
+ public:
+    IndoorPvs() = default;
+
+    /**
+     * @param location                  Loaded indoor location.
+     * @return                          Potential visibility set for the provided location.
+     */
+    [[nodiscard]] static IndoorPvs compute(const IndoorLocation &location);
+
+    /**
+     * Loads the potential visibility set from the provided cache file, or computes it and writes out the cache file
+     * if it's missing or out of date.
+     *
+     * @param location                  Loaded indoor location.
+     * @param cachePath                 Path to the cache file.
+     * @return                          Potential visibility set for the provided location.
+     */
+    [[nodiscard]] static IndoorPvs load(const IndoorLocation &location, const std::string &cachePath);
+
+    /**
+     * @param location                  Indoor location.
+     * @return                          Hash of all the level geometry that affects the visibility set. Used to check
+     *                                  whether the cached set is still valid.
+     */
+    [[nodiscard]] static uint64_t fingerprint(const IndoorLocation &location);
+
+    /**
+     * @param fromSector                Id of the sector that the camera is in.
+     * @param toSector                  Id of the sector to check.
+     * @return                          Whether `toSector` might be visible from `fromSector`. Always returns `true`
+     *                                  for an empty set, or if either of the ids is out of range.
+     */
+    [[nodiscard]] bool isVisible(int fromSector, int toSector) const {
+        if (fromSector < 0 || toSector < 0 || fromSector >= _sectorCount || toSector >= _sectorCount)
+            return true;
+        return (_bits[fromSector * _rowSize + toSector / 64] >> (toSector % 64)) & 1;
+    }
+
+    /**
+     * @param fromSector                Id of the sector that the camera is in.
+     * @return                          Number of sectors that might be visible from `fromSector`.
+     */
+    [[nodiscard]] int visibleCount(int fromSector) const;
+
+    [[nodiscard]] bool empty() const {
+        return _sectorCount == 0;
+    }
+
+    [[nodiscard]] int sectorCount() const {
+        return _sectorCount;
+    }
+
+    [[nodiscard]] uint64_t fingerprint() const {
+        return _fingerprint;
+    }
+
+    friend bool operator==(const IndoorPvs &l, const IndoorPvs &r) = default;
+
+    friend void serialize(const IndoorPvs &src, OutputStream *dst);
+    friend void deserialize(InputStream &src, IndoorPvs *dst);
+
+ private:
+    explicit IndoorPvs(int sectorCount);
+
+    void setVisible(int fromSector, int toSector) {
+        _bits[fromSector * _rowSize + toSector / 64] |= uint64_t(1) << (toSector % 64);
+    }
+
+ private:
+    uint64_t _fingerprint = 0;
+    int _sectorCount = 0;
+    int _rowSize = 0; // Row size in `_bits`, in 64-bit words.
+    std::vector<uint64_t> _bits; // Bit matrix, row per source sector.
+};
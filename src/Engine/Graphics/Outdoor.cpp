@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -38,6 +40,7 @@
 #include "Engine/Graphics/BspRenderer.h"
 #include "Engine/MapInfo.h"
 #include "Engine/LOD.h"
+#include "Engine/LodTextureCache.h"
 
 #include "GUI/GUIProgressBar.h"
 #include "GUI/GUIWindow.h"
@@ -48,6 +51,7 @@
 
 #include "Library/Logger/Logger.h"
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/Memory/FreeDeleter.h"
 #include "Utility/Math/TrigLut.h"
@@ -175,6 +179,21 @@ void OutdoorLocation::Draw() {
     trail_particle_generator.UpdateParticles();
 }
 
+void OutdoorLocation::UpdateWithoutDrawing() {
+    // Game state updates from Draw & ExecDraw, in the same order.
+    if (pParty->uCurrentMinute != pOutdoor->uLastSunlightUpdateMinute)
+        UpdateSunlightVectors();
+    UpdateFog();
+
+    pMobileLightsStack->uNumLightsActive = 0;
+    pStationaryLightsStack->uNumLightsActive = 0;
+    engine->StackPartyTorchLight();
+
+    UpdateDiscoveredArea(WorldPosToGridCellX(pParty->pos.x), WorldPosToGridCellY(pParty->pos.y), 1);
+
+    trail_particle_generator.UpdateParticles();
+}
+
 //----- (00488E23) --------------------------------------------------------
 double OutdoorLocation::GetFogDensityByTime() {
     if (pParty->uCurrentHour < 5) {  // ночь
@@ -815,6 +834,8 @@ void OutdoorLocation::Release() {
     this->sky_texture_filename = "sky043";
 
     pBModels.clear();
+    faceTree = BBoxTree();
+    faceTreeRefs.clear();
     pSpawnPoints.clear();
     pTerrain.Release();
     pFaceIDLIST.clear();
@@ -857,6 +878,15 @@ void OutdoorLocation::Load(const std::string &filename, int days_played, int res
     OutdoorLocation_MM7 location;
     deserialize(lod::decodeCompressed(pGames_LOD->read(odm_filename)), &location); // read throws.
     reconstruct(location, this);
+    buildFaceTree();
+
+    // Same as in `IndoorLocation::Load`, start decoding the bmodel face textures in the background.
+    std::vector<std::string> textureNames;
+    for (BSPModel &model : pBModels)
+        for (ODMFace &face : model.pFaces)
+            if (face.Visible() && !face.IsTextureFrameTable())
+                textureNames.push_back(*face.GetTexture()->GetName());
+    pBitmaps_LOD->prefetch(textureNames);
 
     // ****************.ddm file*********************//
 
@@ -945,6 +975,20 @@ void OutdoorLocation::Load(const std::string &filename, int days_played, int res
     this->sky_texture = assets->getBitmap(loc_time.sky_texture_name);
 }
 
+void OutdoorLocation::buildFaceTree() {
+    // Ids are assigned in (model, face) order, so sorted query results follow the same order as nested loops over
+    // models & faces. Code that used to do such loops relies on this.
+    std::vector<BBoxi> boxes;
+    faceTreeRefs.clear();
+    for (const BSPModel &model : pBModels) {
+        for (const ODMFace &face : model.pFaces) {
+            boxes.push_back(face.pBoundingBox);
+            faceTreeRefs.emplace_back(model.index, face.index);
+        }
+    }
+    faceTree = BBoxTree(boxes);
+}
+
 int OutdoorLocation::getTileIdByTileMapId(int mapId) {
     int result;  // eax@2
     int v3;             // eax@3
@@ -1201,6 +1245,7 @@ bool OutdoorLocation::InitalizeActors(MapId a1) {
                        //  int v9; // [sp+34Ch] [bp-4h]@1
 
     alert_status = false;
+    Actor::prefetchSprites(pActors);
     for (int i = 0; i < pActors.size(); ++i) {
         if (!(pActors[i].attributes & ACTOR_UNKNOW7)) {
             if (!alert_status) {
@@ -1447,45 +1492,43 @@ int ODM_GetFloorLevel(const Vec3i &pos, int unused, bool *pIsOnWater,
     odm_floor_level[0] = GetTerrainHeightsAroundParty2(pos.x, pos.y, pIsOnWater, bWaterWalk);
 
     int surface_count = 1;
+    int slack = engine->config->snapshot().floorChecksEps;
+
+    static std::vector<int> faceIds; // Static to avoid allocations, this function is called a lot.
+    pOutdoor->faceTree.queryXY(pos.x, pos.y, &faceIds);
+    for (int id : faceIds) {
+        auto [modelIndex, faceIndex] = pOutdoor->faceTreeRefs[id];
+        BSPModel &model = pOutdoor->pBModels[modelIndex];
+        ODMFace &face = model.pFaces[faceIndex];
 
-    for (BSPModel &model : pOutdoor->pBModels) {
         if (!model.pBoundingBox.containsXY(pos.x, pos.y))
             continue;
 
-        if (model.pFaces.empty())
+        if (face.Ethereal())
             continue;
 
-        for (ODMFace &face : model.pFaces) {
-            if (face.Ethereal())
-                continue;
-
-            if (face.uNumVertices == 0)
-                continue;
-
-            if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
-                continue;
-
-            if (!face.pBoundingBox.containsXY(pos.x, pos.y))
-                continue;
+        if (face.uNumVertices == 0)
+            continue;
 
-            int slack = engine->config->gameplay.FloorChecksEps.value();
-            if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
-                continue;
+        if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
+            continue;
 
-            int floor_level;
-            if (face.uPolygonType == POLYGON_Floor) {
-                floor_level = model.pVertices[face.pVertexIDs[0]].z;
-            } else {
-                floor_level = face.zCalc.calculate(pos.x, pos.y);
-            }
-            odm_floor_level[surface_count] = floor_level;
-            current_BModel_id[surface_count] = model.index;
-            current_Face_id[surface_count] = face.index;
-            surface_count++;
+        if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
+            continue;
 
-            if (surface_count >= 20)
-                break;
+        int floor_level;
+        if (face.uPolygonType == POLYGON_Floor) {
+            floor_level = model.pVertices[face.pVertexIDs[0]].z;
+        } else {
+            floor_level = face.zCalc.calculate(pos.x, pos.y);
         }
+        odm_floor_level[surface_count] = floor_level;
+        current_BModel_id[surface_count] = model.index;
+        current_Face_id[surface_count] = face.index;
+        surface_count++;
+
+        if (surface_count >= 20)
+            break;
     }
 
     if (surface_count == 1) {
@@ -1718,12 +1761,12 @@ void ODM_ProcessPartyActions() {
                 if (engine->IsUnderwater() ||
                     pParty->pPartyBuffs[PARTY_BUFF_FLY].isGMBuff ||
                     (pParty->pCharacters[pParty->pPartyBuffs[PARTY_BUFF_FLY].caster - 1].mana > 0 || engine->config->debug.AllMagic.value())) {
-                    if (pParty->sPartySavedFlightZ < engine->config->gameplay.MaxFlightHeight.value() || partyNotTouchingFloor) {
+                    if (pParty->sPartySavedFlightZ < engine->config->snapshot().maxFlightHeight || partyNotTouchingFloor) {
                         pParty->bFlying = true;
                         pParty->speed.z = 0;
                         noFlightBob = true;
                         pParty->uFlags &= ~(PARTY_FLAG_LANDING | PARTY_FLAG_JUMPING);
-                        if (pParty->sPartySavedFlightZ < engine->config->gameplay.MaxFlightHeight.value()) {
+                        if (pParty->sPartySavedFlightZ < engine->config->snapshot().maxFlightHeight) {
                             partyInputSpeed.z = pParty->walkSpeed * 4;
                             partyOldFlightZ = pParty->pos.z;
                         }
@@ -2239,7 +2282,7 @@ int GetCeilingHeight(int Party_X, signed int Party_Y, int Party_ZHeight, int *pF
             if (!face.pBoundingBox.containsXY(Party_X, Party_Y))
                 continue;
 
-            int slack = engine->config->gameplay.FloorChecksEps.value();
+            int slack = engine->config->snapshot().floorChecksEps;
             if (!face.Contains(Vec3i(Party_X, Party_Y, 0), model.index, slack, FACE_XY_PLANE))
                 continue;
 
@@ -2302,6 +2345,8 @@ void sub_487DA9() {
 
 //----- (004706C6) --------------------------------------------------------
 void UpdateActors_ODM() {
+    MM_PROFILE_ZONE("UpdateActors_ODM");
+
     if (engine->config->debug.NoActors.value())
         return;  // uNumActors = 0;
 
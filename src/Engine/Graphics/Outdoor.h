@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <utility>
 #include <vector>
 #include <string>
 
@@ -11,6 +12,7 @@
 #include "Media/Audio/SoundEnums.h"
 
 #include "Library/Color/Color.h"
+#include "Library/Geometry/BBoxTree.h"
 
 #include "BSPModel.h"
 #include "LocationInfo.h"
@@ -119,6 +121,12 @@ struct OutdoorLocation {
     void SetFog();
     void Draw();
 
+    /**
+     * Runs the game state updates that `Draw` does - sunlight, fog, party torchlight, discovered area & trail
+     * particles - without drawing anything. Used when world drawing is skipped, see `Engine::setWorldDrawingSkipped`.
+     */
+    void UpdateWithoutDrawing();
+
     double GetPolygonMaxZ(struct RenderVertexSoft *pVertex, unsigned int unumverts);
     double GetPolygonMinZ(struct RenderVertexSoft *pVertices, unsigned int unumverts);
 
@@ -134,6 +142,11 @@ struct OutdoorLocation {
         return pBModels[pid.id() >> 6];
     }
 
+    /**
+     * Rebuilds `faceTree` from the faces of the currently loaded bmodels.
+     */
+    void buildFaceTree();
+
     std::string level_filename;
     std::string location_filename;
     std::string location_file_description;
@@ -142,6 +155,8 @@ struct OutdoorLocation {
     OutdoorLocationTerrain pTerrain;
     std::array<uint16_t, 128 * 128> pCmap; // Unused
     std::vector<BSPModel> pBModels;
+    BBoxTree faceTree; // BVH over the bounding boxes of all bmodel faces, ids are indices into `faceTreeRefs`.
+    std::vector<std::pair<int, int>> faceTreeRefs; // (bmodel index, face index) for each id in `faceTree`.
     std::vector<Pid> pFaceIDLIST;
     std::array<uint32_t, 128 * 128> pOMAP;
     GraphicsImage *sky_texture = nullptr;        // signed int sSky_TextureID;
@@ -1,5 +1,8 @@
 #include "Engine/Graphics/ParticleEngine.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "Engine/Graphics/Camera.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Random/Random.h"
@@ -7,6 +10,8 @@
 #include "Engine/OurMath.h"
 #include "Engine/Time/Timer.h"
 
+#include "Library/Profiler/Profiler.h"
+
 #include "Utility/Math/TrigLut.h"
 
 #include "Outdoor.h"
@@ -46,60 +51,70 @@ void TrailParticleGenerator::UpdateParticles() {
     }
 }
 
-ParticleEngine::ParticleEngine() {
+void ParticleStore::setCapacity(size_t capacity) {
+    forEachArray([&](auto &array) { array.resize(capacity); });
+    _capacity = capacity;
+    _size = std::min(_size, capacity);
+}
+
+void ParticleStore::remove(size_t index) {
+    assert(index < _size);
+
+    size_t last = _size - 1;
+    if (index != last)
+        forEachArray([&](auto &array) { array[index] = array[last]; });
+    _size = last;
+}
+
+ParticleEngine::ParticleEngine(int capacity) {
+    setCapacity(capacity);
     ResetParticles();
 }
 
 void ParticleEngine::ResetParticles() {
-    pParticles.fill({});
-    uStartParticle = PARTICLES_ARRAY_SIZE;
-    uEndParticle = 0;
+    _particles.clear();
+    _droppedCount = 0;
     uTimeElapsed = 0_ticks;
 }
 
+void ParticleEngine::setCapacity(int capacity) {
+    assert(capacity >= 0);
+
+    if (_particles.size() > static_cast<size_t>(capacity))
+        _droppedCount += _particles.size() - capacity;
+    _particles.setCapacity(capacity);
+}
+
 void ParticleEngine::AddParticle(Particle_sw *particle) {
-    if (!pMiscTimer->isPaused()) {
-        Particle *freeParticle = nullptr;
-
-        for (int i = 0; i < pParticles.size(); i++) {
-            if (pParticles[i].type == ParticleType_Invalid) {
-                if (i < this->uStartParticle) {
-                    this->uStartParticle = i;
-                }
-                if (i > this->uEndParticle) {
-                    this->uEndParticle = i;
-                }
-                freeParticle = &pParticles[i];
-                break;
-            }
-        }
+    if (pMiscTimer->isPaused())
+        return;
 
-        if (freeParticle) {
-            freeParticle->type = particle->type;
-            freeParticle->x = particle->x;
-            freeParticle->y = particle->y;
-            freeParticle->z = particle->z;
-            freeParticle->_x = particle->x;
-            freeParticle->_y = particle->y;
-            freeParticle->_z = particle->z;
-            freeParticle->shift_x = particle->r; // TODO: seems Particle_sw struct fields are mixed up here
-            freeParticle->shift_y = particle->g;
-            freeParticle->shift_z = particle->b;
-            freeParticle->uParticleColor = particle->uDiffuse;
-            freeParticle->uLightColor_bgr = particle->uDiffuse;
-            // v6 = (v4->uType & 4) == 0;
-            freeParticle->timeToLive = particle->timeToLive;
-            freeParticle->texture = particle->texture;
-            freeParticle->paletteID = particle->paletteID;
-            freeParticle->particle_size = particle->particle_size;
-            if (freeParticle->type & ParticleType_Rotating) {
-                freeParticle->rotation_speed = vrng->random(256) - 128;
-                freeParticle->angle = vrng->random(TrigLUT.uIntegerDoublePi);
-            } else {
-                freeParticle->rotation_speed = 0;
-                freeParticle->angle = 0;
-            }
-        }
+    if (_particles.full()) {
+        _droppedCount++;
+        return;
+    }
+
+    size_t i = _particles.add();
+    _particles.type[i] = particle->type;
+    _particles.x[i] = particle->x;
+    _particles.y[i] = particle->y;
+    _particles.z[i] = particle->z;
+    _particles.shiftX[i] = particle->r; // TODO: seems Particle_sw struct fields are mixed up here
+    _particles.shiftY[i] = particle->g;
+    _particles.shiftZ[i] = particle->b;
+    _particles.gravity[i] = (particle->type & ParticleType_Dropping) ? 1.0f : 0.0f;
+    _particles.timeToLive[i] = particle->timeToLive.ticks();
+    _particles.color[i] = particle->uDiffuse;
+    _particles.lightColor[i] = particle->uDiffuse;
+    _particles.texture[i] = particle->texture;
+    _particles.paletteID[i] = particle->paletteID;
+    _particles.particleSize[i] = particle->particle_size;
+    if (particle->type & ParticleType_Rotating) {
+        _particles.rotationSpeed[i] = vrng->random(256) - 128;
+        _particles.angle[i] = vrng->random(TrigLUT.uIntegerDoublePi);
+    } else {
+        _particles.rotationSpeed[i] = 0;
+        _particles.angle[i] = 0;
     }
 }
 
@@ -114,8 +129,7 @@ void ParticleEngine::Draw() {
 }
 
 void ParticleEngine::UpdateParticles() {
-    unsigned uCurrentEnd = 0;
-    unsigned uCurrentBegin = PARTICLES_ARRAY_SIZE;
+    MM_PROFILE_ZONE("ParticleEngine::UpdateParticles");
 
     // TODO(captainurist): checking pMiscTimer->isPaused(), then using pEventTimer->uTimeElapsed?
     Duration time = !pMiscTimer->isPaused() ? pEventTimer->dt() : 0_ticks;
@@ -124,109 +138,81 @@ void ParticleEngine::UpdateParticles() {
         return;
     }
 
-    for (unsigned int i = uStartParticle; i <= uEndParticle; ++i) {
-        Particle *p = &pParticles[i];
+    int64_t ticks = time.ticks();
 
-        if (p->type == ParticleType_Invalid) {
-            continue;
-        }
-
-        if (p->timeToLive <= time) {
-            p->timeToLive = 0_ticks;
-            p->type = ParticleType_Invalid;
-            continue;
-        }
+    // Remove expired particles first. Iterating backwards so that the particle that gets moved into the freed slot
+    // has already been checked.
+    for (size_t i = _particles.size(); i-- > 0;)
+        if (_particles.timeToLive[i] <= ticks)
+            _particles.remove(i);
 
-        p->timeToLive -= time;
+    size_t size = _particles.size();
 
-        // Line particle type appear unused
-        if (p->type & ParticleType_Line) {
-            p->_x = p->x;
-            p->_y = p->y;
-            p->_z = p->z;
+    // Ascending particles slowly float upward. This one needs vrng, so it's a separate scalar pass.
+    for (size_t i = 0; i < size; i++) {
+        if (_particles.type[i] & ParticleType_Ascending) {
+            _particles.x[i] += (vrng->random(5) - 2) * ticks / 16.0f;
+            _particles.y[i] += (vrng->random(5) - 2) * ticks / 16.0f;
+            _particles.z[i] += (vrng->random(5) + 4) * ticks / 16.0f;
         }
+    }
 
-        // Dropping particles drop downward with acceleration
-        if (p->type & ParticleType_Dropping) {
-            p->shift_z -= time.ticks() * 5.0;
-        }
-
-        // Ascending particles slowly float upward
-        if (p->type & ParticleType_Ascending) {
-            p->x += (vrng->random(5) - 2) * time.ticks() / 16.0;
-            p->y += (vrng->random(5) - 2) * time.ticks() / 16.0;
-            p->z += (vrng->random(5) + 4) * time.ticks() / 16.0;
-        }
-
-        // v9 = (signed int)(time * p->rotation_speed) / 16;
-
-        // Particle shift with time
-        double shift = time.ticks() / 128.0f;
-        p->x += shift * p->shift_x;
-        p->y += shift * p->shift_y;
-        p->z += shift * p->shift_z;
-
-        p->angle += time.ticks() * p->rotation_speed / 16;
-
-        // With time particles become more transparent
-        int dissipate_value = 2 * p->timeToLive.ticks();
-        if (dissipate_value >= 255) {
-            dissipate_value = 255;
-        }
-        float dissipate_factor = dissipate_value / 255.0f;
-        // v10 = (double)v22 * 0.0039215689;
-        // TODO(Nik-RE-dev): check colour format use in particles
-        p->uLightColor_bgr = Color(floorf(p->uParticleColor.r * dissipate_factor + 0.5),
-                                   floorf(p->uParticleColor.g * dissipate_factor + 0.5),
-                                   floorf(p->uParticleColor.b * dissipate_factor + 0.5));
-
-        if (i < uCurrentBegin) {
-           uCurrentBegin = i;
-        }
-        if (i > uCurrentEnd) {
-           uCurrentEnd = i;
-        }
+    // Everything below is branch-free & works on plain arrays, so that the compiler can vectorize it.
+    int64_t *timeToLive = _particles.timeToLive.data();
+    float *x = _particles.x.data();
+    float *y = _particles.y.data();
+    float *z = _particles.z.data();
+    const float *shiftX = _particles.shiftX.data();
+    const float *shiftY = _particles.shiftY.data();
+    float *shiftZ = _particles.shiftZ.data();
+    const float *gravity = _particles.gravity.data();
+    const int *rotationSpeed = _particles.rotationSpeed.data();
+    int *angle = _particles.angle.data();
+
+    for (size_t i = 0; i < size; i++)
+        timeToLive[i] -= ticks;
+
+    // Dropping particles drop downward with acceleration.
+    float drop = ticks * 5.0f;
+    for (size_t i = 0; i < size; i++)
+        shiftZ[i] -= drop * gravity[i];
+
+    // Particle shift with time.
+    float shift = ticks / 128.0f;
+    for (size_t i = 0; i < size; i++) {
+        x[i] += shift * shiftX[i];
+        y[i] += shift * shiftY[i];
+        z[i] += shift * shiftZ[i];
     }
 
-    uEndParticle = uCurrentEnd;
-    uStartParticle = uCurrentBegin;
+    int angleTicks = ticks;
+    for (size_t i = 0; i < size; i++)
+        angle[i] += angleTicks * rotationSpeed[i] / 16;
+
+    // With time particles become more transparent.
+    // TODO(Nik-RE-dev): check colour format use in particles
+    const Color *color = _particles.color.data();
+    Color *lightColor = _particles.lightColor.data();
+    for (size_t i = 0; i < size; i++) {
+        float dissipateFactor = std::min<int64_t>(2 * timeToLive[i], 255) / 255.0f;
+        lightColor[i] = Color(floorf(color[i].r * dissipateFactor + 0.5f),
+                              floorf(color[i].g * dissipateFactor + 0.5f),
+                              floorf(color[i].b * dissipateFactor + 0.5f));
+    }
 }
 
-bool ParticleEngine::ViewProject_TrueIfStillVisible_BLV(unsigned int uParticleID) {
-    Particle *pParticle;  // esi@1
-    int y_int_;           // [sp+10h] [bp-40h]@2
-    int x_int;            // [sp+20h] [bp-30h]@2
-    int z_int_;           // [sp+24h] [bp-2Ch]@2
-
-    pParticle = &this->pParticles[uParticleID];
-    if (pParticle->type == ParticleType_Invalid) return 0;
-    // uParticleID = LODWORD(pParticle->x);
-    // v56 = *(float *)&uParticleID + 6.7553994e15;
-    x_int = floorf(pParticle->x + 0.5f);
-    // uParticleID = LODWORD(pParticle->y);
-    // y_int_ = *(float *)&uParticleID + 6.7553994e15;
-    y_int_ = floorf(pParticle->y + 0.5f);
-    // uParticleID = LODWORD(pParticle->z);
-    // z_int_ = *(float *)&uParticleID + 6.7553994e15;
-    z_int_ = floorf(pParticle->z + 0.5f);
-
-    /*fixed x, y, z;*/
-    int xt, yt, zt;
-
-    if (!pCamera3D->ViewClip(x_int, y_int_, z_int_, &xt, &yt, &zt, 0)) return false;
-    pCamera3D->Project(xt, yt, zt, &pParticle->uScreenSpaceX, &pParticle->uScreenSpaceY);
-
-    pParticle->fov_x = pCamera3D->ViewPlaneDistPixels;
+bool ParticleEngine::ViewProject_TrueIfStillVisible_BLV(size_t index, ParticleProjection *projection) const {
+    int x = floorf(_particles.x[index] + 0.5f);
+    int y = floorf(_particles.y[index] + 0.5f);
+    int z = floorf(_particles.z[index] + 0.5f);
 
-    /*pParticle->screenspace_scale = fixed::FromFloat(pParticle->particle_size) *
-                                   fixed::FromFloat(pParticle->fov_x) / x;*/
-
-    pParticle->screenspace_scale = /*fixed::FromFloat*/(pParticle->particle_size) *
-        /*fixed::FromFloat*/(pParticle->fov_x) / /*fixed::FromInt*/(xt);
-
-    /*pParticle->zbuffer_depth = x.GetInt();*/
-    pParticle->zbuffer_depth = xt;
+    int xt, yt, zt;
+    if (!pCamera3D->ViewClip(x, y, z, &xt, &yt, &zt, 0))
+        return false;
+    pCamera3D->Project(xt, yt, zt, &projection->screenX, &projection->screenY);
 
+    projection->screenspaceScale = _particles.particleSize[index] * pCamera3D->ViewPlaneDistPixels / xt;
+    projection->zbufferDepth = xt;
     return true;
 }
 
@@ -235,80 +221,48 @@ void ParticleEngine::DrawParticles_BLV() {
 
     v15.sParentBillboardID = -1;
 
-    for (unsigned int i = uStartParticle; i <= uEndParticle; ++i) {
-        Particle *p = &pParticles[i];
+    for (size_t i = 0; i < _particles.size(); ++i) {
+        ParticleFlags type = _particles.type[i];
 
-        if (p->type == ParticleType_Invalid) continue;
-
-        if (!ViewProject_TrueIfStillVisible_BLV(i)) continue;
+        ParticleProjection projection;
+        if (!ViewProject_TrueIfStillVisible_BLV(i, &projection)) continue;
 
         // TODO(pskelton): reinstate this guard check
         // TODO(Nik-RE-dev): all types except for Line appear to behave identically
-        if (true) {
-            /*p->uScreenSpaceX >= pBLVRenderParams->uViewportX &&
-            p->uScreenSpaceX < pBLVRenderParams->uViewportZ &&
-            p->uScreenSpaceY >= pBLVRenderParams->uViewportY &&
-            p->uScreenSpaceY < pBLVRenderParams->uViewportW) { */
-            if (p->type & ParticleType_Diffuse) {
-                // v14 = &pParticles[i];
-                v15.screenspace_projection_factor_x = p->screenspace_scale;
-                v15.screenspace_projection_factor_y = p->screenspace_scale;
-                v15.screen_space_x = p->uScreenSpaceX;
-                v15.screen_space_y = p->uScreenSpaceY;
-                v15.screen_space_z = p->zbuffer_depth;
-                v15.paletteID = p->paletteID;
-                render->MakeParticleBillboardAndPush(
-                    &v15, 0, p->uLightColor_bgr, p->angle);
-            } else if (p->type & ParticleType_Line) {  // type doesnt appear to be used
-                if (pLines.uNumLines < 100) {
-                    pLines.pLineVertices[2 * pLines.uNumLines].pos.x =
-                        p->uScreenSpaceX;
-                    pLines.pLineVertices[2 * pLines.uNumLines].pos.y =
-                        p->uScreenSpaceY;
-                    pLines.pLineVertices[2 * pLines.uNumLines].pos.z =
-                        1.0 - 1.0 / (p->zbuffer_depth * 0.061758894);
-                    pLines.pLineVertices[2 * pLines.uNumLines].rhw = 1.0;
-                    pLines.pLineVertices[2 * pLines.uNumLines].diffuse =
-                        p->uLightColor_bgr;
-                    pLines.pLineVertices[2 * pLines.uNumLines].specular = Color();
-                    pLines.pLineVertices[2 * pLines.uNumLines].texcoord.x = 0.0;
-                    pLines.pLineVertices[2 * pLines.uNumLines].texcoord.y = 0.0;
-
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].pos.x =
-                        p->uScreenSpaceZ;  // where is this set?
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].pos.y =
-                        p->uScreenSpaceW;
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].pos.z =
-                        1.0 - 1.0 / ((short)p->sZValue2 * 0.061758894);
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].rhw = 1.0;
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].diffuse =
-                        p->uLightColor_bgr;
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].specular = Color();
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].texcoord.x =
-                        0.0;
-                    pLines.pLineVertices[2 * pLines.uNumLines++ + 1]
-                        .texcoord.y = 0.0;
-                }
-            } else if (p->type & ParticleType_Bitmap) {
-                v15.screenspace_projection_factor_x = p->screenspace_scale;
-                v15.screenspace_projection_factor_y = p->screenspace_scale;
-                v15.screen_space_x = p->uScreenSpaceX;
-                v15.screen_space_y = p->uScreenSpaceY;
-                v15.screen_space_z = p->zbuffer_depth;
-                v15.paletteID = p->paletteID;
-                render->MakeParticleBillboardAndPush(
-                    &v15, p->texture, p->uLightColor_bgr, p->angle);
-            } else if (p->type & ParticleType_Sprite) {
-                v15.screenspace_projection_factor_x = p->screenspace_scale;
-                v15.screenspace_projection_factor_y = p->screenspace_scale;
-                v15.screen_space_x = p->uScreenSpaceX;
-                v15.screen_space_y = p->uScreenSpaceY;
-                v15.screen_space_z = p->zbuffer_depth;
-                v15.paletteID = p->paletteID;
-                render->MakeParticleBillboardAndPush(
-                    &v15, p->texture, p->uLightColor_bgr, p->angle);
+        if ((type & ParticleType_Line) && !(type & ParticleType_Diffuse)) {  // type doesnt appear to be used
+            // Line end point was never set in the original code.
+            int lineEndX = 0;
+            int lineEndY = 0;
+            int lineEndZ = 0;
+            if (pLines.uNumLines < std::size(pLines.pLineVertices) / 2) {
+                RenderVertexD3D3 *vertices = &pLines.pLineVertices[2 * pLines.uNumLines++];
+                vertices[0].pos.x = projection.screenX;
+                vertices[0].pos.y = projection.screenY;
+                vertices[0].pos.z = 1.0 - 1.0 / (projection.zbufferDepth * 0.061758894);
+                vertices[0].rhw = 1.0;
+                vertices[0].diffuse = _particles.lightColor[i];
+                vertices[0].specular = Color();
+                vertices[0].texcoord.x = 0.0;
+                vertices[0].texcoord.y = 0.0;
+
+                vertices[1].pos.x = lineEndX;
+                vertices[1].pos.y = lineEndY;
+                vertices[1].pos.z = 1.0 - 1.0 / (lineEndZ * 0.061758894);
+                vertices[1].rhw = 1.0;
+                vertices[1].diffuse = _particles.lightColor[i];
+                vertices[1].specular = Color();
+                vertices[1].texcoord.x = 0.0;
+                vertices[1].texcoord.y = 0.0;
             }
+        } else if (type & (ParticleType_Diffuse | ParticleType_Bitmap | ParticleType_Sprite)) {
+            v15.screenspace_projection_factor_x = projection.screenspaceScale;
+            v15.screenspace_projection_factor_y = projection.screenspaceScale;
+            v15.screen_space_x = projection.screenX;
+            v15.screen_space_y = projection.screenY;
+            v15.screen_space_z = projection.zbufferDepth;
+            v15.paletteID = _particles.paletteID[i];
+            render->MakeParticleBillboardAndPush(&v15, (type & ParticleType_Diffuse) ? nullptr : _particles.texture[i],
+                                                 _particles.lightColor[i], _particles.angle[i]);
         }
     }
 }
-
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
 
 #include "Engine/Graphics/RenderEntities.h"
 #include "Engine/Time/Duration.h"
@@ -45,52 +47,114 @@ struct Particle_sw {
     int field_38[12]{};
 };
 
-struct Particle {
-    ParticleFlags type = ParticleType_Invalid;
-    float x = 0;
-    float y = 0;
-    float z = 0;
-    float shift_x = 0;
-    float shift_y = 0;
-    float shift_z = 0;
-    Color uParticleColor;
-    Duration timeToLive;
-    GraphicsImage *texture = nullptr;  // unsigned int resource_id;// bitmap IDirect3DTexture
-                       // idx or sprite idx depending on type
-    int paletteID = 0;
-    float particle_size = 0;  // field_28
-    float _x = 0;
-    float _y = 0;
-    float _z = 0;
-    int rotation_speed = 0;
-    int angle = 0;
-    int uScreenSpaceX = 0;
-    int uScreenSpaceY = 0;
-    int uScreenSpaceZ = 0;  // line end x
-    int uScreenSpaceW = 0;  // line end y
-    short zbuffer_depth;
-    int sZValue2 = 0;             // line end z
-    float screenspace_scale = 1.0;  // fixed screenspace_scale {};  // int _screenspace_scale;
-    float fov_x = 0;
-    Color uLightColor_bgr;
-};
-
 struct stru2_LineList {
     unsigned int uNumLines = 0;
     RenderVertexD3D3 pLineVertices[48] {};
     char field_604[60] {};
 };
 
+/**
+ * Structure-of-arrays particle storage.
+ *
+ * Alive particles are packed densely into `[0, size())`. A new particle is appended at the end, and a dead one is
+ * replaced with the last particle, so both are O(1), and the update loops walk plain contiguous arrays with no
+ * per-particle liveness checks, which lets the compiler vectorize them.
+ *
+ * All arrays are allocated upfront in `setCapacity`, so adding particles never allocates.
+ */
+class ParticleStore {
+ public:
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return _capacity;
+    }
+
+    [[nodiscard]] bool full() const {
+        return _size == _capacity;
+    }
+
+    /**
+     * @param capacity                  New capacity. Particles beyond it are dropped.
+     */
+    void setCapacity(size_t capacity);
+
+    void clear() {
+        _size = 0;
+    }
+
+    /**
+     * @return                          Index of the newly added particle. The caller is expected to fill in all of
+     *                                  its fields. Store must not be full.
+     */
+    size_t add() {
+        assert(!full());
+        return _size++;
+    }
+
+    /**
+     * Removes a particle by moving the last particle into its slot. Note that this invalidates the index of the last
+     * particle, so when removing in a loop, iterate backwards.
+     *
+     * @param index                     Index of the particle to remove.
+     */
+    void remove(size_t index);
+
+    std::vector<ParticleFlags> type;
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> shiftX; // Velocity, in units per 128 ticks.
+    std::vector<float> shiftY;
+    std::vector<float> shiftZ;
+    std::vector<float> gravity; // 1 for dropping particles, 0 otherwise.
+    std::vector<int64_t> timeToLive; // In ticks.
+    std::vector<int> rotationSpeed;
+    std::vector<int> angle;
+    std::vector<Color> color;
+    std::vector<Color> lightColor;
+    std::vector<GraphicsImage *> texture;
+    std::vector<int> paletteID;
+    std::vector<float> particleSize;
+
+ private:
+    template<class Callable>
+    void forEachArray(Callable &&callable) {
+        callable(type);
+        callable(x);
+        callable(y);
+        callable(z);
+        callable(shiftX);
+        callable(shiftY);
+        callable(shiftZ);
+        callable(gravity);
+        callable(timeToLive);
+        callable(rotationSpeed);
+        callable(angle);
+        callable(color);
+        callable(lightColor);
+        callable(texture);
+        callable(paletteID);
+        callable(particleSize);
+    }
+
+    size_t _size = 0;
+    size_t _capacity = 0;
+};
+
 class ParticleEngine {
  public:
-    static const int PARTICLES_ARRAY_SIZE = 500;
+    static constexpr int DEFAULT_CAPACITY = 500;
 
     /**
      * Particle engine constructor.
      *
+     * @param capacity                  Max number of particles alive at the same time.
      * @offset 0x48AAC5
      */
-    ParticleEngine();
+    explicit ParticleEngine(int capacity = DEFAULT_CAPACITY);
 
     /**
      * Remove all active particles if any and initialize/reinitialize then particles engine.
@@ -100,7 +164,7 @@ class ParticleEngine {
     void ResetParticles();
 
     /**
-     * Add particle to engine.
+     * Add particle to engine. If the engine is full, the particle is dropped and `droppedCount` is incremented.
      *
      * @offset 0x48AB23
      */
@@ -121,23 +185,55 @@ class ParticleEngine {
      */
     void UpdateParticles();
 
+    /**
+     * @param capacity                  New max number of particles alive at the same time. If it's smaller than the
+     *                                  number of currently alive particles, the extra particles are dropped and added
+     *                                  to `droppedCount`.
+     */
+    void setCapacity(int capacity);
+
+    [[nodiscard]] int capacity() const {
+        return _particles.capacity();
+    }
+
+    /**
+     * @return                          Number of currently alive particles.
+     */
+    [[nodiscard]] int particleCount() const {
+        return _particles.size();
+    }
+
+    /**
+     * @return                          Number of particles that were dropped because the engine was full or its
+     *                                  capacity was reduced, since the last call to `ResetParticles`.
+     */
+    [[nodiscard]] int64_t droppedCount() const {
+        return _droppedCount;
+    }
+
+    stru2_LineList pLines;
+    Duration uTimeElapsed;
+
+ private:
+    struct ParticleProjection {
+        int screenX = 0;
+        int screenY = 0;
+        int zbufferDepth = 0;
+        float screenspaceScale = 1.0f;
+    };
+
     /**
      * @offset 0x48AE74
      */
-    bool ViewProject_TrueIfStillVisible_BLV(unsigned int uParticleID);
+    bool ViewProject_TrueIfStillVisible_BLV(size_t index, ParticleProjection *projection) const;
 
     /**
      * @offset 0x48BBA6
      */
     void DrawParticles_BLV();
 
-    std::array<Particle, PARTICLES_ARRAY_SIZE> pParticles;
-    stru2_LineList pLines;
-    char field_D160[4800]; // unused
-    float field_E420; // unused
-    int uStartParticle;
-    int uEndParticle;
-    Duration uTimeElapsed;
+    ParticleStore _particles;
+    int64_t _droppedCount = 0;
 };
 
 struct TrailParticle {
@@ -2,8 +2,9 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
-#include <map>
+#include <vector>
 
 #include <glad/gl.h> // NOLINT: not a C system header.
 
@@ -47,6 +48,7 @@
 #include "Library/Color/Colorf.h"
 #include "Library/Logger/Logger.h"
 #include "Library/Geometry/Size.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/Format.h"
 #include "Utility/Memory/MemSet.h"
@@ -366,6 +368,8 @@ void OpenGLRenderer::DrawLines(const RenderVertexD3D3 *vertices, unsigned int nu
 }
 
 void OpenGLRenderer::BeginScene3D() {
+    MM_PROFILE_ZONE("OpenGLRenderer::BeginScene3D");
+
     // Setup for 3D
 
     if (outputRender != outputPresent) {
@@ -1453,6 +1457,8 @@ struct GLshaderverts {
 GLshaderverts terrshaderstore[127 * 127 * 6] = {};
 
 void OpenGLRenderer::DrawOutdoorTerrain() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawOutdoorTerrain");
+
     // shader version
     // draws entire terrain in one go at the moment
     // textures must all be square and same size
@@ -1484,14 +1490,7 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
         }
 
         // reserve first 7 layers for water tiles in unit 0
-        auto wtrtexture = this->hd_water_tile_anim[0];
-        terraintexturesizes[0] = wtrtexture->width();
-
-        for (int buff = 0; buff < 7; buff++) {
-            std::string container_name = fmt::format("HDWTR{:03}", buff);
-            terraintexmap.insert(std::make_pair(container_name, terraintexmap.size()));
-            numterraintexloaded[0]++;
-        }
+        reserveWaterLayers(&terrainTextureArrays);
 
         for (int y = 0; y < 127; ++y) {
             for (int x = 0; x < 127; ++x) {
@@ -1499,53 +1498,9 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
 
                 // first find all required textures for terrain and add to map
                 auto tile = pOutdoor->getTileDescByGrid(x, y);
-                int tileunit = 0;
-                int tilelayer = 0;
-
-                // check if tile->name is already in list
-                auto mapiter = terraintexmap.find(tile->name);
-                if (mapiter != terraintexmap.end()) {
-                    // if so, extract unit and layer
-                    int unitlayer = mapiter->second;
-                    tilelayer = unitlayer & 0xFF;
-                    tileunit = (unitlayer & 0xFF00) >> 8;
-                } else if (tile->name == "wtrtyl") {
-                    // water tile
-                    tileunit = 0;
-                    tilelayer = 0;
-                } else {
-                    // else need to add it
-                    auto thistexture = assets->getBitmap(tile->name);
-                    int width = thistexture->width();
-                    // check size to see what unit it needs
-                    int i;
-                    for (i = 0; i < 8; i++) {
-                        if (terraintexturesizes[i] == width || terraintexturesizes[i] == 0) break;
-                    }
-
-                    if (i == 8) {
-                        logger->warning("Texture unit full - draw terrain!");
-                        tileunit = 0;
-                        tilelayer = 0;
-                    } else {
-                        if (terraintexturesizes[i] == 0) terraintexturesizes[i] = width;
-                        tileunit = i;
-                        tilelayer = numterraintexloaded[i];
-
-                        // encode unit and layer together
-                        int encode = (tileunit << 8) | tilelayer;
-
-                        if (numterraintexloaded[i] < 256) {
-                            // intsert into tex map
-                            terraintexmap.insert(std::make_pair(tile->name, encode));
-                            numterraintexloaded[i]++;
-                        } else {
-                            logger->warning("Texture layer full - draw terrain!");
-                            tileunit = 0;
-                            tilelayer = 0;
-                        }
-                    }
-                }
+                TextureArraySlot slot = packLevelTexture(&terrainTextureArrays, tile->name);
+                int tileunit = slot.array;
+                int tilelayer = slot.layer;
 
                 // next calculate all vertices vertices
                 unsigned norm_idx = pTerrainNormalIndices[(2 * x * 128) + (2 * y) + 2 /*+ 1*/];  // 2 is top tri // 3 is bottom
@@ -1664,48 +1619,7 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
         glEnableVertexAttribArray(4);
 
         // texture set up - load in all previously found
-        for (int unit = 0; unit < 8; unit++) {
-            assert(numterraintexloaded[unit] <= 256);
-            // skip if textures are empty
-            if (numterraintexloaded[unit] == 0) continue;
-
-            glGenTextures(1, &terraintextures[unit]);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D_ARRAY, terraintextures[unit]);
-
-            // create blank memory for later texture submission
-            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, terraintexturesizes[unit], terraintexturesizes[unit], numterraintexloaded[unit], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-
-            // loop through texture map
-            std::map<std::string, int>::iterator it = terraintexmap.begin();
-            while (it != terraintexmap.end()) {
-                int comb = it->second;
-                int tlayer = comb & 0xFF;
-                int tunit = (comb & 0xFF00) >> 8;
-
-                if (tunit == unit) {
-                    // get texture
-                    auto texture = assets->getBitmap(it->first);
-                    // send texture data to gpu
-                    glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
-                        0,
-                        0, 0, tlayer,
-                        terraintexturesizes[unit], terraintexturesizes[unit], 1,
-                        GL_RGBA,
-                        GL_UNSIGNED_BYTE,
-                        texture->rgba().pixels().data());
-                }
-
-                it++;
-            }
-
-            // last texture setups
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-            glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
-        }
+        uploadTextureArrays(terrainTextureArrays, terraintextures, GL_CLAMP_TO_EDGE);
     }
 
 /////////////////////////////////////////////////////
@@ -1718,12 +1632,9 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
             glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
     // load texture arrays in - we only use unit 0 for water and unit 1 for tiles for time being
-    for (int unit = 0; unit < 8; unit++) {
-        // skip if textures are empty
-        if (numterraintexloaded[unit] > 0) {
-            glActiveTexture(GL_TEXTURE0 + unit);
-            glBindTexture(GL_TEXTURE_2D_ARRAY, terraintextures[unit]);
-        }
+    for (int unit = 0; unit < terrainTextureArrays.arrayCount(); unit++) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, terraintextures[unit]);
     }
 
     // load terrain verts
@@ -2007,6 +1918,8 @@ void OpenGLRenderer::DrawTerrainPolygon(struct Polygon *poly, bool transparent,
 
 // TODO(pskelton): renderbase
 void OpenGLRenderer::DrawOutdoorSky() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawOutdoorSky");
+
     double rot_to_rads = ((2 * pi_double) / 2048);
 
     // lowers clouds as party goes up
@@ -2271,6 +2184,8 @@ void OpenGLRenderer::DrawOutdoorSkyPolygon(struct Polygon *pSkyPolygon) {
 }
 
 void OpenGLRenderer::DrawForcePerVerts() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawForcePerVerts");
+
     if (!forceperstorecnt) return;
 
     if (forceperVAO == 0) {
@@ -2574,6 +2489,8 @@ void OpenGLRenderer::DoRenderBillboards_D3D() {
 
 // name better
 void OpenGLRenderer::DrawBillboards() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawBillboards");
+
     if (!billbstorecnt) return;
 
     if (billbVAO == 0) {
@@ -3175,6 +3092,8 @@ void OpenGLRenderer::DrawTextNew(int x, int y, int width, int h, float u1, float
 }
 
 void OpenGLRenderer::Present() {
+    MM_PROFILE_ZONE("OpenGLRenderer::Present");
+
     // flush any undrawn items
     DrawTwodVerts();
     EndLines2D();
@@ -3226,6 +3145,8 @@ GLshaderverts *outbuildshaderstore[16] = { nullptr };
 int numoutbuildverts[16] = { 0 };
 
 void OpenGLRenderer::DrawOutdoorBuildings() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawOutdoorBuildings");
+
     // shader
     // verts are streamed to gpu as required
     // textures can be different sizes
@@ -3267,17 +3188,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
         }
 
         // reserve first 7 layers for water tiles in unit 0
-        auto wtrtexture = this->hd_water_tile_anim[0];
-        //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
-        //numterraintexloaded[0]++;
-        outbuildtexturewidths[0] = wtrtexture->width();
-        outbuildtextureheights[0] = wtrtexture->height();
-
-        for (int buff = 0; buff < 7; buff++) {
-            std::string container_name = fmt::format("HDWTR{:03}", buff);
-            outbuildtexmap.insert(std::make_pair(container_name, outbuildtexmap.size()));
-            numoutbuildtexloaded[0]++;
-        }
+        reserveWaterLayers(&outbuildTextureArrays);
 
 
 
@@ -3325,55 +3236,9 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
 
                         // loop while running down animlength with frame animtimes
                         do {
-                            // check if tile->name is already in list
-                            auto mapiter = outbuildtexmap.find(*texname);
-                            if (mapiter != outbuildtexmap.end()) {
-                                // if so, extract unit and layer
-                                int unitlayer = mapiter->second;
-                                texlayer = unitlayer & 0xFF;
-                                texunit = (unitlayer & 0xFF00) >> 8;
-                            } else if (*texname == "wtrtyl") {
-                                // water tile
-                                texunit = 0;
-                                texlayer = 0;
-                            } else {
-                                // else need to add it
-                                auto thistexture = assets->getBitmap(*texname);
-                                int width = thistexture->width();
-                                int height = thistexture->height();
-                                // check size to see what unit it needs
-                                int i;
-                                for (i = 0; i < 16; i++) {
-                                    if ((outbuildtexturewidths[i] == width && outbuildtextureheights[i] == height) || outbuildtexturewidths[i] == 0) break;
-                                }
-
-                                if (i == 16) {
-                                    logger->warning("Texture unit full - draw building!");
-                                    texunit = 0;
-                                    texlayer = 0;
-                                } else {
-                                    if (outbuildtexturewidths[i] == 0) {
-                                        outbuildtexturewidths[i] = width;
-                                        outbuildtextureheights[i] = height;
-                                    }
-
-                                    texunit = i;
-                                    texlayer = numoutbuildtexloaded[i];
-
-                                    // encode unit and layer together
-                                    int encode = (texunit << 8) | texlayer;
-
-                                    if (numoutbuildtexloaded[i] < 256) {
-                                        // intsert into tex map
-                                        outbuildtexmap.insert(std::make_pair(*texname, encode));
-                                        numoutbuildtexloaded[i]++;
-                                    } else {
-                                        logger->warning("Texture layer full - draw building!");
-                                        texunit = 0;
-                                        texlayer = 0;
-                                    }
-                                }
-                            }
+                            TextureArraySlot slot = packLevelTexture(&outbuildTextureArrays, *texname);
+                            texunit = slot.array;
+                            texlayer = slot.layer;
 
                             if (face.IsTextureFrameTable()) {
                                 // TODO(pskelton): any instances where animTime is not consistent would need checking
@@ -3420,62 +3285,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
 
         // texture set up
 
-        // loop over all units
-        for (int unit = 0; unit < 16; unit++) {
-            assert(numoutbuildtexloaded[unit] <= 256);
-            // skip if textures are empty
-            if (numoutbuildtexloaded[unit] == 0) continue;
-
-            glGenTextures(1, &outbuildtextures[unit]);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D_ARRAY, outbuildtextures[unit]);
-
-            // create blank memory for later texture submission
-            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, outbuildtexturewidths[unit], outbuildtextureheights[unit], numoutbuildtexloaded[unit], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-            std::map<std::string, int>::iterator it = outbuildtexmap.begin();
-            while (it != outbuildtexmap.end()) {
-                // skip if wtrtyl
-                //if ((it->first).substr(0, 6) == "wtrtyl") {
-                //    std::cout << "skipped  " << it->first << std::endl;
-                 //   it++;
-                 //   continue;
-                //}
-
-                int comb = it->second;
-                int tlayer = comb & 0xFF;
-                int tunit = (comb & 0xFF00) >> 8;
-
-                if (tunit == unit) {
-                    // get texture
-                    auto texture = assets->getBitmap(it->first);
-
-                    glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
-                        0,
-                        0, 0, tlayer,
-                        outbuildtexturewidths[unit], outbuildtextureheights[unit], 1,
-                        GL_RGBA,
-                        GL_UNSIGNED_BYTE,
-                        texture->rgba().pixels().data());
-                }
-
-                it++;
-            }
-
-            //iterate through terrain tex map
-            //ignore wtrtyl
-            //laod in
-
-            //auto tile = pOutdoor->getTileDescByGrid(0, 0);
-            //bool border = tile->IsWaterBorderTile();
-
-
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-            glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
-        }
+        uploadTextureArrays(outbuildTextureArrays, outbuildtextures, GL_REPEAT);
     }
 
         // else update verts - blank store
@@ -3508,12 +3318,9 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
                                 if (texlayer == -1) { // texture has been reset - see if its in the map
                                     GraphicsImage *tex = face.GetTexture();
                                     std::string *texname = tex->GetName();
-                                    auto mapiter = bsptexmap.find(*texname);
-                                    if (mapiter != bsptexmap.end()) {
-                                        // if so, extract unit and layer
-                                        int unitlayer = mapiter->second;
-                                        face.texlayer = texlayer = unitlayer & 0xFF;
-                                        face.texunit = texunit = (unitlayer & 0xFF00) >> 8;
+                                    if (TextureArraySlot slot = outbuildTextureArrays.find(*texname)) {
+                                        face.texlayer = texlayer = slot.layer;
+                                        face.texunit = texunit = slot.array;
                                     } else {
                                         logger->warning("Texture not found in map!");
                                         // TODO(pskelton): set to water for now - fountains in walls of mist
@@ -3847,6 +3654,8 @@ GLshaderverts *BSPshaderstore[16] = { nullptr };
 int numBSPverts[16] = { 0 };
 
 void OpenGLRenderer::DrawIndoorFaces() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawIndoorFaces");
+
     // void RenderOpenGL::DrawIndoorBSP() {
 
     // TODO(pskelton): might have to pass a texture width through for the waterr flow textures to size right
@@ -3889,17 +3698,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
 
             // reserve first 7 layers for water tiles in unit 0
-            auto wtrtexture = this->hd_water_tile_anim[0];
-            //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
-            //numterraintexloaded[0]++;
-            bsptexturewidths[0] = wtrtexture->width();
-            bsptextureheights[0] = wtrtexture->height();
-
-            for (int buff = 0; buff < 7; buff++) {
-                std::string container_name = fmt::format("HDWTR{:03}", buff);
-                bsptexmap.insert(std::make_pair(container_name, bsptexmap.size()));
-                bsptexloaded[0]++;
-            }
+            reserveWaterLayers(&bspTextureArrays);
 
 
             for (int test = 0; test < pIndoor->pFaces.size(); test++) {
@@ -3943,56 +3742,9 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
                 // loop while running down animlength with frame animtimes
                 do {
-                    // check if tile->name is already in list
-                    auto mapiter = bsptexmap.find(*texname);
-                    if (mapiter != bsptexmap.end()) {
-                        // if so, extract unit and layer
-                        int unitlayer = mapiter->second;
-                        // TODO(pskelton): make this a pair/struct rather than encoding
-                        texlayer = unitlayer & 0xFF;
-                        texunit = (unitlayer & 0xFF00) >> 8;
-                    } else if (*texname == "wtrtyl") {
-                        // water tile
-                        texunit = 0;
-                        texlayer = 0;
-                    } else {
-                        // else need to add it
-                        auto thistexture = assets->getBitmap(*texname);
-                        int width = thistexture->width();
-                        int height = thistexture->height();
-                        // check size to see what unit it needs
-                        int i;
-                        for (i = 0; i < 16; i++) {
-                            if ((bsptexturewidths[i] == width && bsptextureheights[i] == height) || bsptexturewidths[i] == 0) break;
-                        }
-
-                        if (i == 16) {
-                            logger->warning("Texture unit full - draw Indoor faces!");
-                            texunit = 0;
-                            texlayer = 0;
-                        } else {
-                            if (bsptexturewidths[i] == 0) {
-                                bsptexturewidths[i] = width;
-                                bsptextureheights[i] = height;
-                            }
-
-                            texunit = i;
-                            texlayer = bsptexloaded[i];
-
-                            // encode unit and layer together
-                            int encode = (texunit << 8) | texlayer;
-
-                            if (bsptexloaded[i] < 256) {
-                                // intsert into tex map
-                                bsptexmap.insert(std::make_pair(*texname, encode));
-                                bsptexloaded[i]++;
-                            } else {
-                                logger->warning("Texture layer full - draw indoor faces!");
-                                texunit = 0;
-                                texlayer = 0;
-                            }
-                        }
-                    }
+                    TextureArraySlot slot = packLevelTexture(&bspTextureArrays, *texname);
+                    texunit = slot.array;
+                    texlayer = slot.layer;
 
                     if (face->IsTextureFrameTable()) {
                         // TODO(pskelton): any instances where animTime is not consistent would need checking
@@ -4038,51 +3790,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
             // texture set up
 
-            // loop over all units
-            for (int unit = 0; unit < 16; unit++) {
-                assert(bsptexloaded[unit] <= 256);
-                // skip if textures are empty
-                if (bsptexloaded[unit] == 0) continue;
-
-                glGenTextures(1, &bsptextures[unit]);
-                glActiveTexture(GL_TEXTURE0);
-                glBindTexture(GL_TEXTURE_2D_ARRAY, bsptextures[unit]);
-                glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, bsptexturewidths[unit], bsptextureheights[unit], bsptexloaded[unit], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-
-                std::map<std::string, int>::iterator it = bsptexmap.begin();
-                while (it != bsptexmap.end()) {
-                    int comb = it->second;
-                    int tlayer = comb & 0xFF;
-                    int tunit = (comb & 0xFF00) >> 8;
-
-                    if (tunit == unit) {
-                        // get texture
-                        auto texture = assets->getBitmap(it->first);
-
-                        glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
-                            0,
-                            0, 0, tlayer,
-                            bsptexturewidths[unit], bsptextureheights[unit], 1,
-                            GL_RGBA,
-                            GL_UNSIGNED_BYTE,
-                            texture->rgba().pixels().data());
-
-                        //numterraintexloaded[0]++;
-                    }
-
-                    it++;
-                }
-
-
-
-
-                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-                glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
-            }
+            uploadTextureArrays(bspTextureArrays, bsptextures, GL_REPEAT);
         }
 
 
@@ -4191,12 +3899,9 @@ void OpenGLRenderer::DrawIndoorFaces() {
                             if (texlayer == -1) { // texture has been reset - see if its in the map
                                 GraphicsImage *tex = face->GetTexture();
                                 std::string *texname = tex->GetName();
-                                auto mapiter = bsptexmap.find(*texname);
-                                if (mapiter != bsptexmap.end()) {
-                                    // if so, extract unit and layer
-                                    int unitlayer = mapiter->second;
-                                    face->texlayer = texlayer = unitlayer & 0xFF;
-                                    face->texunit = texunit = (unitlayer & 0xFF00) >> 8;
+                                if (TextureArraySlot slot = bspTextureArrays.find(*texname)) {
+                                    face->texlayer = texlayer = slot.layer;
+                                    face->texunit = texunit = slot.array;
                                 } else {
                                     logger->warning("Texture not found in map!");
                                     // TODO(pskelton): set to water for now - fountains in walls of mist
@@ -5011,20 +4716,69 @@ void OpenGLRenderer::ReloadShaders() {
     }
 }
 
-void OpenGLRenderer::ReleaseTerrain() {
-    /*GLuint terrainVBO, terrainVAO;
-    GLuint terraintextures[8];
-    unsigned numterraintexloaded[8];
-    unsigned terraintexturesizes[8];
-    std::map<std::string, int> terraintexmap;*/
+void OpenGLRenderer::reserveWaterLayers(TextureArrayAllocator *allocator) {
+    assert(allocator->arrayCount() == 0);
+
+    Sizei size = hd_water_tile_anim[0]->size();
+    for (int buff = 0; buff < 7; buff++)
+        allocator->insert(fmt::format("HDWTR{:03}", buff), size);
+}
+
+TextureArraySlot OpenGLRenderer::packLevelTexture(TextureArrayAllocator *allocator, const std::string &name) {
+    if (TextureArraySlot slot = allocator->find(name))
+        return slot;
+
+    // Water tiles are drawn from the reserved water layers.
+    if (name == "wtrtyl")
+        return {0, 0};
+
+    TextureArraySlot slot = allocator->insert(name, assets->getBitmap(name)->size());
+    if (!slot) {
+        logger->warning("No room for level texture '{}' in texture arrays", name);
+        return {0, 0};
+    }
+    return slot;
+}
+
+void OpenGLRenderer::uploadTextureArrays(const TextureArrayAllocator &allocator, GLuint *textures, GLint wrap) {
+    for (int unit = 0; unit < allocator.arrayCount(); unit++) {
+        Sizei size = allocator.arraySize(unit);
+
+        glGenTextures(1, &textures[unit]);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, textures[unit]);
 
-    terraintexmap.clear();
+        // create blank memory for later texture submission
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, size.w, size.h, allocator.layerCount(unit), 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+        const std::vector<std::string> &layers = allocator.layers(unit);
+        for (int layer = 0; layer < static_cast<int>(layers.size()); layer++) {
+            if (layers[layer].empty())
+                continue;
+
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
+                0,
+                0, 0, layer,
+                size.w, size.h, 1,
+                GL_RGBA,
+                GL_UNSIGNED_BYTE,
+                assets->getBitmap(layers[layer])->rgba().pixels().data());
+        }
+
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, wrap);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, wrap);
+        glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    }
+}
+
+void OpenGLRenderer::ReleaseTerrain() {
+    terrainTextureArrays.clear();
 
     for (int i = 0; i < 8; i++) {
         glDeleteTextures(1, &terraintextures[i]);
         terraintextures[i] = 0;
-        numterraintexloaded[i] = 0;
-        terraintexturesizes[i] = 0;
     }
 
     glDeleteBuffers(1, &terrainVBO);
@@ -5033,21 +4787,11 @@ void OpenGLRenderer::ReleaseTerrain() {
     terrainVBO = 0;
     terrainVAO = 0;
 
-    /*GLuint outbuildVBO, outbuildVAO;
-    GLuint outbuildtextures[8];
-    unsigned numoutbuildtexloaded[8];
-    unsigned outbuildtexturewidths[8];
-    unsigned outbuildtextureheights[8];
-    std::map<std::string, int> outbuildtexmap;*/
-
-    outbuildtexmap.clear();
+    outbuildTextureArrays.clear();
 
     for (int i = 0; i < 16; i++) {
         glDeleteTextures(1, &outbuildtextures[i]);
         outbuildtextures[i] = 0;
-        numoutbuildtexloaded[i] = 0;
-        outbuildtexturewidths[i] = 0;
-        outbuildtextureheights[i] = 0;
         glDeleteBuffers(1, &outbuildVBO[i]);
         glDeleteVertexArrays(1, &outbuildVAO[i]);
         outbuildVBO[i] = 0;
@@ -5060,21 +4804,11 @@ void OpenGLRenderer::ReleaseTerrain() {
 }
 
 void OpenGLRenderer::ReleaseBSP() {
-    /*GLuint bspVBO, bspVAO;
-    GLuint bsptextures[16];
-    unsigned bsptexloaded[16];
-    unsigned bsptexturewidths[16];
-    unsigned bsptextureheights[16];
-    std::map<std::string, int> bsptexmap;*/
-
-    bsptexmap.clear();
+    bspTextureArrays.clear();
 
     for (int i = 0; i < 16; i++) {
         glDeleteTextures(1, &bsptextures[i]);
         bsptextures[i] = 0;
-        bsptexloaded[i] = 0;
-        bsptexturewidths[i] = 0;
-        bsptextureheights[i] = 0;
         glDeleteBuffers(1, &bspVBO[i]);
         glDeleteVertexArrays(1, &bspVAO[i]);
         bspVAO[i] = 0;
@@ -5088,6 +4822,8 @@ void OpenGLRenderer::ReleaseBSP() {
 
 
 void OpenGLRenderer::DrawTwodVerts() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawTwodVerts");
+
     if (!twodvertscnt) return;
 
     int savex = this->clip_x;
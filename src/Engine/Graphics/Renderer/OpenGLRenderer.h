@@ -2,7 +2,6 @@
 
 #include <memory>
 #include <string>
-#include <map>
 #include <vector>
 
 #include <glad/gl.h> // NOLINT: this is not a C system include.
@@ -12,6 +11,7 @@
 #include "BaseRenderer.h"
 
 #include "Library/Color/Colorf.h"
+#include "Library/Image/TextureArrayAllocator.h"
 
 #include "OpenGLShader.h"
 
@@ -148,6 +148,31 @@ class OpenGLRenderer : public BaseRenderer {
 
     void SetFogParametersGL();
 
+    /**
+     * Reserves the first layers of the first texture array for the animated water tiles. Level shaders sample water
+     * from these layers directly.
+     *
+     * @param allocator                 Empty texture array allocator.
+     */
+    void reserveWaterLayers(TextureArrayAllocator *allocator);
+
+    /**
+     * @param allocator                 Texture array allocator for a level shader.
+     * @param name                      Name of a level texture.
+     * @return                          Slot of the provided texture, packing it if it's not yet there. Falls back to
+     *                                  the first water layer if there is no room for it.
+     */
+    TextureArraySlot packLevelTexture(TextureArrayAllocator *allocator, const std::string &name);
+
+    /**
+     * Creates the texture arrays & uploads all the textures packed into the provided allocator.
+     *
+     * @param allocator                 Texture array allocator.
+     * @param[out] textures             Texture array ids, indexed by array index.
+     * @param wrap                      Texture wrapping mode.
+     */
+    void uploadTextureArrays(const TextureArrayAllocator &allocator, GLuint *textures, GLint wrap);
+
     FrameLimiter _frameLimiter;
 
     // these are the view and projection matrices for submission to shaders
@@ -185,25 +210,17 @@ class OpenGLRenderer : public BaseRenderer {
     GLuint terrainVBO{}, terrainVAO{};
     // all terrain textures are square
     GLuint terraintextures[8]{};
-    unsigned int numterraintexloaded[8]{};
-    unsigned int terraintexturesizes[8]{};
-    std::map<std::string, int> terraintexmap;
+    TextureArrayAllocator terrainTextureArrays = TextureArrayAllocator(8, 256);
 
     // outside building shader
     GLuint outbuildVBO[16]{}, outbuildVAO[16]{};
     GLuint outbuildtextures[16]{};
-    unsigned int numoutbuildtexloaded[16]{};
-    unsigned int outbuildtexturewidths[16]{};
-    unsigned int outbuildtextureheights[16]{};
-    std::map<std::string, int> outbuildtexmap;
+    TextureArrayAllocator outbuildTextureArrays = TextureArrayAllocator(16, 256);
 
     // indoors bsp shader
     GLuint bspVBO[16]{}, bspVAO[16]{};
     GLuint bsptextures[16]{};
-    unsigned int bsptexloaded[16]{};
-    unsigned int bsptexturewidths[16]{};
-    unsigned int bsptextureheights[16]{};
-    std::map<std::string, int> bsptexmap;
+    TextureArrayAllocator bspTextureArrays = TextureArrayAllocator(16, 256);
 
     // text shader
     GLuint textVBO{}, textVAO{};
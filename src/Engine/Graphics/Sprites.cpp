@@ -3,6 +3,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <string>
+#include <vector>
 
 #include "Engine/OurMath.h"
 #include "Engine/Graphics/DecorationList.h"
@@ -29,10 +31,105 @@ void SpriteFrameTable::ResetLoadedFlags() {
         spriteFrame.uFlags &= ~0x80;
 }
 
+/**
+ * @param frame                         Sprite frame.
+ * @param uFlags                        Flags of the first frame in the frame sequence, these define how the sprite
+ *                                      names are constructed for the whole sequence.
+ * @return                              Names of the sprites for the 8 view directions of the provided frame.
+ */
+static std::array<std::string, 8> spriteFrameNames(const SpriteFrame &frame, int uFlags) {
+    std::array<std::string, 8> result;
+
+    if (uFlags & 0x10) {  // single frame per frame sequence
+        result.fill(frame.texture_name);
+    } else if (uFlags & 0x10000) {
+        for (unsigned i = 0; i < 8; ++i) {
+            switch (i) {
+                case 3:
+                case 4:
+                case 5:
+                    result[i] = frame.texture_name + "4";
+                    break;
+                case 2:
+                case 6:
+                    result[i] = frame.texture_name + "2";
+                    break;
+                case 0:
+                case 1:
+                case 7:
+                    result[i] = frame.texture_name + "0";
+                    break;
+            }
+        }
+    } else if (uFlags & 0x40) {  // part of monster fidgeting seq
+        for (unsigned i = 0; i < 8; ++i) {
+            switch (i) {
+                case 0:
+                    result[i] = frame.texture_name + "0";
+                    break;
+                case 4:
+                    result[i] = frame.texture_name;
+                    result[i].erase(result[i].size() - 3, 3);
+                    result[i] = result[i] + "stA4";
+                    break;
+                case 3:
+                case 5:
+                    result[i] = frame.texture_name;
+                    result[i].erase(result[i].size() - 3, 3);
+                    result[i] = result[i] + "stA3";
+                    break;
+                case 2:
+                case 6:
+                    result[i] = frame.texture_name + "2";
+                    break;
+                case 1:
+                case 7:
+                    result[i] = frame.texture_name + "1";
+                    break;
+            }
+        }
+    } else {
+        for (unsigned i = 0; i < 8; ++i) {
+            if (((0x0100 << i) & frame.uFlags)) {  // mirrors
+                switch (i) {
+                    case 1:
+                        result[i] = frame.texture_name + "7";
+                        break;
+                    case 2:
+                        result[i] = frame.texture_name + "6";
+                        break;
+                    case 3:
+                        result[i] = frame.texture_name + "5";
+                        break;
+                    case 4:
+                        result[i] = frame.texture_name + "4";
+                        break;
+                    case 5:
+                        result[i] = frame.texture_name + "3";
+                        break;
+                    case 6:
+                        result[i] = frame.texture_name + "2";
+                        break;
+                    case 7:
+                        result[i] = frame.texture_name + "1";
+                        break;
+                }
+            } else {
+                // some names already passed through with codes attached
+                if (frame.texture_name.size() < 7) {
+                    result[i] = fmt::format("{}{}", frame.texture_name, i);
+                } else {
+                    result[i] = frame.texture_name;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
 //----- (0044D513) --------------------------------------------------------
 void SpriteFrameTable::InitializeSprite(signed int uSpriteID) {
-    std::string spriteName;
-
     if (uSpriteID <= pSpriteSFrames.size()) {
         if (uSpriteID >= 0) {
             unsigned iter_uSpriteID = uSpriteID;
@@ -46,105 +143,16 @@ void SpriteFrameTable::InitializeSprite(signed int uSpriteID) {
                 while (1) {
                     pSpriteSFrames[iter_uSpriteID].ResetPaletteIndex(pPaletteManager->paletteIndex(pSpriteSFrames[iter_uSpriteID].uPaletteID));
 
+                    std::array<std::string, 8> spriteNames = spriteFrameNames(pSpriteSFrames[iter_uSpriteID], uFlags);
                     if (uFlags & 0x10) {  // single frame per frame sequence
-                        Sprite *sprite = pSprites_LOD->loadSprite(pSpriteSFrames[iter_uSpriteID].texture_name);
+                        Sprite *sprite = pSprites_LOD->loadSprite(spriteNames[0]);
                         if (sprite == nullptr)
-                            logger->warning("Sprite {} not loaded!", pSpriteSFrames[iter_uSpriteID].texture_name);
+                            logger->warning("Sprite {} not loaded!", spriteNames[0]);
                         for (unsigned i = 0; i < 8; ++i)
                             pSpriteSFrames[iter_uSpriteID].hw_sprites[i] = sprite;
-                    } else if (uFlags & 0x10000) {
-                        for (unsigned i = 0; i < 8; ++i) {
-                            switch (i) {
-                                case 3:
-                                case 4:
-                                case 5:
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "4";
-                                    break;
-                                case 2:
-                                case 6:
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "2";
-                                    break;
-                                case 0:
-                                case 1:
-                                case 7:
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "0";
-                                    break;
-                            }
-                            Sprite *sprite = pSprites_LOD->loadSprite(spriteName);
-                            // pSpriteSFrames[iter_uSpriteID].pHwSpriteIDs[i]=v12;
-                            assert(sprite);
-                            pSpriteSFrames[iter_uSpriteID].hw_sprites[i] = sprite;
-                        }
-
-                    } else if (uFlags & 0x40) {  // part of monster fidgeting seq
-                        for (unsigned i = 0; i < 8; ++i) {
-                            switch (i) {
-                                case 0:
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "0";
-                                    break;
-                                case 4:
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name;
-                                    spriteName.erase(spriteName.size() - 3, 3);
-                                    spriteName = spriteName + "stA4";
-                                    break;
-                                case 3:
-                                case 5:
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name;
-                                    spriteName.erase(spriteName.size() - 3, 3);
-                                    spriteName = spriteName + "stA3";
-                                    break;
-                                case 2:
-                                case 6:
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "2";
-                                    break;
-                                case 1:
-                                case 7:
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "1";
-                                    break;
-                            }
-                            Sprite *sprite = pSprites_LOD->loadSprite(spriteName);
-                            // pSpriteSFrames[iter_uSpriteID].pHwSpriteIDs[i]=v12;
-                            assert(sprite);
-                            pSpriteSFrames[iter_uSpriteID].hw_sprites[i] = sprite;
-                        }
                     } else {
                         for (unsigned i = 0; i < 8; ++i) {
-                            if (((0x0100 << i) & pSpriteSFrames[iter_uSpriteID].uFlags)) {  // mirrors
-                                switch (i) {
-                                    case 1:
-                                        spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "7";
-                                        break;
-                                    case 2:
-                                        spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "6";
-                                        break;
-                                    case 3:
-                                        spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "5";
-                                        break;
-                                    case 4:
-                                        spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "4";
-                                        break;
-                                    case 5:
-                                        spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "3";
-                                        break;
-                                    case 6:
-                                        spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "2";
-                                        break;
-                                    case 7:
-                                        spriteName = pSpriteSFrames[iter_uSpriteID].texture_name + "1";
-                                        break;
-                                }
-                            } else {
-                                // some names already passed through with codes attached
-                                if (pSpriteSFrames[iter_uSpriteID].texture_name.size() < 7) {
-                                    spriteName = fmt::format("{}{}", pSpriteSFrames[iter_uSpriteID].texture_name, i);
-                                } else {
-                                    spriteName = pSpriteSFrames[iter_uSpriteID].texture_name;
-                                    // assert(false);
-                                }
-                            }
-
-                            Sprite *sprite = pSprites_LOD->loadSprite(spriteName);
-                            // pSpriteSFrames[iter_uSpriteID].pHwSpriteIDs[i]=v12;
+                            Sprite *sprite = pSprites_LOD->loadSprite(spriteNames[i]);
                             assert(sprite);
                             pSpriteSFrames[iter_uSpriteID].hw_sprites[i] = sprite;
                         }
@@ -160,6 +168,28 @@ void SpriteFrameTable::InitializeSprite(signed int uSpriteID) {
     }
 }
 
+void SpriteFrameTable::prefetchSprites(std::span<const int> spriteIds) {
+    std::vector<std::string> names;
+    for (int spriteId : spriteIds) {
+        if (spriteId < 0 || spriteId >= static_cast<int>(pSpriteSFrames.size()))
+            continue;
+
+        int uFlags = pSpriteSFrames[spriteId].uFlags;
+        if (uFlags & 0x0080)
+            continue; // Already loaded.
+
+        // Same frame walk as in InitializeSprite.
+        for (int frameId = spriteId; frameId < static_cast<int>(pSpriteSFrames.size()); frameId++) {
+            for (std::string &name : spriteFrameNames(pSpriteSFrames[frameId], uFlags))
+                names.push_back(std::move(name));
+            if (!(pSpriteSFrames[frameId].uFlags & 1))
+                break;
+        }
+    }
+
+    pSprites_LOD->prefetch(names);
+}
+
 //----- (0044D813) --------------------------------------------------------
 int SpriteFrameTable::FastFindSprite(std::string_view pSpriteName) {
     auto cmp = [this] (uint16_t index, std::string_view name) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -54,6 +55,14 @@ struct SpriteFrameTable {
     void ResetLoadedFlags();
     void InitializeSprite(signed int uSpriteID);
 
+    /**
+     * Starts decoding all the images for the provided sprites in the background, so that the subsequent
+     * `InitializeSprite` calls don't have to. Does not mark the sprites as loaded.
+     *
+     * @param spriteIds                 Indices into `pSpriteSFrames`.
+     */
+    void prefetchSprites(std::span<const int> spriteIds);
+
     /**
      * @param pSpriteName               Name of the sprite to find. Names are case-insensitive.
      * @return                          Index in `pSpriteSFrames` for the sprite, or 0 if sprite wasn't found.
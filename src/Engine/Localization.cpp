@@ -27,11 +27,11 @@ bool Localization::Initialize() {
 
     this->localization_strings = new const char *[MAX_LOC_STRINGS]();
 
-    strtok(this->localization_raw.data(), "\r");
-    strtok(NULL, "\r");
+    strtokThreadLocal(this->localization_raw.data(), "\r");
+    strtokThreadLocal(NULL, "\r");
 
     for (int i = 0; i < MM7_LOC_STRINGS; ++i) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        char *test_string = strtokThreadLocal(NULL, "\r") + 1;
         step = 0;
         string_end = false;
         do {
@@ -275,9 +275,9 @@ void Localization::InitializeSkillNames() {
     //    "So don't expect to become thwonking killer and devastating anyone beyond weaklings.";
 
     skill_desc_raw = engine->_gameResourceManager->getEventsFile("skilldes.txt").string_view();
-    strtok(skill_desc_raw.data(), "\r");
+    strtokThreadLocal(skill_desc_raw.data(), "\r");
     for (CharacterSkillType i : allVisibleSkills()) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        char *test_string = strtokThreadLocal(NULL, "\r") + 1;
 
         if (test_string != NULL && strlen(test_string) > 0) {
             auto tokens = tokenize(test_string, '\t');
@@ -339,9 +339,9 @@ void Localization::InitializeClassNames() {
     this->class_names[CLASS_LICH] = this->localization_strings[49];   // Lich
 
     this->class_desc_raw = engine->_gameResourceManager->getEventsFile("class.txt").string_view();
-    strtok(this->class_desc_raw.data(), "\r");
+    strtokThreadLocal(this->class_desc_raw.data(), "\r");
     for (CharacterClass i : class_desciptions.indices()) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        char *test_string = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(test_string, '\t');
         assert(tokens.size() == 3 && "Invalid number of tokens");
         class_desciptions[i] = removeQuotes(tokens[1]);
@@ -417,9 +417,9 @@ void Localization::InitializeAttributeNames() {
     this->attribute_names[CHARACTER_ATTRIBUTE_LUCK]         = this->localization_strings[136];
 
     this->attribute_desc_raw = engine->_gameResourceManager->getEventsFile("stats.txt").string_view();
-    strtok(this->attribute_desc_raw.data(), "\r");
+    strtokThreadLocal(this->attribute_desc_raw.data(), "\r");
     for (int i = 0; i < 26; ++i) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        char *test_string = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(test_string, '\t');
         assert(tokens.size() == 2 && "Invalid number of tokens");
         switch (i) {
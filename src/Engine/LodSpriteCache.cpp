@@ -1,5 +1,6 @@
 #include "LodSpriteCache.h"
 
+#include <algorithm>
 #include <vector>
 #include <utility>
 
@@ -7,6 +8,7 @@
 
 #include "Utility/String.h"
 #include "Utility/MapAccess.h"
+#include "Utility/ThreadPool.h"
 
 #include "AssetsManager.h"
 
@@ -36,10 +38,14 @@ void LodSpriteCache::reserveLoadedSprites() {  // final init
 }
 
 void LodSpriteCache::releaseUnreserved() {
+    // Decoding tasks hold their own data, dropping the futures doesn't block.
+    _pendingByName.clear();
+
     while (_spritesInOrder.size() > _reservedCount) {
         const std::string &name = _spritesInOrder.back();
         _spriteByName[name].Release();
         _spriteByName.erase(name);
+        _lastUseByName.erase(name);
         _spritesInOrder.pop_back();
     }
 }
@@ -48,8 +54,13 @@ Sprite *LodSpriteCache::loadSprite(const std::string &pContainerName) {
     std::string name = toLower(pContainerName);
 
     Sprite *result = valuePtr(_spriteByName, name);
-    if (result)
+    if (result) {
+        _lastUseByName[name] = ++_useClock;
+        _usedSprites.insert(name);
+        if (!result->sprite_header->bitmap) // Evicted in `trim`, need to decode again.
+            LoadSpriteFromFile(result->sprite_header, name);
         return result;
+    }
 
     std::unique_ptr<LODSprite> header = std::make_unique<LODSprite>();
     if (!LoadSpriteFromFile(header.get(), name))
@@ -62,14 +73,70 @@ Sprite *LodSpriteCache::loadSprite(const std::string &pContainerName) {
     sprite.texture = assets->getSprite(pContainerName); // TODO(captainurist): very weird dependency here.
     sprite.sprite_header = header.release();
     _spritesInOrder.push_back(name);
+    _lastUseByName[name] = ++_useClock;
+    _usedSprites.insert(name);
     return &sprite;
 }
 
-bool LodSpriteCache::LoadSpriteFromFile(LODSprite *pSprite, const std::string &pContainer) {
-    if (!_reader.exists(pContainer))
-        return false;
+std::vector<std::string> LodSpriteCache::usedSprites() const {
+    std::vector<std::string> result(_usedSprites.begin(), _usedSprites.end());
+    std::ranges::sort(result);
+    return result;
+}
+
+void LodSpriteCache::resetUsedSprites() {
+    _usedSprites.clear();
+}
+
+void LodSpriteCache::trim(size_t cpuBudget) {
+    if (cpuBudget == 0)
+        return; // No limit, don't even bother computing the usage.
+
+    CacheUsage total = usage();
+    if (total.cpuBytes <= cpuBudget)
+        return;
 
-    LodSprite sprite = lod::decodeSprite(_reader.read(pContainer));
+    std::vector<LruCandidate<Sprite *>> candidates;
+    for (auto &[name, sprite] : _spriteByName)
+        if (sprite.sprite_header->bitmap)
+            candidates.push_back({&sprite, _lastUseByName[name], sprite.sprite_header->bitmap.pixels().size_bytes()});
+
+    for (Sprite *sprite : selectLruVictims(std::move(candidates), total.cpuBytes, cpuBudget))
+        sprite->sprite_header->bitmap.reset();
+}
+
+CacheUsage LodSpriteCache::usage() const {
+    CacheUsage result;
+    result.entries = _spriteByName.size();
+    for (const auto &[_, sprite] : _spriteByName)
+        result.cpuBytes += sprite.sprite_header->bitmap.pixels().size_bytes();
+    return result;
+}
+
+void LodSpriteCache::prefetch(std::span<const std::string> names) {
+    for (const std::string &pContainer : names) {
+        std::string name = toLower(pContainer);
+        if (_spriteByName.contains(name) || _pendingByName.contains(name) || !_reader.exists(name))
+            continue;
+
+        // Reading is cheap, the LOD is memory-mapped. It's decoding that takes time.
+        _pendingByName.emplace(name, ThreadPool::shared().submit([data = _reader.read(name)] {
+            return lod::decodeSprite(data);
+        }));
+    }
+}
+
+bool LodSpriteCache::LoadSpriteFromFile(LODSprite *pSprite, const std::string &pContainer) {
+    LodSprite sprite;
+    if (auto pending = _pendingByName.find(pContainer); pending != _pendingByName.end()) {
+        std::future<LodSprite> future = std::move(pending->second);
+        _pendingByName.erase(pending);
+        sprite = future.get(); // Rethrows decoding errors, if any.
+    } else {
+        if (!_reader.exists(pContainer))
+            return false;
+        sprite = lod::decodeSprite(_reader.read(pContainer));
+    }
     pSprite->name = pContainer;
     pSprite->bitmap = std::move(sprite.image);
 
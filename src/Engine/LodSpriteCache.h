@@ -1,7 +1,10 @@
 #pragma once
 
+#include <future>
 #include <string>
+#include <span>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -9,6 +12,9 @@
 
 #include "Library/Image/Image.h"
 #include "Library/Lod/LodReader.h"
+#include "Library/LodFormats/LodFormats.h"
+
+#include "Utility/CacheBudget.h"
 
 class LodReader;
 
@@ -31,6 +37,38 @@ class LodSpriteCache {
 
     Sprite *loadSprite(const std::string &pContainerName);
 
+    /**
+     * Starts decoding the provided sprites on the shared thread pool. A subsequent `loadSprite` call for any of these
+     * sprites picks up the decoded image instead of decoding it on the calling thread.
+     *
+     * Sprites that are already loaded or that don't exist in this LOD are skipped.
+     *
+     * @param names                     Names of the sprites to prefetch.
+     */
+    void prefetch(std::span<const std::string> names);
+
+    /**
+     * @return                          Names of all the sprites that were requested through `loadSprite` since the
+     *                                  last `resetUsedSprites` call, sorted.
+     */
+    [[nodiscard]] std::vector<std::string> usedSprites() const;
+    void resetUsedSprites();
+
+    /**
+     * Frees the decoded images of the least recently used sprites until the decoded data fits into the provided
+     * budget. `Sprite` objects themselves are never evicted as they are referenced from the sprite frame table, evicted
+     * images are decoded again on the next `loadSprite` call.
+     *
+     * @param cpuBudget                 Max size of the decoded sprite data, in bytes. Zero means no limit.
+     */
+    void trim(size_t cpuBudget);
+
+    /**
+     * @return                          Memory used by this cache. Sprite textures are owned by `AssetsManager`, so
+     *                                  `gpuBytes` is always zero.
+     */
+    [[nodiscard]] CacheUsage usage() const;
+
  private:
     bool LoadSpriteFromFile(LODSprite *pSpriteHeader, const std::string &pContainer);
 
@@ -39,6 +77,10 @@ class LodSpriteCache {
     int _reservedCount = 0;
     std::unordered_map<std::string, Sprite> _spriteByName;
     std::vector<std::string> _spritesInOrder;
+    std::unordered_map<std::string, uint64_t> _lastUseByName;
+    uint64_t _useClock = 0;
+    std::unordered_map<std::string, std::future<LodSprite>> _pendingByName;
+    std::unordered_set<std::string> _usedSprites;
 };
 
 extern LodSpriteCache *pSprites_LOD;
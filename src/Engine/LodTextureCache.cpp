@@ -1,12 +1,15 @@
 #include "LodTextureCache.h"
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "Library/LodFormats/LodFormats.h"
 
 #include "Utility/Streams/BlobInputStream.h"
 #include "Utility/String.h"
 #include "Utility/MapAccess.h"
+#include "Utility/ThreadPool.h"
 
 LodTextureCache *pIcons_LOD = nullptr;
 LodTextureCache *pIcons_LOD_mm6 = nullptr;
@@ -32,10 +35,14 @@ void LodTextureCache::reserveLoadedTextures() {
 }
 
 void LodTextureCache::releaseUnreserved() {
+    // Decoding tasks hold their own data, dropping the futures doesn't block.
+    _pendingByName.clear();
+
     while (_texturesInOrder.size() > _reservedCount) {
         const std::string &name = _texturesInOrder.back();
         _textureByName[name].Release();
         _textureByName.erase(name);
+        _lastUseByName.erase(name);
         _texturesInOrder.pop_back();
     }
 }
@@ -44,12 +51,17 @@ Texture_MM7 *LodTextureCache::loadTexture(const std::string &pContainer, bool us
     std::string name = toLower(pContainer);
 
     Texture_MM7 *result = valuePtr(_textureByName, name);
-    if (result)
+    if (result) {
+        _lastUseByName[name] = ++_useClock;
+        _usedTextures.insert(name);
         return result;
+    }
 
     result = &_textureByName[name];
     if (LoadTextureFromLOD(result, name)) {
         _texturesInOrder.push_back(name);
+        _lastUseByName[name] = ++_useClock;
+        _usedTextures.insert(name);
         return result;
     }
     _textureByName.erase(name);
@@ -61,15 +73,82 @@ Texture_MM7 *LodTextureCache::loadTexture(const std::string &pContainer, bool us
     }
 }
 
+void LodTextureCache::prefetch(std::span<const std::string> names) {
+    for (const std::string &pContainer : names) {
+        std::string name = toLower(pContainer);
+        if (_textureByName.contains(name) || _pendingByName.contains(name) || !_reader.exists(name))
+            continue;
+
+        // Reading is cheap, the LOD is memory-mapped. It's decoding that takes time.
+        _pendingByName.emplace(name, ThreadPool::shared().submit([data = _reader.read(name)] {
+            return lod::decodeImage(data);
+        }));
+    }
+}
+
+std::vector<std::string> LodTextureCache::usedTextures() const {
+    std::vector<std::string> result(_usedTextures.begin(), _usedTextures.end());
+    std::ranges::sort(result);
+    return result;
+}
+
+void LodTextureCache::resetUsedTextures() {
+    _usedTextures.clear();
+}
+
+void LodTextureCache::trim(size_t cpuBudget) {
+    if (cpuBudget == 0)
+        return; // No limit, don't even bother computing the usage.
+
+    CacheUsage total = usage();
+    if (total.cpuBytes <= cpuBudget)
+        return;
+
+    std::vector<LruCandidate<std::string>> candidates;
+    for (const auto &[name, texture] : _textureByName)
+        candidates.push_back({name, _lastUseByName[name], texture.indexed.pixels().size_bytes()});
+
+    for (const std::string &name : selectLruVictims(std::move(candidates), total.cpuBytes, cpuBudget))
+        evict(name);
+}
+
+CacheUsage LodTextureCache::usage() const {
+    CacheUsage result;
+    result.entries = _textureByName.size();
+    for (const auto &[_, texture] : _textureByName)
+        result.cpuBytes += texture.indexed.pixels().size_bytes();
+    return result;
+}
+
+void LodTextureCache::evict(const std::string &name) {
+    _textureByName[name].Release();
+    _textureByName.erase(name);
+    _lastUseByName.erase(name);
+
+    // Keep the reserved textures at the front of the list.
+    auto pos = std::ranges::find(_texturesInOrder, name);
+    if (pos == _texturesInOrder.end())
+        return;
+    if (pos - _texturesInOrder.begin() < _reservedCount)
+        _reservedCount--;
+    _texturesInOrder.erase(pos);
+}
+
 Blob LodTextureCache::LoadCompressedTexture(const std::string &pContainer) {
     return lod::decodeCompressed(_reader.read(pContainer));
 }
 
 bool LodTextureCache::LoadTextureFromLOD(Texture_MM7 *pOutTex, const std::string &pContainer) {
-    if (!_reader.exists(pContainer))
-        return false;
-
-    LodImage image = lod::decodeImage(_reader.read(pContainer));
+    LodImage image;
+    if (auto pending = _pendingByName.find(pContainer); pending != _pendingByName.end()) {
+        std::future<LodImage> future = std::move(pending->second);
+        _pendingByName.erase(pending);
+        image = future.get(); // Rethrows decoding errors, if any.
+    } else {
+        if (!_reader.exists(pContainer))
+            return false;
+        image = lod::decodeImage(_reader.read(pContainer));
+    }
 
     pOutTex->name = pContainer;
     pOutTex->indexed = std::move(image.image);
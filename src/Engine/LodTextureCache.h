@@ -1,15 +1,20 @@
 #pragma once
 
+#include <future>
 #include <string>
 #include <memory>
+#include <span>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "Engine/Graphics/Texture_MM7.h"
 
 #include "Library/Lod/LodReader.h"
+#include "Library/LodFormats/LodFormats.h"
 
 #include "Utility/Memory/Blob.h"
+#include "Utility/CacheBudget.h"
 
 class LodReader;
 
@@ -25,16 +30,53 @@ class LodTextureCache {
 
     Texture_MM7 *loadTexture(const std::string &pContainer, bool useDummyOnError = true);
 
+    /**
+     * Starts decoding the provided textures on the shared thread pool. A subsequent `loadTexture` call for any of
+     * these textures picks up the decoded image instead of decoding it on the calling thread.
+     *
+     * Textures that are already loaded or that don't exist in this LOD are skipped.
+     *
+     * @param names                     Names of the textures to prefetch.
+     */
+    void prefetch(std::span<const std::string> names);
+
+    /**
+     * @return                          Names of all the textures that were requested through `loadTexture` since the
+     *                                  last `resetUsedTextures` call, sorted.
+     */
+    [[nodiscard]] std::vector<std::string> usedTextures() const;
+    void resetUsedTextures();
+
+    /**
+     * Evicts the least recently used textures until the decoded data fits into the provided budget. Evicted textures
+     * are decoded again on the next `loadTexture` call, so pointers returned from `loadTexture` must not be held onto
+     * across calls to this function.
+     *
+     * @param cpuBudget                 Max size of the decoded texture data, in bytes. Zero means no limit.
+     */
+    void trim(size_t cpuBudget);
+
+    /**
+     * @return                          Memory used by this cache. This cache doesn't upload anything to the GPU, so
+     *                                  `gpuBytes` is always zero.
+     */
+    [[nodiscard]] CacheUsage usage() const;
+
     Blob LoadCompressedTexture(const std::string &pContainer); // TODO(captainurist): doesn't belong here.
 
  private:
     bool LoadTextureFromLOD(struct Texture_MM7 *pOutTex, const std::string &pContainer);
+    void evict(const std::string &name);
 
  private:
     LodReader _reader;
     int _reservedCount = 0;
     std::unordered_map<std::string, Texture_MM7> _textureByName;
     std::vector<std::string> _texturesInOrder;
+    std::unordered_map<std::string, uint64_t> _lastUseByName;
+    uint64_t _useClock = 0;
+    std::unordered_map<std::string, std::future<LodImage>> _pendingByName;
+    std::unordered_set<std::string> _usedTextures;
 };
 
 extern LodTextureCache *pIcons_LOD;
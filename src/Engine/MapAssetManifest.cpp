@@ -0,0 +1,123 @@
+#include "MapAssetManifest.h"
+
+#include <exception>
+#include <filesystem>
+#include <utility>
+
+#include "Engine/LodSpriteCache.h"
+#include "Engine/LodTextureCache.h"
+
+#include "Media/Audio/AudioPlayer.h"
+
+#include "Library/Binary/BinarySerialization.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Streams/TempFileOutputStream.h"
+#include "Utility/Memory/Blob.h"
+#include "Utility/DataPath.h"
+#include "Utility/Exception.h"
+
+MM_DECLARE_MEMCOPY_SERIALIZABLE(SoundId)
+
+// Bump this when changing the file format, this will invalidate all the cached files.
+static constexpr uint32_t MANIFEST_VERSION = 2;
+
+static std::string capturedMapName; // Empty if not capturing.
+static MapAssetManifest capturedManifest; // Manifest that was loaded for `capturedMapName`.
+
+static std::string manifestPath(const std::string &mapName) {
+    return makeDataPath("cache", mapName + ".assets");
+}
+
+static MapAssetManifest loadManifest(const std::string &path) {
+    if (!std::filesystem::exists(path))
+        return {}; // First visit, nothing to prefetch.
+
+    try {
+        return fromBlob<MapAssetManifest>(Blob::fromFile(path));
+    } catch (const std::exception &e) {
+        logger->info("Could not read asset manifest '{}', ignoring: {}", path, e.what());
+        return {};
+    }
+}
+
+static void saveManifest(const MapAssetManifest &manifest, const std::string &path) {
+    try {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        TempFileOutputStream stream(path);
+        serialize(manifest, &stream);
+        stream.close();
+    } catch (const std::exception &e) {
+        logger->warning("Could not write asset manifest '{}': {}", path, e.what());
+    }
+}
+
+void serialize(const MapAssetManifest &src, OutputStream *dst) {
+    serialize(MANIFEST_VERSION, dst);
+    serialize(src.textures, dst);
+    serialize(src.sprites, dst);
+    serialize(src.sounds, dst);
+}
+
+void deserialize(InputStream &src, MapAssetManifest *dst) {
+    uint32_t version = 0;
+    deserialize(src, &version);
+    if (version != MANIFEST_VERSION)
+        throw Exception("Unsupported asset manifest version {}", version);
+
+    MapAssetManifest result;
+    deserialize(src, &result.textures);
+    deserialize(src, &result.sprites);
+    deserialize(src, &result.sounds);
+    *dst = std::move(result);
+}
+
+void beginMapAssetCapture(const std::string &mapName) {
+    // Travel between outdoor maps doesn't go through `Engine::ResetCursor_Palettes_LODs_Level_Audio_SFT_Windows`, and
+    // the assets of the previous map are not released. So the recorder is reset here, and not on release.
+    finishMapAssetCapture();
+
+    MapAssetManifest manifest = loadManifest(manifestPath(mapName));
+    if (!manifest.empty()) {
+        logger->trace("Prefetching {} textures, {} sprites and {} sounds for map '{}'",
+                      manifest.textures.size(), manifest.sprites.size(), manifest.sounds.size(), mapName);
+
+        if (pBitmaps_LOD)
+            pBitmaps_LOD->prefetch(manifest.textures);
+        if (pSprites_LOD)
+            pSprites_LOD->prefetch(manifest.sprites);
+        if (pAudioPlayer)
+            pAudioPlayer->prefetchSounds(manifest.sounds);
+    }
+
+    if (pBitmaps_LOD)
+        pBitmaps_LOD->resetUsedTextures();
+    if (pSprites_LOD)
+        pSprites_LOD->resetUsedSprites();
+    if (pAudioPlayer)
+        pAudioPlayer->resetPlayedSounds();
+
+    capturedMapName = mapName;
+    capturedManifest = std::move(manifest);
+}
+
+void finishMapAssetCapture() {
+    if (capturedMapName.empty())
+        return;
+
+    // Only what was used during this visit is written out, so that the manifest doesn't keep growing with assets
+    // that the map no longer needs.
+    MapAssetManifest used;
+    if (pBitmaps_LOD)
+        used.textures = pBitmaps_LOD->usedTextures();
+    if (pSprites_LOD)
+        used.sprites = pSprites_LOD->usedSprites();
+    if (pAudioPlayer)
+        used.sounds = pAudioPlayer->playedSounds();
+
+    if (used != capturedManifest)
+        saveManifest(used, manifestPath(capturedMapName));
+
+    capturedMapName.clear();
+    capturedManifest = {};
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Media/Audio/SoundEnums.h"
+
+class InputStream;
+class OutputStream;
+
+/**
+ * List of assets that a map needs - textures, sprites and sounds.
+ *
+ * Level loading code discovers the assets one at a time, and decoding them serially makes up for a large part of the
+ * map transition time. So the assets that a map has used are recorded while the map is loaded, and are written out
+ * into a cache file when the map is left. The next time the map is loaded, all these assets are decoded in parallel on
+ * the shared thread pool before the level loading code gets to them, see `beginMapAssetCapture`.
+ *
+ * All lists are sorted and contain no duplicates.
+ */
+struct MapAssetManifest {
+    std::vector<std::string> textures; // Names of the textures in `pBitmaps_LOD`.
+    std::vector<std::string> sprites; // Names of the sprites in `pSprites_LOD`.
+    std::vector<SoundId> sounds;
+
+    [[nodiscard]] bool empty() const {
+        return textures.empty() && sprites.empty() && sounds.empty();
+    }
+
+    friend bool operator==(const MapAssetManifest &l, const MapAssetManifest &r) = default;
+};
+
+void serialize(const MapAssetManifest &src, OutputStream *dst);
+void deserialize(InputStream &src, MapAssetManifest *dst);
+
+/**
+ * Finishes the capture for the previous map, if any. Then loads the cached asset manifest for the provided map, starts
+ * prefetching all the assets listed there, and starts recording the assets used by the map from scratch.
+ *
+ * When changing maps through a loading screen, must be called after the assets of the previous map were released, as
+ * releasing them also drops the pending prefetches.
+ *
+ * @param mapName                   Map name without an extension, e.g. `out01`.
+ */
+void beginMapAssetCapture(const std::string &mapName);
+
+/**
+ * Replaces the cached manifest of the map passed to the last `beginMapAssetCapture` call with the assets that this map
+ * has used since then. Must be called before these assets are released. Does nothing if there is no map being
+ * recorded.
+ */
+void finishMapAssetCapture();
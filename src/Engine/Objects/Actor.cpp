@@ -1,6 +1,7 @@
 #include "Engine/Objects/Actor.h"
 
 #include <algorithm>
+#include <array>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,6 +17,7 @@
 #include "Engine/Graphics/Sprites.h"
 #include "Engine/Graphics/Vis.h"
 #include "Engine/Localization.h"
+#include "Engine/Objects/ObjectGrid.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
@@ -2324,6 +2326,22 @@ void Actor::PrepareSprites(char load_sounds_if_bit1_set) {
     }
 }
 
+void Actor::prefetchSprites(std::span<const Actor> actors) {
+    std::vector<int> spriteIds;
+    for (const Actor &actor : actors) {
+        if (actor.monsterInfo.id == MONSTER_INVALID)
+            continue;
+
+        const MonsterDesc &desc = pMonsterList->monsters[actor.monsterInfo.id];
+        for (ActorAnimation i : actor.spriteIds.indices())
+            spriteIds.push_back(pSpriteFrameTable->FastFindSprite(desc.spriteNames[i]));
+    }
+
+    std::sort(spriteIds.begin(), spriteIds.end());
+    spriteIds.erase(std::unique(spriteIds.begin(), spriteIds.end()), spriteIds.end());
+    pSpriteFrameTable->prefetchSprites(spriteIds);
+}
+
 //----- (00459667) --------------------------------------------------------
 void Actor::Remove() { this->aiState = Removed; }
 
@@ -2532,6 +2550,9 @@ void Actor::UpdateActorAI() {
     Pid target_pid;   // [sp+ACh] [bp-4h]@83
     unsigned v38;
 
+    // Actors don't move until UpdateActors_BLV / UpdateActors_ODM, so this is a good place to re-index them.
+    refreshActorGrid();
+
     // Build AI array
     if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR)
         Actor::MakeActorAIList_ODM();
@@ -4060,69 +4081,21 @@ int Actor::MakeActorAIList_BLV() {
     return ai_arrays_size;
 }
 
-//----- (004070EF) --------------------------------------------------------
-bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
-    // get object 1 info
-    int obj1_pid = uObjID.id();
-    int obj1_sector;
-    Vec3i pos1;
-
-    switch (uObjID.type()) {
-        case OBJECT_Decoration:
-            pos1 = pLevelDecorations[obj1_pid].vPosition;
-            obj1_sector = pIndoor->GetSector(pos1);
-            break;
-        case OBJECT_Actor:
-            pos1 = pActors[obj1_pid].pos + Vec3i(0, 0, pActors[obj1_pid].height * 0.69999999);
-            obj1_sector = pActors[obj1_pid].sectorId;
-            break;
-        case OBJECT_Item:
-            pos1 = pSpriteObjects[obj1_pid].vPosition;
-            obj1_sector = pSpriteObjects[obj1_pid].uSectorID;
-            break;
-        default:
-            return 0;
-    }
-
-    // get object 2 info
-    int obj2_pid = uObj2ID.id();
-    int obj2_sector;
-    Vec3i pos2;
-
-    switch (uObj2ID.type()) {
-        case OBJECT_Decoration:
-            pos2 = pLevelDecorations[obj2_pid].vPosition;
-            obj2_sector = pIndoor->GetSector(pos2);
-            break;
-        case OBJECT_Character:
-            pos2 = pParty->pos.toInt() + Vec3i(0, 0, pParty->eyeLevel);
-            obj2_sector = pBLVRenderParams->uPartyEyeSectorID;
-            break;
-        case OBJECT_Actor:
-            pos2 = pActors[obj2_pid].pos + Vec3i(0, 0, pActors[obj2_pid].height * 0.69999999);
-            obj2_sector = pActors[obj2_pid].sectorId;
-            break;
-        case OBJECT_Item:
-            pos2 = pSpriteObjects[obj2_pid].vPosition;
-            obj2_sector = pSpriteObjects[obj2_pid].uSectorID;
-            break;
-        default:
-            return 0;
-    }
-
-    // get distance between objects
+/**
+ * Walks the portal graph from `obj1_sector` along the ray from `pos1` to `pos2`, checking whether `obj2_sector` can be
+ * reached.
+ *
+ * @param pos1                          Start of the ray.
+ * @param obj1_sector                   Sector that contains `pos1`.
+ * @param pos2                          End of the ray.
+ * @param obj2_sector                   Sector that contains `pos2`.
+ * @return                              Whether `obj2_sector` is visible from `pos1`.
+ */
+static bool detectThroughPortals(Vec3i pos1, int obj1_sector, Vec3i pos2, int obj2_sector) {
     float dist_x = pos2.x - pos1.x;
     float dist_y = pos2.y - pos1.y;
     float dist_z = pos2.z - pos1.z;
     float dist_3d = sqrt(dist_x * dist_x + dist_y * dist_y + dist_z * dist_z);
-    // range check
-    if (dist_3d > 5120) return 0;
-
-    // if in range always detected outdoors
-    if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) return 1;
-
-    // monster in same sector with player/ monster
-    if (obj1_sector == obj2_sector) return 1;
 
     // normalising
     float rayxnorm = dist_x / dist_3d;
@@ -4220,6 +4193,132 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
     return 1;
 }
 
+struct DetectionCacheEntry {
+    int generation = -1;
+    Pid obj1;
+    Pid obj2;
+    Vec3i pos1;
+    Vec3i pos2;
+    int sector1 = 0;
+    int sector2 = 0;
+    bool result = false;
+};
+
+static constexpr int DETECTION_CACHE_SIZE = 1024; // Must be a power of two.
+
+// Direct-mapped, one slot per object pair. Results are only reused when both objects haven't moved, so this doesn't
+// change game logic in any way.
+static std::array<DetectionCacheEntry, DETECTION_CACHE_SIZE> detectionCache;
+static int detectionCacheGeneration = 0;
+static DetectionCacheStats detectionCacheCounters;
+
+static bool detectThroughPortalsCached(Pid obj1, Vec3i pos1, int sector1, Pid obj2, Vec3i pos2, int sector2) {
+    uint32_t hash = (static_cast<uint32_t>(obj1.packed()) * 0x9E3779B1u) ^ obj2.packed();
+    DetectionCacheEntry &entry = detectionCache[(hash ^ (hash >> 16)) & (DETECTION_CACHE_SIZE - 1)];
+
+    if (entry.generation == detectionCacheGeneration && entry.obj1 == obj1 && entry.obj2 == obj2 &&
+        entry.pos1 == pos1 && entry.pos2 == pos2 && entry.sector1 == sector1 && entry.sector2 == sector2) {
+        detectionCacheCounters.hits++;
+
+        if (engine->config->debug.VerifyDetectionCache.value()) {
+            bool expected = detectThroughPortals(pos1, sector1, pos2, sector2);
+            if (entry.result != expected) {
+                detectionCacheCounters.mismatches++;
+                logger->error("Detection cache mismatch for objects {} and {}: cached {}, expected {}",
+                              obj1.packed(), obj2.packed(), entry.result, expected);
+            }
+        }
+
+        return entry.result;
+    }
+
+    detectionCacheCounters.misses++;
+    entry.generation = detectionCacheGeneration;
+    entry.obj1 = obj1;
+    entry.obj2 = obj2;
+    entry.pos1 = pos1;
+    entry.pos2 = pos2;
+    entry.sector1 = sector1;
+    entry.sector2 = sector2;
+    entry.result = detectThroughPortals(pos1, sector1, pos2, sector2);
+    return entry.result;
+}
+
+void invalidateDetectionCache() {
+    detectionCacheGeneration++;
+}
+
+DetectionCacheStats detectionCacheStats() {
+    return detectionCacheCounters;
+}
+
+//----- (004070EF) --------------------------------------------------------
+bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
+    // get object 1 info
+    int obj1_pid = uObjID.id();
+    int obj1_sector;
+    Vec3i pos1;
+
+    switch (uObjID.type()) {
+        case OBJECT_Decoration:
+            pos1 = pLevelDecorations[obj1_pid].vPosition;
+            obj1_sector = pIndoor->GetSector(pos1);
+            break;
+        case OBJECT_Actor:
+            pos1 = pActors[obj1_pid].pos + Vec3i(0, 0, pActors[obj1_pid].height * 0.69999999);
+            obj1_sector = pActors[obj1_pid].sectorId;
+            break;
+        case OBJECT_Item:
+            pos1 = pSpriteObjects[obj1_pid].vPosition;
+            obj1_sector = pSpriteObjects[obj1_pid].uSectorID;
+            break;
+        default:
+            return 0;
+    }
+
+    // get object 2 info
+    int obj2_pid = uObj2ID.id();
+    int obj2_sector;
+    Vec3i pos2;
+
+    switch (uObj2ID.type()) {
+        case OBJECT_Decoration:
+            pos2 = pLevelDecorations[obj2_pid].vPosition;
+            obj2_sector = pIndoor->GetSector(pos2);
+            break;
+        case OBJECT_Character:
+            pos2 = pParty->pos.toInt() + Vec3i(0, 0, pParty->eyeLevel);
+            obj2_sector = pBLVRenderParams->uPartyEyeSectorID;
+            break;
+        case OBJECT_Actor:
+            pos2 = pActors[obj2_pid].pos + Vec3i(0, 0, pActors[obj2_pid].height * 0.69999999);
+            obj2_sector = pActors[obj2_pid].sectorId;
+            break;
+        case OBJECT_Item:
+            pos2 = pSpriteObjects[obj2_pid].vPosition;
+            obj2_sector = pSpriteObjects[obj2_pid].uSectorID;
+            break;
+        default:
+            return 0;
+    }
+
+    // get distance between objects
+    float dist_x = pos2.x - pos1.x;
+    float dist_y = pos2.y - pos1.y;
+    float dist_z = pos2.z - pos1.z;
+    float dist_3d = sqrt(dist_x * dist_x + dist_y * dist_y + dist_z * dist_z);
+    // range check
+    if (dist_3d > 5120) return 0;
+
+    // if in range always detected outdoors
+    if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) return 1;
+
+    // monster in same sector with player/ monster
+    if (obj1_sector == obj2_sector) return 1;
+
+    return detectThroughPortalsCached(uObjID, pos1, obj1_sector, uObj2ID, pos2, obj2_sector);
+}
+
 //----- (0044FA4C) --------------------------------------------------------
 void Spawn_Light_Elemental(int spell_power, CharacterSkillMastery caster_skill_mastery, Duration duration) {
     // size_t uActorIndex;            // [sp+10h] [bp-10h]@6
@@ -4720,6 +4819,7 @@ Actor *AllocateActor(bool appendOnly) {
         for (size_t i = 0; i < pActors.size(); i++) {
             if (pActors[i].aiState == Removed) {
                 pActors[i].Reset();
+                markActorGridSlotReused(i);
                 return &pActors[i];
             }
         }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <vector>
 #include <string>
 
@@ -57,6 +59,14 @@ class Actor {
     void Reset();
     void Remove();
     void PrepareSprites(char load_sounds_if_bit1_set);
+
+    /**
+     * Starts decoding the sprites of the provided actors in the background, so that the subsequent `PrepareSprites`
+     * calls don't have to wait for each sprite to be decoded one by one.
+     *
+     * @param actors                    Actors to prefetch the sprites for.
+     */
+    static void prefetchSprites(std::span<const Actor> actors);
     void UpdateAnimation();
     MonsterHostility GetActorsRelation(Actor *a2);
     void SetRandomGoldIfTheresNoItem();
@@ -254,6 +264,23 @@ void npcSetItem(int npc, ItemId item, int a3);
  */
 void toggleActorGroupFlag(unsigned int uGroupID, ActorAttribute uFlag, bool bValue);
 bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID);
+
+struct DetectionCacheStats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t mismatches = 0; // Only counted when `debug.verify_detection_cache` is set.
+};
+
+/**
+ * Drops all the portal walk results cached by `Detect_Between_Objects`. Must be called whenever indoor geometry that
+ * portals depend on changes, e.g. when doors move or a new level is loaded.
+ */
+void invalidateDetectionCache();
+
+/**
+ * @return                              Hit / miss counters of the `Detect_Between_Objects` cache.
+ */
+DetectionCacheStats detectionCacheStats();
 void Spawn_Light_Elemental(int spell_power, CharacterSkillMastery caster_skill_mastery, Duration duration);
 void SpawnEncounter(struct MapInfo *pMapInfo, SpawnPoint *spawn, int a3, int a4, int a5);
 /**
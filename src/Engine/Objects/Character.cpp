@@ -19,6 +19,7 @@
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/NPC.h"
+#include "Engine/Objects/ItemEnchantment.h"
 #include "Engine/Objects/CharacterEnumFunctions.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
 #include "Engine/OurMath.h"
@@ -2424,87 +2425,12 @@ int Character::GetItemsBonus(CharacterAttributeType attr, bool getOnlyMainHandDm
     int v25;                    // ecx@80
     int v26;                    // edi@80
     int v56;                    // eax@365
-    CharacterSkillType v58;             // [sp-4h] [bp-20h]@10
-    int v61;                    // [sp+10h] [bp-Ch]@1
-    int v62;                    // [sp+14h] [bp-8h]@1
-    const ItemGen *currEquippedItem;  // [sp+20h] [bp+4h]@101
-    bool no_skills;
 
     v5 = 0;
-    v62 = 0;
-    v61 = 0;
 
-    no_skills = false;
-    switch (attr) {
-        case CHARACTER_ATTRIBUTE_SKILL_ALCHEMY:
-            v58 = CHARACTER_SKILL_ALCHEMY;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_STEALING:
-            v58 = CHARACTER_SKILL_STEALING;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM:
-            v58 = CHARACTER_SKILL_TRAP_DISARM;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_ITEM_ID:
-            v58 = CHARACTER_SKILL_ITEM_ID;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_MONSTER_ID:
-            v58 = CHARACTER_SKILL_MONSTER_ID;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_ARMSMASTER:
-            v58 = CHARACTER_SKILL_ARMSMASTER;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_DODGE:
-            v58 = CHARACTER_SKILL_DODGE;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_UNARMED:
-            v58 = CHARACTER_SKILL_UNARMED;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_FIRE:
-            v58 = CHARACTER_SKILL_FIRE;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_AIR:
-            v58 = CHARACTER_SKILL_AIR;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_WATER:
-            v58 = CHARACTER_SKILL_WATER;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_EARTH:
-            v58 = CHARACTER_SKILL_EARTH;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_SPIRIT:
-            v58 = CHARACTER_SKILL_SPIRIT;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_MIND:
-            v58 = CHARACTER_SKILL_MIND;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_BODY:
-            v58 = CHARACTER_SKILL_BODY;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_LIGHT:
-            v58 = CHARACTER_SKILL_LIGHT;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_DARK:
-            v58 = CHARACTER_SKILL_DARK;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_MEDITATION:
-            v58 = CHARACTER_SKILL_MEDITATION;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_BOW:
-            v58 = CHARACTER_SKILL_BOW;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_SHIELD:
-            v58 = CHARACTER_SKILL_SHIELD;
-            break;
-        case CHARACTER_ATTRIBUTE_SKILL_LEARNING:
-            v58 = CHARACTER_SKILL_LEARNING;
-            break;
-        default:
-            no_skills = true;
-    }
-    if (!no_skills) {
-        if (!this->pActiveSkills[v58]) return 0;
-    }
+    CharacterSkillType skill = skillForAttribute(attr);
+    if (skill != CHARACTER_SKILL_INVALID && !this->pActiveSkills[skill])
+        return 0;
 
     switch (attr) {  // TODO(_) would be nice to move these into separate functions
         case CHARACTER_ATTRIBUTE_RANGED_DMG_BONUS:
@@ -2651,33 +2577,91 @@ int Character::GetItemsBonus(CharacterAttributeType attr, bool getOnlyMainHandDm
         case CHARACTER_ATTRIBUTE_SKILL_BOW:
         case CHARACTER_ATTRIBUTE_SKILL_SHIELD:
         case CHARACTER_ATTRIBUTE_SKILL_LEARNING:
-            for (ItemSlot i : allItemSlots()) {
-                if (HasItemEquipped(i)) {
-                    currEquippedItem = GetItem(i);
-                    if (attr == CHARACTER_ATTRIBUTE_AC_BONUS) {
-                        if (isPassiveEquipment(currEquippedItem->GetItemEquipType())) {
-                            v5 += currEquippedItem->GetDamageDice() +
-                                  currEquippedItem->GetDamageMod();
-                        }
-                    }
-                    if (pItemTable->IsMaterialNonCommon(currEquippedItem) &&
-                        !pItemTable->IsMaterialSpecial(currEquippedItem)) {
-                        currEquippedItem->GetItemBonusArtifact(this, attr, &v62);
-                    } else if (currEquippedItem->attributeEnchantment) {
-                        if (*currEquippedItem->attributeEnchantment == attr) {
-                            // if (currEquippedItem->IsRegularEnchanmentForAttribute(attr))
-                            v5 += currEquippedItem->m_enchantmentStrength;
-                        }
+            return itemBonus(itemBonuses(), attr);
+        default:
+            return 0;
+    }
+}
+
+int Character::itemBonus(const CharacterItemBonusCache &cache, CharacterAttributeType attr) const {
+    int result = cache.bonus[attr] + cache.artifactBonus[attr];
+    if (cache.artifactSkill[attr] != CHARACTER_SKILL_INVALID)
+        result += pActiveSkills[cache.artifactSkill[attr]].level() / 2;
+    if (cache.specialSkill[attr] != CHARACTER_SKILL_INVALID)
+        result += pActiveSkills[cache.specialSkill[attr]].level() / 2;
+    return result;
+}
+
+const CharacterItemBonusCache &Character::itemBonuses() const {
+    CharacterItemBonusCache &cache = _itemBonusCache;
+
+    bool valid = cache.valid;
+    for (ItemSlot slot : allItemSlots()) {
+        CharacterItemBonusCache::SlotKey key;
+        key.inventoryIndex = pEquipment[slot];
+        if (key.inventoryIndex) {
+            const ItemGen &item = pInventoryItemList[key.inventoryIndex - 1];
+            key.itemId = item.uItemID;
+            key.attributeEnchantment = item.attributeEnchantment;
+            key.enchantmentStrength = item.m_enchantmentStrength;
+            key.specialEnchantment = item.special_enchantment;
+            key.broken = item.IsBroken();
+        }
+        if (cache.key[slot] != key) {
+            cache.key[slot] = key;
+            valid = false;
+        }
+    }
+    if (!valid)
+        buildItemBonuses(&cache);
+    return cache;
+}
+
+void Character::buildItemBonuses(CharacterItemBonusCache *cache) const {
+    cache->bonus.fill(0);
+    cache->artifactBonus.fill(0);
+    cache->artifactSkill.fill(CHARACTER_SKILL_INVALID);
+    cache->specialSkill.fill(CHARACTER_SKILL_INVALID);
+
+    // Items are applied in slot order, same as in the original per-attribute loop. This matters because some of the
+    // bonuses don't stack, and the last one wins.
+    for (ItemSlot slot : allItemSlots()) {
+        if (!HasItemEquipped(slot))
+            continue;
+
+        const ItemGen *item = GetItem(slot);
+        if (isPassiveEquipment(item->GetItemEquipType()))
+            cache->bonus[CHARACTER_ATTRIBUTE_AC_BONUS] += item->GetDamageDice() + item->GetDamageMod();
+
+        if (pItemTable->IsMaterialNonCommon(item) && !pItemTable->IsMaterialSpecial(item)) {
+            for (CharacterAttributeType attr : allAttributes()) {
+                const CEnchantment &bonus = ItemGen::artifactBonus(item->uItemID, attr);
+                if (bonus.skillType != CHARACTER_SKILL_INVALID) {
+                    cache->artifactSkill[attr] = bonus.skillType;
+                    cache->artifactBonus[attr] = 0;
+                } else {
+                    cache->artifactBonus[attr] += bonus.statBonus;
+                }
+            }
+        } else if (item->attributeEnchantment) {
+            cache->bonus[*item->attributeEnchantment] += item->m_enchantmentStrength;
+        } else {
+            for (CharacterAttributeType attr : allAttributes()) {
+                const CEnchantment &bonus = ItemGen::specialEnchantmentBonus(item->special_enchantment, attr);
+                if (bonus.skillType != CHARACTER_SKILL_INVALID) {
+                    if (bonus.statBonus == 0) {
+                        cache->specialSkill[attr] = bonus.skillType;
                     } else {
-                        currEquippedItem->GetItemBonusSpecialEnchantment(this, attr, &v5, &v61);
+                        cache->bonus[attr] = std::max(cache->bonus[attr], bonus.statBonus);
                     }
+                } else {
+                    cache->bonus[attr] += bonus.statBonus;
                 }
             }
-            return v5 + v62 + v61;
-            break;
-        default:
-            return 0;
+        }
     }
+
+    cache->valid = true;
 }
 
 //----- (0048F73C) --------------------------------------------------------
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <vector>
 #include <string>
 #include <utility>
@@ -96,6 +97,35 @@ class CharacterConditions : private RawCharacterConditions {
     }
 };
 
+/**
+ * Attribute bonuses from the equipped items, see `Character::GetItemsBonus`.
+ *
+ * Computing an item bonus means walking all equipped items, and the stat getters do that for every attribute they
+ * touch. So the bonuses are computed for all attributes in a single walk, and are only recomputed when the equipped
+ * items change. Bonuses equal to half of a skill (e.g. "of Fire Magic") are stored as skills and resolved on lookup,
+ * so skill changes don't invalidate the cache.
+ */
+struct CharacterItemBonusCache {
+    struct SlotKey {
+        unsigned int inventoryIndex = 0; // Value in `Character::pEquipment`.
+        ItemId itemId = ITEM_NULL;
+        std::optional<CharacterAttributeType> attributeEnchantment;
+        int enchantmentStrength = 0;
+        ItemEnchantment specialEnchantment = ITEM_ENCHANTMENT_NULL;
+        bool broken = false;
+
+        friend bool operator==(const SlotKey &l, const SlotKey &r) = default;
+    };
+
+    bool valid = false;
+    IndexedArray<SlotKey, ITEM_SLOT_FIRST_VALID, ITEM_SLOT_LAST_VALID> key; // Equipped items the cache was built for.
+    IndexedArray<int, CHARACTER_ATTRIBUTE_FIRST, CHARACTER_ATTRIBUTE_LAST> bonus = {{}}; // Flat bonuses.
+    IndexedArray<int, CHARACTER_ATTRIBUTE_FIRST, CHARACTER_ATTRIBUTE_LAST> artifactBonus = {{}}; // Flat artifact bonuses
+                                                                                                  // after `artifactSkill`.
+    IndexedArray<CharacterSkillType, CHARACTER_ATTRIBUTE_FIRST, CHARACTER_ATTRIBUTE_LAST> artifactSkill = {{}};
+    IndexedArray<CharacterSkillType, CHARACTER_ATTRIBUTE_FIRST, CHARACTER_ATTRIBUTE_LAST> specialSkill = {{}};
+};
+
 class Character {
  public:
     static constexpr unsigned int INVENTORY_SLOTS_WIDTH = 14;
@@ -459,6 +489,17 @@ class Character {
     char uNumDivineInterventionCastsThisDay;
     char uNumArmageddonCasts;
     char uNumFireSpikeCasts;
+
+ private:
+    /**
+     * @return                          Item bonuses for the currently equipped items. Cache is rebuilt if the
+     *                                  equipped items have changed since the last call.
+     */
+    const CharacterItemBonusCache &itemBonuses() const;
+    void buildItemBonuses(CharacterItemBonusCache *cache) const;
+    int itemBonus(const CharacterItemBonusCache &cache, CharacterAttributeType attr) const;
+
+    mutable CharacterItemBonusCache _itemBonusCache;
 };
 
 void DamageCharacterFromMonster(Pid uObjID, ActorAbility dmgSource, Vec3i *pPos, signed int a4);
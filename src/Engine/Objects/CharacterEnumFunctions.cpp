@@ -70,3 +70,30 @@ CharacterSkillType skillForSpell(SpellId spell) {
         return CHARACTER_SKILL_INVALID;
     }
 }
+
+CharacterSkillType skillForAttribute(CharacterAttributeType attribute) {
+    switch (attribute) {
+    case CHARACTER_ATTRIBUTE_SKILL_ALCHEMY:     return CHARACTER_SKILL_ALCHEMY;
+    case CHARACTER_ATTRIBUTE_SKILL_STEALING:    return CHARACTER_SKILL_STEALING;
+    case CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM: return CHARACTER_SKILL_TRAP_DISARM;
+    case CHARACTER_ATTRIBUTE_SKILL_ITEM_ID:     return CHARACTER_SKILL_ITEM_ID;
+    case CHARACTER_ATTRIBUTE_SKILL_MONSTER_ID:  return CHARACTER_SKILL_MONSTER_ID;
+    case CHARACTER_ATTRIBUTE_SKILL_ARMSMASTER:  return CHARACTER_SKILL_ARMSMASTER;
+    case CHARACTER_ATTRIBUTE_SKILL_DODGE:       return CHARACTER_SKILL_DODGE;
+    case CHARACTER_ATTRIBUTE_SKILL_UNARMED:     return CHARACTER_SKILL_UNARMED;
+    case CHARACTER_ATTRIBUTE_SKILL_FIRE:        return CHARACTER_SKILL_FIRE;
+    case CHARACTER_ATTRIBUTE_SKILL_AIR:         return CHARACTER_SKILL_AIR;
+    case CHARACTER_ATTRIBUTE_SKILL_WATER:       return CHARACTER_SKILL_WATER;
+    case CHARACTER_ATTRIBUTE_SKILL_EARTH:       return CHARACTER_SKILL_EARTH;
+    case CHARACTER_ATTRIBUTE_SKILL_SPIRIT:      return CHARACTER_SKILL_SPIRIT;
+    case CHARACTER_ATTRIBUTE_SKILL_MIND:        return CHARACTER_SKILL_MIND;
+    case CHARACTER_ATTRIBUTE_SKILL_BODY:        return CHARACTER_SKILL_BODY;
+    case CHARACTER_ATTRIBUTE_SKILL_LIGHT:       return CHARACTER_SKILL_LIGHT;
+    case CHARACTER_ATTRIBUTE_SKILL_DARK:        return CHARACTER_SKILL_DARK;
+    case CHARACTER_ATTRIBUTE_SKILL_MEDITATION:  return CHARACTER_SKILL_MEDITATION;
+    case CHARACTER_ATTRIBUTE_SKILL_BOW:         return CHARACTER_SKILL_BOW;
+    case CHARACTER_ATTRIBUTE_SKILL_SHIELD:      return CHARACTER_SKILL_SHIELD;
+    case CHARACTER_ATTRIBUTE_SKILL_LEARNING:    return CHARACTER_SKILL_LEARNING;
+    default:                                    return CHARACTER_SKILL_INVALID;
+    }
+}
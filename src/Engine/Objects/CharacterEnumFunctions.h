@@ -172,6 +172,10 @@ inline Segment<CharacterClass> promotionsForClass(CharacterClass classType) {
 // CharacterAttributeType
 //
 
+inline Segment<CharacterAttributeType> allAttributes() {
+    return {CHARACTER_ATTRIBUTE_FIRST, CHARACTER_ATTRIBUTE_LAST};
+}
+
 /**
  * @return                              All attributes that can be improved though attribute item enchantments, like
  *                                      "of Might".
@@ -187,3 +191,10 @@ inline Segment<CharacterAttributeType> allEnchantableAttributes() {
 inline Segment<CharacterAttributeType> allStatAttributes() {
     return {CHARACTER_ATTRIBUTE_FIRST_STAT, CHARACTER_ATTRIBUTE_LAST_STAT};
 }
+
+/**
+ * @param attribute                     Attribute to check.
+ * @return                              Skill that the provided attribute is a bonus to, or `CHARACTER_SKILL_INVALID`
+ *                                      if it's not a skill attribute.
+ */
+CharacterSkillType skillForAttribute(CharacterAttributeType attribute);
@@ -427,6 +427,9 @@ enum class CharacterAttributeType {
     CHARACTER_ATTRIBUTE_SKILL_SHIELD = 45,
     CHARACTER_ATTRIBUTE_SKILL_LEARNING = 46,
 
+    CHARACTER_ATTRIBUTE_FIRST = CHARACTER_ATTRIBUTE_MIGHT,
+    CHARACTER_ATTRIBUTE_LAST = CHARACTER_ATTRIBUTE_SKILL_LEARNING,
+
     CHARACTER_ATTRIBUTE_FIRST_STAT = CHARACTER_ATTRIBUTE_MIGHT,
     CHARACTER_ATTRIBUTE_LAST_STAT = CHARACTER_ATTRIBUTE_LUCK,
 
@@ -1,6 +1,5 @@
 #include "Engine/Objects/Items.h"
 
-#include <map>
 #include <string>
 #include <unordered_map>
 
@@ -21,9 +20,11 @@ ItemGen *ptr_50C9A4_ItemToEnchant;
 
 struct ItemTable *pItemTable;  // 005D29E0
 
-static std::map<int, std::map<CharacterAttributeType, CEnchantment>> regularBonusMap;
-static std::map<ItemEnchantment, std::map<CharacterAttributeType, CEnchantment>> specialBonusMap;
-static std::map<ItemId, std::map<CharacterAttributeType, CEnchantment>> artifactBonusMap;
+using AttributeBonusTable = IndexedArray<CEnchantment, CHARACTER_ATTRIBUTE_FIRST, CHARACTER_ATTRIBUTE_LAST>;
+
+static IndexedArray<AttributeBonusTable, ITEM_ENCHANTMENT_FIRST_VALID, ITEM_ENCHANTMENT_LAST_VALID> specialBonusTable;
+static IndexedArray<AttributeBonusTable, ITEM_FIRST_ARTIFACT, ITEM_LAST_ARTIFACT> artifactBonusTable;
+static const CEnchantment emptyBonus;
 
 static std::unordered_map<ItemId, ItemId> itemTextureIdByItemId = {
     { ITEM_RELIC_HARECKS_LEATHER,       ITEM_POTION_STONESKIN },
@@ -294,418 +295,314 @@ void ItemGen::generateGold(ItemTreasureLevel treasureLevel) {
     }
 }
 
-template<class Key, class ActualKey>
-static void AddToMap(std::map<Key, std::map<CharacterAttributeType, CEnchantment>> &map,
-                     ActualKey key, CharacterAttributeType subkey, int bonusValue = 0, CharacterSkillType skill = CHARACTER_SKILL_INVALID) {
-    auto &submap = map[key];
+template<class Table, class Key>
+static void AddToTable(Table &table, Key key, CharacterAttributeType attribute, int bonusValue = 0,
+                       CharacterSkillType skill = CHARACTER_SKILL_INVALID) {
+    CEnchantment &bonus = table[key][attribute];
 
-    assert(!submap.contains(subkey));
+    assert(bonus.skillType == CHARACTER_SKILL_INVALID && bonus.statBonus == 0); // Each bonus is added only once.
 
-    submap[subkey] = CEnchantment(bonusValue, skill);
+    bonus = CEnchantment(bonusValue, skill);
 }
 
-void ItemGen::PopulateSpecialBonusMap() {
+void ItemGen::PopulateSpecialBonusTable() {
+    specialBonusTable.fill({});
+
     // of Protection, +10 to all Resistances (description in txt says all 4, need to verify!)
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_AIR, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_BODY, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_EARTH, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_FIRE, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_MIND, 10);
-    //AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_SPIRIT, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_WATER, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_AIR, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_BODY, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_EARTH, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_FIRE, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_MIND, 10);
+    //AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_SPIRIT, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_PROTECTION, CHARACTER_ATTRIBUTE_RESIST_WATER, 10);
 
     // of The Gods, +10 to all Seven Statistics
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_ACCURACY, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_INTELLIGENCE, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_ENDURANCE, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_LUCK, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_SPEED, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_MIGHT, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_PERSONALITY, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_ACCURACY, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_INTELLIGENCE, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_ENDURANCE, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_LUCK, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_SPEED, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_MIGHT, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GODS, CHARACTER_ATTRIBUTE_PERSONALITY, 10);
 
     // of Air Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_AIR_MAGIC, CHARACTER_ATTRIBUTE_SKILL_AIR, 0, CHARACTER_SKILL_AIR);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_AIR_MAGIC, CHARACTER_ATTRIBUTE_SKILL_AIR, 0, CHARACTER_SKILL_AIR);
 
     // of Body Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_BODY_MAGIC, CHARACTER_ATTRIBUTE_SKILL_BODY, 0, CHARACTER_SKILL_BODY);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_BODY_MAGIC, CHARACTER_ATTRIBUTE_SKILL_BODY, 0, CHARACTER_SKILL_BODY);
 
     // of Dark Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DARK_MAGIC, CHARACTER_ATTRIBUTE_SKILL_DARK, 0, CHARACTER_SKILL_DARK);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DARK_MAGIC, CHARACTER_ATTRIBUTE_SKILL_DARK, 0, CHARACTER_SKILL_DARK);
 
     // of Earth Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_EARTH_MAGIC, CHARACTER_ATTRIBUTE_SKILL_EARTH, 0, CHARACTER_SKILL_EARTH);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_EARTH_MAGIC, CHARACTER_ATTRIBUTE_SKILL_EARTH, 0, CHARACTER_SKILL_EARTH);
 
     // of Fire Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_FIRE_MAGIC, CHARACTER_ATTRIBUTE_SKILL_FIRE, 0, CHARACTER_SKILL_FIRE);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_FIRE_MAGIC, CHARACTER_ATTRIBUTE_SKILL_FIRE, 0, CHARACTER_SKILL_FIRE);
 
     // of Light Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_LIGHT_MAGIC, CHARACTER_ATTRIBUTE_SKILL_LIGHT, 0, CHARACTER_SKILL_LIGHT);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_LIGHT_MAGIC, CHARACTER_ATTRIBUTE_SKILL_LIGHT, 0, CHARACTER_SKILL_LIGHT);
 
     // of Mind Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_MIND_MAGIC, CHARACTER_ATTRIBUTE_SKILL_MIND, 0, CHARACTER_SKILL_MIND);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_MIND_MAGIC, CHARACTER_ATTRIBUTE_SKILL_MIND, 0, CHARACTER_SKILL_MIND);
 
     // of Spirit Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_SPIRIT_MAGIC, CHARACTER_ATTRIBUTE_SKILL_SPIRIT, 0, CHARACTER_SKILL_SPIRIT);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_SPIRIT_MAGIC, CHARACTER_ATTRIBUTE_SKILL_SPIRIT, 0, CHARACTER_SKILL_SPIRIT);
 
     // of Water Magic
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_WATER_MAGIC, CHARACTER_ATTRIBUTE_SKILL_WATER, 0, CHARACTER_SKILL_WATER);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_WATER_MAGIC, CHARACTER_ATTRIBUTE_SKILL_WATER, 0, CHARACTER_SKILL_WATER);
 
     // of Doom, +1 to Seven Stats, HP, SP, Armor, Resistances (in txt it says 4, need to check!)
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_ACCURACY, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_INTELLIGENCE, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_ENDURANCE, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_LUCK, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_SPEED, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_MIGHT, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_PERSONALITY, 1);
-
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_AIR, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_BODY, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_EARTH, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_FIRE, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_MIND, 1);
-    //AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_SPIRIT, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_WATER, 1);
-
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_AC_BONUS, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_HEALTH, 1);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_MANA, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_ACCURACY, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_INTELLIGENCE, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_ENDURANCE, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_LUCK, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_SPEED, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_MIGHT, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_PERSONALITY, 1);
+
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_AIR, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_BODY, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_EARTH, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_FIRE, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_MIND, 1);
+    //AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_SPIRIT, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_RESIST_WATER, 1);
+
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_AC_BONUS, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_HEALTH, 1);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DOOM, CHARACTER_ATTRIBUTE_MANA, 1);
 
     // of Earth
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_EARTH, CHARACTER_ATTRIBUTE_AC_BONUS, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_EARTH, CHARACTER_ATTRIBUTE_ENDURANCE, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_EARTH, CHARACTER_ATTRIBUTE_HEALTH, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_EARTH, CHARACTER_ATTRIBUTE_AC_BONUS, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_EARTH, CHARACTER_ATTRIBUTE_ENDURANCE, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_EARTH, CHARACTER_ATTRIBUTE_HEALTH, 10);
 
     // of Life
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_LIFE, CHARACTER_ATTRIBUTE_HEALTH, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_LIFE, CHARACTER_ATTRIBUTE_HEALTH, 10);
 
     // Rogues
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_ROGUES, CHARACTER_ATTRIBUTE_ACCURACY, 5);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_ROGUES, CHARACTER_ATTRIBUTE_SPEED, 5);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_ROGUES, CHARACTER_ATTRIBUTE_ACCURACY, 5);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_ROGUES, CHARACTER_ATTRIBUTE_SPEED, 5);
 
     // of The Dragon
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_DRAGON, CHARACTER_ATTRIBUTE_MIGHT, 25);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_DRAGON, CHARACTER_ATTRIBUTE_MIGHT, 25);
 
     // of The Eclipse
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_ECLIPSE, CHARACTER_ATTRIBUTE_MANA, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_ECLIPSE, CHARACTER_ATTRIBUTE_MANA, 10);
 
     // of The Golem
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GOLEM, CHARACTER_ATTRIBUTE_AC_BONUS, 5);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_GOLEM, CHARACTER_ATTRIBUTE_ENDURANCE, 15);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GOLEM, CHARACTER_ATTRIBUTE_AC_BONUS, 5);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_GOLEM, CHARACTER_ATTRIBUTE_ENDURANCE, 15);
 
     // of The Moon
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_MOON, CHARACTER_ATTRIBUTE_INTELLIGENCE, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_MOON, CHARACTER_ATTRIBUTE_LUCK, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_MOON, CHARACTER_ATTRIBUTE_INTELLIGENCE, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_MOON, CHARACTER_ATTRIBUTE_LUCK, 10);
 
     // of The Phoenix
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_PHOENIX, CHARACTER_ATTRIBUTE_RESIST_FIRE, 30);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_PHOENIX, CHARACTER_ATTRIBUTE_RESIST_FIRE, 30);
 
     // of The Sky
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_SKY, CHARACTER_ATTRIBUTE_INTELLIGENCE, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_SKY, CHARACTER_ATTRIBUTE_MANA, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_SKY, CHARACTER_ATTRIBUTE_SPEED, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_SKY, CHARACTER_ATTRIBUTE_INTELLIGENCE, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_SKY, CHARACTER_ATTRIBUTE_MANA, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_SKY, CHARACTER_ATTRIBUTE_SPEED, 10);
 
     // of The Stars
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_STARS, CHARACTER_ATTRIBUTE_ACCURACY, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_STARS, CHARACTER_ATTRIBUTE_ENDURANCE, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_STARS, CHARACTER_ATTRIBUTE_ACCURACY, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_STARS, CHARACTER_ATTRIBUTE_ENDURANCE, 10);
 
     // of The Sun
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_SUN, CHARACTER_ATTRIBUTE_MIGHT, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_SUN, CHARACTER_ATTRIBUTE_PERSONALITY, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_SUN, CHARACTER_ATTRIBUTE_MIGHT, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_SUN, CHARACTER_ATTRIBUTE_PERSONALITY, 10);
 
     // of The Troll
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_TROLL, CHARACTER_ATTRIBUTE_ENDURANCE, 15);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_TROLL, CHARACTER_ATTRIBUTE_ENDURANCE, 15);
 
     // of The Unicorn
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_UNICORN, CHARACTER_ATTRIBUTE_LUCK, 15);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_UNICORN, CHARACTER_ATTRIBUTE_LUCK, 15);
 
     // Warriors
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_WARRIORS, CHARACTER_ATTRIBUTE_ENDURANCE, 5);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_WARRIORS, CHARACTER_ATTRIBUTE_MIGHT, 5);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_WARRIORS, CHARACTER_ATTRIBUTE_ENDURANCE, 5);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_WARRIORS, CHARACTER_ATTRIBUTE_MIGHT, 5);
 
     // Wizards
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_WIZARDS, CHARACTER_ATTRIBUTE_INTELLIGENCE, 5);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_WIZARDS, CHARACTER_ATTRIBUTE_PERSONALITY, 5);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_WIZARDS, CHARACTER_ATTRIBUTE_INTELLIGENCE, 5);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_WIZARDS, CHARACTER_ATTRIBUTE_PERSONALITY, 5);
 
     // Monks
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_MONKS, CHARACTER_ATTRIBUTE_SKILL_DODGE, 3, CHARACTER_SKILL_DODGE);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_MONKS, CHARACTER_ATTRIBUTE_SKILL_UNARMED, 3, CHARACTER_SKILL_UNARMED);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_MONKS, CHARACTER_ATTRIBUTE_SKILL_DODGE, 3, CHARACTER_SKILL_DODGE);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_MONKS, CHARACTER_ATTRIBUTE_SKILL_UNARMED, 3, CHARACTER_SKILL_UNARMED);
 
     // Thieves
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_THIEVES, CHARACTER_ATTRIBUTE_SKILL_STEALING, 3, CHARACTER_SKILL_STEALING);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_THIEVES, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 3, CHARACTER_SKILL_TRAP_DISARM);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_THIEVES, CHARACTER_ATTRIBUTE_SKILL_STEALING, 3, CHARACTER_SKILL_STEALING);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_THIEVES, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 3, CHARACTER_SKILL_TRAP_DISARM);
 
     // of Identifying
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_IDENTIFYING, CHARACTER_ATTRIBUTE_SKILL_ITEM_ID, 3, CHARACTER_SKILL_ITEM_ID);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_IDENTIFYING, CHARACTER_ATTRIBUTE_SKILL_MONSTER_ID, 3, CHARACTER_SKILL_MONSTER_ID);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_IDENTIFYING, CHARACTER_ATTRIBUTE_SKILL_ITEM_ID, 3, CHARACTER_SKILL_ITEM_ID);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_IDENTIFYING, CHARACTER_ATTRIBUTE_SKILL_MONSTER_ID, 3, CHARACTER_SKILL_MONSTER_ID);
 
     // Assassins
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_ASSASINS, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 2, CHARACTER_SKILL_TRAP_DISARM);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_ASSASINS, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 2, CHARACTER_SKILL_TRAP_DISARM);
 
     // Barbarians
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_BARBARIANS, CHARACTER_ATTRIBUTE_AC_BONUS, 5);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_BARBARIANS, CHARACTER_ATTRIBUTE_AC_BONUS, 5);
 
     // of the Storm
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_STORM, CHARACTER_ATTRIBUTE_RESIST_AIR, 20);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_STORM, CHARACTER_ATTRIBUTE_RESIST_AIR, 20);
 
     // of the Ocean
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_OCEAN, CHARACTER_ATTRIBUTE_RESIST_WATER, 10);
-    AddToMap(specialBonusMap, ITEM_ENCHANTMENT_OF_OCEAN, CHARACTER_ATTRIBUTE_SKILL_ALCHEMY, 2, CHARACTER_SKILL_ALCHEMY);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_OCEAN, CHARACTER_ATTRIBUTE_RESIST_WATER, 10);
+    AddToTable(specialBonusTable, ITEM_ENCHANTMENT_OF_OCEAN, CHARACTER_ATTRIBUTE_SKILL_ALCHEMY, 2, CHARACTER_SKILL_ALCHEMY);
 }
 
-// TODO: where is it used?
-void ItemGen::PopulateRegularBonusMap() {
-    // of Might
-    AddToMap(regularBonusMap, 1, CHARACTER_ATTRIBUTE_MIGHT);
-
-    // of Thought
-    AddToMap(regularBonusMap, 2, CHARACTER_ATTRIBUTE_INTELLIGENCE);
-
-    // of Charm
-    AddToMap(regularBonusMap, 3, CHARACTER_ATTRIBUTE_PERSONALITY);
-
-    // of Vigor
-    AddToMap(regularBonusMap, 4, CHARACTER_ATTRIBUTE_ENDURANCE);
-
-    // of Precision
-    AddToMap(regularBonusMap, 5, CHARACTER_ATTRIBUTE_ACCURACY);
-
-    // of Speed
-    AddToMap(regularBonusMap, 6, CHARACTER_ATTRIBUTE_SPEED);
-
-    // of Luck
-    AddToMap(regularBonusMap, 7, CHARACTER_ATTRIBUTE_LUCK);
-
-    // of Health
-    AddToMap(regularBonusMap, 8, CHARACTER_ATTRIBUTE_HEALTH);
-
-    // of Magic
-    AddToMap(regularBonusMap, 9, CHARACTER_ATTRIBUTE_MANA);
-
-    // of Defense
-    AddToMap(regularBonusMap, 10, CHARACTER_ATTRIBUTE_AC_BONUS);
-
-    // of Fire Resistance
-    AddToMap(regularBonusMap, 11, CHARACTER_ATTRIBUTE_RESIST_FIRE);
-
-    // of Air Resistance
-    AddToMap(regularBonusMap, 12, CHARACTER_ATTRIBUTE_RESIST_AIR);
-
-    // of Water Resistance
-    AddToMap(regularBonusMap, 13, CHARACTER_ATTRIBUTE_RESIST_WATER);
-
-    // of Earth Resistance
-    AddToMap(regularBonusMap, 14, CHARACTER_ATTRIBUTE_RESIST_EARTH);
-
-    // of Mind Resistance
-    AddToMap(regularBonusMap, 15, CHARACTER_ATTRIBUTE_RESIST_MIND);
-
-    // of Body Resistance
-    AddToMap(regularBonusMap, 16, CHARACTER_ATTRIBUTE_RESIST_BODY);
-
-    // of Alchemy
-    AddToMap(regularBonusMap, 17, CHARACTER_ATTRIBUTE_SKILL_ALCHEMY);
+void ItemGen::PopulateArtifactBonusTable() {
+    artifactBonusTable.fill({});
 
-    // of Stealing
-    AddToMap(regularBonusMap, 18, CHARACTER_ATTRIBUTE_SKILL_STEALING);
-
-    // of Disarming
-    AddToMap(regularBonusMap, 19, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM);
-
-    // of Items
-    AddToMap(regularBonusMap, 20, CHARACTER_ATTRIBUTE_SKILL_ITEM_ID);
-
-    // of Monsters
-    AddToMap(regularBonusMap, 21, CHARACTER_ATTRIBUTE_SKILL_MONSTER_ID);
-
-    // of Arms
-    AddToMap(regularBonusMap, 22, CHARACTER_ATTRIBUTE_SKILL_ARMSMASTER);
-
-    // of Dodging
-    AddToMap(regularBonusMap, 23, CHARACTER_ATTRIBUTE_SKILL_DODGE);
-
-    // of the Fist
-    AddToMap(regularBonusMap, 24, CHARACTER_ATTRIBUTE_SKILL_UNARMED);
-}
-
-void ItemGen::PopulateArtifactBonusMap() {
     // Puck
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_PUCK, CHARACTER_ATTRIBUTE_SPEED, 40);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_PUCK, CHARACTER_ATTRIBUTE_SPEED, 40);
 
     // Iron Feather
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_IRON_FEATHER, CHARACTER_ATTRIBUTE_MIGHT, 40);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_IRON_FEATHER, CHARACTER_ATTRIBUTE_MIGHT, 40);
 
     // Wallace
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_WALLACE, CHARACTER_ATTRIBUTE_SKILL_ARMSMASTER, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_WALLACE, CHARACTER_ATTRIBUTE_PERSONALITY, 40);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_WALLACE, CHARACTER_ATTRIBUTE_SKILL_ARMSMASTER, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_WALLACE, CHARACTER_ATTRIBUTE_PERSONALITY, 40);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_CORSAIR, CHARACTER_ATTRIBUTE_LUCK, 40);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_CORSAIR, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 5);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_CORSAIR, CHARACTER_ATTRIBUTE_SKILL_STEALING, 5);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_CORSAIR, CHARACTER_ATTRIBUTE_LUCK, 40);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_CORSAIR, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 5);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_CORSAIR, CHARACTER_ATTRIBUTE_SKILL_STEALING, 5);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_MIGHT, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_INTELLIGENCE, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_PERSONALITY, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_ENDURANCE, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_ACCURACY, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_SPEED, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_LUCK, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_MIGHT, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_INTELLIGENCE, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_PERSONALITY, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_ENDURANCE, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_ACCURACY, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_SPEED, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_GOVERNORS_ARMOR, CHARACTER_ATTRIBUTE_LUCK, 10);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_YORUBA, CHARACTER_ATTRIBUTE_ENDURANCE, 25);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_YORUBA, CHARACTER_ATTRIBUTE_ENDURANCE, 25);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_SPLITTER, CHARACTER_ATTRIBUTE_RESIST_FIRE, 50);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_SPLITTER, CHARACTER_ATTRIBUTE_RESIST_FIRE, 50);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_ULLYSES, CHARACTER_ATTRIBUTE_ACCURACY, 50);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_ULLYSES, CHARACTER_ATTRIBUTE_ACCURACY, 50);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_HANDS_OF_THE_MASTER, CHARACTER_ATTRIBUTE_SKILL_DODGE, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_HANDS_OF_THE_MASTER, CHARACTER_ATTRIBUTE_SKILL_UNARMED, 10);
-
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_SEVEN_LEAGUE_BOOTS, CHARACTER_ATTRIBUTE_SPEED, 40);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_SEVEN_LEAGUE_BOOTS, CHARACTER_ATTRIBUTE_SKILL_WATER, 0, CHARACTER_SKILL_WATER);
-
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_RULERS_RING, CHARACTER_ATTRIBUTE_SKILL_MIND, 0, CHARACTER_SKILL_MIND);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_RULERS_RING, CHARACTER_ATTRIBUTE_SKILL_DARK, 0, CHARACTER_SKILL_DARK);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_MASH, CHARACTER_ATTRIBUTE_MIGHT, 150);
-    AddToMap(artifactBonusMap, ITEM_RELIC_MASH, CHARACTER_ATTRIBUTE_INTELLIGENCE, -40);
-    AddToMap(artifactBonusMap, ITEM_RELIC_MASH, CHARACTER_ATTRIBUTE_PERSONALITY, -40);
-    AddToMap(artifactBonusMap, ITEM_RELIC_MASH, CHARACTER_ATTRIBUTE_SPEED, -40);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_ETHRICS_STAFF, CHARACTER_ATTRIBUTE_SKILL_DARK, 0, CHARACTER_SKILL_DARK);
-    AddToMap(artifactBonusMap, ITEM_RELIC_ETHRICS_STAFF, CHARACTER_ATTRIBUTE_SKILL_MEDITATION, 15);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 5);
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_SKILL_STEALING, 5);
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_LUCK, 50);
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_FIRE, -10);
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_WATER, -10);
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_AIR, -10);
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_EARTH, -10);
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_MIND, -10);
-    AddToMap(artifactBonusMap, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_BODY, -10);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_OLD_NICK, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 5);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_AMUCK, CHARACTER_ATTRIBUTE_MIGHT, 100);
-    AddToMap(artifactBonusMap, ITEM_RELIC_AMUCK, CHARACTER_ATTRIBUTE_ENDURANCE, 100);
-    AddToMap(artifactBonusMap, ITEM_RELIC_AMUCK, CHARACTER_ATTRIBUTE_AC_BONUS, -15);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_GLORY_SHIELD, CHARACTER_ATTRIBUTE_SKILL_SPIRIT, 0, CHARACTER_SKILL_SPIRIT);
-    AddToMap(artifactBonusMap, ITEM_RELIC_GLORY_SHIELD, CHARACTER_ATTRIBUTE_SKILL_SHIELD, 5);
-    AddToMap(artifactBonusMap, ITEM_RELIC_GLORY_SHIELD, CHARACTER_ATTRIBUTE_RESIST_MIND, -10);
-    AddToMap(artifactBonusMap, ITEM_RELIC_GLORY_SHIELD, CHARACTER_ATTRIBUTE_RESIST_BODY, -10);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_KELEBRIM, CHARACTER_ATTRIBUTE_ENDURANCE, 50);
-    AddToMap(artifactBonusMap, ITEM_RELIC_KELEBRIM, CHARACTER_ATTRIBUTE_RESIST_EARTH, -30);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_TALEDONS_HELM, CHARACTER_ATTRIBUTE_SKILL_LIGHT, 0, CHARACTER_SKILL_LIGHT);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TALEDONS_HELM, CHARACTER_ATTRIBUTE_PERSONALITY, 15);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TALEDONS_HELM, CHARACTER_ATTRIBUTE_MIGHT, 15);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TALEDONS_HELM, CHARACTER_ATTRIBUTE_LUCK, -40);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_SCHOLARS_CAP, CHARACTER_ATTRIBUTE_SKILL_LEARNING, +15);
-    AddToMap(artifactBonusMap, ITEM_RELIC_SCHOLARS_CAP, CHARACTER_ATTRIBUTE_ENDURANCE, -50);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_PHYNAXIAN_CROWN, CHARACTER_ATTRIBUTE_SKILL_FIRE, 0, CHARACTER_SKILL_FIRE);
-    AddToMap(artifactBonusMap, ITEM_RELIC_PHYNAXIAN_CROWN, CHARACTER_ATTRIBUTE_RESIST_WATER, +50);
-    AddToMap(artifactBonusMap, ITEM_RELIC_PHYNAXIAN_CROWN, CHARACTER_ATTRIBUTE_PERSONALITY, 30);
-    AddToMap(artifactBonusMap, ITEM_RELIC_PHYNAXIAN_CROWN, CHARACTER_ATTRIBUTE_AC_BONUS, -20);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_TITANS_BELT, CHARACTER_ATTRIBUTE_MIGHT, 75);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TITANS_BELT, CHARACTER_ATTRIBUTE_SPEED, -40);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_SPEED, 50);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_LUCK, 50);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_FIRE, -15);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_WATER, -15);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_AIR, -15);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_EARTH, -15);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_MIND, -15);
-    AddToMap(artifactBonusMap, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_BODY, -15);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_ANIA_SELVING, CHARACTER_ATTRIBUTE_ACCURACY, 150);
-    AddToMap(artifactBonusMap, ITEM_RELIC_ANIA_SELVING, CHARACTER_ATTRIBUTE_SKILL_BOW, 5);
-    AddToMap(artifactBonusMap, ITEM_RELIC_ANIA_SELVING, CHARACTER_ATTRIBUTE_AC_BONUS, -25);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_JUSTICE, CHARACTER_ATTRIBUTE_SKILL_MIND, 0, CHARACTER_SKILL_MIND);
-    AddToMap(artifactBonusMap, ITEM_RELIC_JUSTICE, CHARACTER_ATTRIBUTE_SKILL_BODY, 0, CHARACTER_SKILL_BODY);
-    AddToMap(artifactBonusMap, ITEM_RELIC_JUSTICE, CHARACTER_ATTRIBUTE_SPEED, -40);
-
-    AddToMap(artifactBonusMap, ITEM_RELIC_MEKORIGS_HAMMER, CHARACTER_ATTRIBUTE_SKILL_SPIRIT, 0, CHARACTER_SKILL_SPIRIT);
-    AddToMap(artifactBonusMap, ITEM_RELIC_MEKORIGS_HAMMER, CHARACTER_ATTRIBUTE_MIGHT, 75);
-    AddToMap(artifactBonusMap, ITEM_RELIC_MEKORIGS_HAMMER, CHARACTER_ATTRIBUTE_RESIST_AIR, -50);
-
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_HERMES_SANDALS, CHARACTER_ATTRIBUTE_SPEED, 100);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_HERMES_SANDALS, CHARACTER_ATTRIBUTE_ACCURACY, 50);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_HERMES_SANDALS, CHARACTER_ATTRIBUTE_RESIST_AIR, 50);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_HANDS_OF_THE_MASTER, CHARACTER_ATTRIBUTE_SKILL_DODGE, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_HANDS_OF_THE_MASTER, CHARACTER_ATTRIBUTE_SKILL_UNARMED, 10);
+
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_SEVEN_LEAGUE_BOOTS, CHARACTER_ATTRIBUTE_SPEED, 40);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_SEVEN_LEAGUE_BOOTS, CHARACTER_ATTRIBUTE_SKILL_WATER, 0, CHARACTER_SKILL_WATER);
+
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_RULERS_RING, CHARACTER_ATTRIBUTE_SKILL_MIND, 0, CHARACTER_SKILL_MIND);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_RULERS_RING, CHARACTER_ATTRIBUTE_SKILL_DARK, 0, CHARACTER_SKILL_DARK);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_MASH, CHARACTER_ATTRIBUTE_MIGHT, 150);
+    AddToTable(artifactBonusTable, ITEM_RELIC_MASH, CHARACTER_ATTRIBUTE_INTELLIGENCE, -40);
+    AddToTable(artifactBonusTable, ITEM_RELIC_MASH, CHARACTER_ATTRIBUTE_PERSONALITY, -40);
+    AddToTable(artifactBonusTable, ITEM_RELIC_MASH, CHARACTER_ATTRIBUTE_SPEED, -40);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_ETHRICS_STAFF, CHARACTER_ATTRIBUTE_SKILL_DARK, 0, CHARACTER_SKILL_DARK);
+    AddToTable(artifactBonusTable, ITEM_RELIC_ETHRICS_STAFF, CHARACTER_ATTRIBUTE_SKILL_MEDITATION, 15);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 5);
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_SKILL_STEALING, 5);
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_LUCK, 50);
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_FIRE, -10);
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_WATER, -10);
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_AIR, -10);
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_EARTH, -10);
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_MIND, -10);
+    AddToTable(artifactBonusTable, ITEM_RELIC_HARECKS_LEATHER, CHARACTER_ATTRIBUTE_RESIST_BODY, -10);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_OLD_NICK, CHARACTER_ATTRIBUTE_SKILL_TRAP_DISARM, 5);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_AMUCK, CHARACTER_ATTRIBUTE_MIGHT, 100);
+    AddToTable(artifactBonusTable, ITEM_RELIC_AMUCK, CHARACTER_ATTRIBUTE_ENDURANCE, 100);
+    AddToTable(artifactBonusTable, ITEM_RELIC_AMUCK, CHARACTER_ATTRIBUTE_AC_BONUS, -15);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_GLORY_SHIELD, CHARACTER_ATTRIBUTE_SKILL_SPIRIT, 0, CHARACTER_SKILL_SPIRIT);
+    AddToTable(artifactBonusTable, ITEM_RELIC_GLORY_SHIELD, CHARACTER_ATTRIBUTE_SKILL_SHIELD, 5);
+    AddToTable(artifactBonusTable, ITEM_RELIC_GLORY_SHIELD, CHARACTER_ATTRIBUTE_RESIST_MIND, -10);
+    AddToTable(artifactBonusTable, ITEM_RELIC_GLORY_SHIELD, CHARACTER_ATTRIBUTE_RESIST_BODY, -10);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_KELEBRIM, CHARACTER_ATTRIBUTE_ENDURANCE, 50);
+    AddToTable(artifactBonusTable, ITEM_RELIC_KELEBRIM, CHARACTER_ATTRIBUTE_RESIST_EARTH, -30);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_TALEDONS_HELM, CHARACTER_ATTRIBUTE_SKILL_LIGHT, 0, CHARACTER_SKILL_LIGHT);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TALEDONS_HELM, CHARACTER_ATTRIBUTE_PERSONALITY, 15);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TALEDONS_HELM, CHARACTER_ATTRIBUTE_MIGHT, 15);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TALEDONS_HELM, CHARACTER_ATTRIBUTE_LUCK, -40);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_SCHOLARS_CAP, CHARACTER_ATTRIBUTE_SKILL_LEARNING, +15);
+    AddToTable(artifactBonusTable, ITEM_RELIC_SCHOLARS_CAP, CHARACTER_ATTRIBUTE_ENDURANCE, -50);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_PHYNAXIAN_CROWN, CHARACTER_ATTRIBUTE_SKILL_FIRE, 0, CHARACTER_SKILL_FIRE);
+    AddToTable(artifactBonusTable, ITEM_RELIC_PHYNAXIAN_CROWN, CHARACTER_ATTRIBUTE_RESIST_WATER, +50);
+    AddToTable(artifactBonusTable, ITEM_RELIC_PHYNAXIAN_CROWN, CHARACTER_ATTRIBUTE_PERSONALITY, 30);
+    AddToTable(artifactBonusTable, ITEM_RELIC_PHYNAXIAN_CROWN, CHARACTER_ATTRIBUTE_AC_BONUS, -20);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_TITANS_BELT, CHARACTER_ATTRIBUTE_MIGHT, 75);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TITANS_BELT, CHARACTER_ATTRIBUTE_SPEED, -40);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_SPEED, 50);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_LUCK, 50);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_FIRE, -15);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_WATER, -15);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_AIR, -15);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_EARTH, -15);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_MIND, -15);
+    AddToTable(artifactBonusTable, ITEM_RELIC_TWILIGHT, CHARACTER_ATTRIBUTE_RESIST_BODY, -15);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_ANIA_SELVING, CHARACTER_ATTRIBUTE_ACCURACY, 150);
+    AddToTable(artifactBonusTable, ITEM_RELIC_ANIA_SELVING, CHARACTER_ATTRIBUTE_SKILL_BOW, 5);
+    AddToTable(artifactBonusTable, ITEM_RELIC_ANIA_SELVING, CHARACTER_ATTRIBUTE_AC_BONUS, -25);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_JUSTICE, CHARACTER_ATTRIBUTE_SKILL_MIND, 0, CHARACTER_SKILL_MIND);
+    AddToTable(artifactBonusTable, ITEM_RELIC_JUSTICE, CHARACTER_ATTRIBUTE_SKILL_BODY, 0, CHARACTER_SKILL_BODY);
+    AddToTable(artifactBonusTable, ITEM_RELIC_JUSTICE, CHARACTER_ATTRIBUTE_SPEED, -40);
+
+    AddToTable(artifactBonusTable, ITEM_RELIC_MEKORIGS_HAMMER, CHARACTER_ATTRIBUTE_SKILL_SPIRIT, 0, CHARACTER_SKILL_SPIRIT);
+    AddToTable(artifactBonusTable, ITEM_RELIC_MEKORIGS_HAMMER, CHARACTER_ATTRIBUTE_MIGHT, 75);
+    AddToTable(artifactBonusTable, ITEM_RELIC_MEKORIGS_HAMMER, CHARACTER_ATTRIBUTE_RESIST_AIR, -50);
+
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_HERMES_SANDALS, CHARACTER_ATTRIBUTE_SPEED, 100);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_HERMES_SANDALS, CHARACTER_ATTRIBUTE_ACCURACY, 50);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_HERMES_SANDALS, CHARACTER_ATTRIBUTE_RESIST_AIR, 50);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_CLOAK_OF_THE_SHEEP, CHARACTER_ATTRIBUTE_PERSONALITY, -20);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_CLOAK_OF_THE_SHEEP, CHARACTER_ATTRIBUTE_INTELLIGENCE, -20);
-
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_MINDS_EYE, CHARACTER_ATTRIBUTE_PERSONALITY, 15);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_MINDS_EYE, CHARACTER_ATTRIBUTE_INTELLIGENCE, 15);
-
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_ELVEN_CHAINMAIL, CHARACTER_ATTRIBUTE_SPEED, 15);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_ELVEN_CHAINMAIL, CHARACTER_ATTRIBUTE_ACCURACY, 15);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_CLOAK_OF_THE_SHEEP, CHARACTER_ATTRIBUTE_PERSONALITY, -20);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_CLOAK_OF_THE_SHEEP, CHARACTER_ATTRIBUTE_INTELLIGENCE, -20);
+
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_MINDS_EYE, CHARACTER_ATTRIBUTE_PERSONALITY, 15);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_MINDS_EYE, CHARACTER_ATTRIBUTE_INTELLIGENCE, 15);
+
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_ELVEN_CHAINMAIL, CHARACTER_ATTRIBUTE_SPEED, 15);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_ELVEN_CHAINMAIL, CHARACTER_ATTRIBUTE_ACCURACY, 15);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_FORGE_GAUNTLETS, CHARACTER_ATTRIBUTE_MIGHT, 15);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_FORGE_GAUNTLETS, CHARACTER_ATTRIBUTE_ENDURANCE, 15);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_FORGE_GAUNTLETS, CHARACTER_ATTRIBUTE_RESIST_FIRE, 30);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_FORGE_GAUNTLETS, CHARACTER_ATTRIBUTE_MIGHT, 15);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_FORGE_GAUNTLETS, CHARACTER_ATTRIBUTE_ENDURANCE, 15);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_FORGE_GAUNTLETS, CHARACTER_ATTRIBUTE_RESIST_FIRE, 30);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_HEROS_BELT, CHARACTER_ATTRIBUTE_MIGHT, 15);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_HEROS_BELT, CHARACTER_ATTRIBUTE_SKILL_ARMSMASTER, 5);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_HEROS_BELT, CHARACTER_ATTRIBUTE_MIGHT, 15);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_HEROS_BELT, CHARACTER_ATTRIBUTE_SKILL_ARMSMASTER, 5);
 
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_FIRE, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_AIR, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_WATER, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_EARTH, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_MIND, 10);
-    AddToMap(artifactBonusMap, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_BODY, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_FIRE, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_AIR, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_WATER, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_EARTH, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_MIND, 10);
+    AddToTable(artifactBonusTable, ITEM_ARTIFACT_LADYS_ESCORT, CHARACTER_ATTRIBUTE_RESIST_BODY, 10);
 }
 
-void ItemGen::GetItemBonusSpecialEnchantment(const Character *owner,
-                                             CharacterAttributeType attrToGet,
-                                             int *additiveBonus,
-                                             int *halfSkillBonus) const {
-    auto pos = specialBonusMap.find(this->special_enchantment);
-    if (pos == specialBonusMap.end())
-        return;
-
-    auto subpos = pos->second.find(attrToGet);
-    if (subpos == pos->second.end())
-        return;
-
-    const CEnchantment &currBonus = subpos->second;
-    if (currBonus.skillType != CHARACTER_SKILL_INVALID) {
-        if (currBonus.statBonus == 0) {
-            *halfSkillBonus = owner->pActiveSkills[currBonus.skillType].level() / 2;
-        } else {
-            if (*additiveBonus < currBonus.statBonus) {
-                *additiveBonus = currBonus.statBonus;
-            }
-        }
-    } else {
-        *additiveBonus += currBonus.statBonus;
-    }
+const CEnchantment &ItemGen::specialEnchantmentBonus(ItemEnchantment enchantment, CharacterAttributeType attribute) {
+    if (enchantment < ITEM_ENCHANTMENT_FIRST_VALID || enchantment > ITEM_ENCHANTMENT_LAST_VALID)
+        return emptyBonus;
+    return specialBonusTable[enchantment][attribute];
 }
 
-void ItemGen::GetItemBonusArtifact(const Character *owner,
-                                   CharacterAttributeType attrToGet,
-                                   int *bonusSum) const {
-    auto pos = artifactBonusMap.find(this->uItemID);
-    if (pos == artifactBonusMap.end())
-        return;
-
-    auto subpos = pos->second.find(attrToGet);
-    if (subpos == pos->second.end())
-        return;
-
-    const CEnchantment &currBonus = subpos->second;
-    if (currBonus.skillType != CHARACTER_SKILL_INVALID) {
-        *bonusSum = owner->pActiveSkills[currBonus.skillType].level() / 2;
-    } else {
-        *bonusSum += currBonus.statBonus;
-    }
+const CEnchantment &ItemGen::artifactBonus(ItemId itemId, CharacterAttributeType attribute) {
+    if (itemId < ITEM_FIRST_ARTIFACT || itemId > ITEM_LAST_ARTIFACT)
+        return emptyBonus;
+    return artifactBonusTable[itemId][attribute];
 }
 
 bool ItemGen::IsRegularEnchanmentForAttribute(CharacterAttributeType attrToGet) {
@@ -15,15 +15,27 @@
 #include "GUI/UI/UIHouseEnums.h"
 
 class Character;
+struct CEnchantment;
 
 struct ItemGen {  // 0x24
-    static void PopulateSpecialBonusMap();
-    static void PopulateRegularBonusMap();
-    static void PopulateArtifactBonusMap();
-    static void ClearItemBonusMaps();
-
-    void GetItemBonusArtifact(const Character *owner, CharacterAttributeType attrToGet, int *bonusSum) const;
-    void GetItemBonusSpecialEnchantment(const Character *owner, CharacterAttributeType attrToGet, int *additiveBonus, int *halfSkillBonus) const;
+    static void PopulateSpecialBonusTable();
+    static void PopulateArtifactBonusTable();
+
+    /**
+     * @param enchantment               Special enchantment, e.g. `ITEM_ENCHANTMENT_OF_GODS`.
+     * @param attribute                 Attribute to get the bonus for.
+     * @return                          Bonus that the special enchantment gives to the attribute. Default-constructed
+     *                                  `CEnchantment` if there is none.
+     */
+    static const CEnchantment &specialEnchantmentBonus(ItemEnchantment enchantment, CharacterAttributeType attribute);
+
+    /**
+     * @param itemId                    Artifact or relic item id. Other items are accepted, but never have any bonuses.
+     * @param attribute                 Attribute to get the bonus for.
+     * @return                          Bonus that the artifact gives to the attribute. Default-constructed
+     *                                  `CEnchantment` if there is none.
+     */
+    static const CEnchantment &artifactBonus(ItemId itemId, CharacterAttributeType attribute);
 
     inline void ResetEnchantAnimation() { uAttributes &= ~ITEM_ENCHANT_ANIMATION_MASK; }
     inline bool ItemEnchanted() const {
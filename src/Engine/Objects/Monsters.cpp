@@ -309,9 +309,9 @@ void MonsterStats::InitializePlacements(const Blob &placements) {
     //  int item_counter;
 
     std::string txtRaw(placements.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
     for (i = 1; i < 31; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -353,13 +353,13 @@ void MonsterStats::Initialize(const Blob &monsters) {
     std::string str;
 
     std::string txtRaw(monsters.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
+    strtokThreadLocal(NULL, "\r");
+    strtokThreadLocal(NULL, "\r");
+    strtokThreadLocal(NULL, "\r");
     curr_rec_num = MONSTER_INVALID;
     for (i = 0; i < 264; ++i) { // TODO(captainurist): get rid of magic numbers in txt deserialization.
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
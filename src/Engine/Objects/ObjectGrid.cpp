@@ -0,0 +1,115 @@
+#include "ObjectGrid.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/Monsters.h"
+#include "Engine/Objects/ObjectList.h"
+#include "Engine/Objects/SpriteObject.h"
+
+#include "Library/Geometry/SpatialHash.h"
+
+static constexpr int OBJECT_GRID_CELL_SIZE = 512;
+
+static SpatialHash actorGrid(OBJECT_GRID_CELL_SIZE);
+static int actorGridSize = 0; // Number of actors indexed in the last refresh.
+static int actorGridMargin = 0; // Max collision radius of the indexed actors.
+static std::vector<int> actorGridReusedSlots; // Slots below `actorGridSize` that were reused since the last refresh.
+
+static SpatialHash spriteObjectGrid(OBJECT_GRID_CELL_SIZE);
+static int spriteObjectGridSize = 0; // Number of sprite object slots that might be in the grid.
+static int spriteObjectGridMargin = 0; // Max collision radius of all sprite object descs.
+static int spriteObjectGridUpdates = 0; // Number of `updateSpriteObjectGrid` calls.
+
+static BBoxi expandedBox(const BBoxf &box, int margin) {
+    // +1 to be on the safe side with float => int conversions, results are checked precisely by the caller anyway.
+    BBoxi result;
+    result.x1 = static_cast<int>(std::floor(box.x1)) - margin - 1;
+    result.x2 = static_cast<int>(std::ceil(box.x2)) + margin + 1;
+    result.y1 = static_cast<int>(std::floor(box.y1)) - margin - 1;
+    result.y2 = static_cast<int>(std::ceil(box.y2)) + margin + 1;
+    result.z1 = static_cast<int>(std::floor(box.z1));
+    result.z2 = static_cast<int>(std::ceil(box.z2));
+    return result;
+}
+
+static void indexSpriteObject(int spriteObjectId) {
+    const SpriteObject &spriteObject = pSpriteObjects[spriteObjectId];
+    if (spriteObject.uObjectDescID == 0) {
+        spriteObjectGrid.erase(spriteObjectId);
+    } else {
+        spriteObjectGrid.update(spriteObjectId, spriteObject.vPosition);
+    }
+}
+
+void refreshActorGrid() {
+    for (int i = pActors.size(); i < actorGridSize; i++)
+        actorGrid.erase(i);
+
+    actorGridSize = pActors.size();
+    actorGridMargin = 0;
+    actorGridReusedSlots.clear();
+    for (int i = 0; i < actorGridSize; i++) {
+        const Actor &actor = pActors[i];
+        actorGrid.update(i, actor.pos);
+
+        // Sprite objects collide with actors using monster's to-hit radius, see `SpriteObject::updateObjectBLV`.
+        actorGridMargin = std::max<int>(actorGridMargin, actor.radius);
+        if (actor.word_000086_some_monster_id != MONSTER_INVALID)
+            actorGridMargin = std::max<int>(actorGridMargin, pMonsterList->monsters[actor.word_000086_some_monster_id].toHitRadius);
+    }
+}
+
+void markActorGridSlotReused(int actorId) {
+    if (actorId < actorGridSize)
+        actorGridReusedSlots.push_back(actorId);
+}
+
+void refreshSpriteObjectGrid() {
+    if (spriteObjectGridMargin == 0)
+        for (const ObjectDesc &desc : pObjectList->pObjects)
+            spriteObjectGridMargin = std::max<int>(spriteObjectGridMargin, desc.uRadius);
+
+    for (int i = pSpriteObjects.size(); i < spriteObjectGridSize; i++)
+        spriteObjectGrid.erase(i);
+
+    spriteObjectGridSize = pSpriteObjects.size();
+    for (int i = 0; i < spriteObjectGridSize; i++)
+        indexSpriteObject(i);
+}
+
+void updateSpriteObjectGrid(int spriteObjectId) {
+    indexSpriteObject(spriteObjectId);
+    spriteObjectGridSize = std::max(spriteObjectGridSize, spriteObjectId + 1);
+    spriteObjectGridUpdates++;
+}
+
+void findActorsNear(const BBoxf &box, std::vector<int> *ids) {
+    actorGrid.queryBox(expandedBox(box, actorGridMargin), ids);
+
+    // Reused slots are indexed at the positions of the actors that were removed, and are not positioned yet when
+    // the slot is handed out, so there is nothing to re-index. Returning them unconditionally is cheap, as the list
+    // is almost always empty.
+    if (!actorGridReusedSlots.empty()) {
+        ids->insert(ids->end(), actorGridReusedSlots.begin(), actorGridReusedSlots.end());
+        std::sort(ids->begin(), ids->end());
+        ids->erase(std::unique(ids->begin(), ids->end()), ids->end());
+    }
+
+    // Actors that were spawned after the last refresh are not in the grid.
+    for (int i = actorGridSize; i < static_cast<int>(pActors.size()); i++)
+        ids->push_back(i);
+}
+
+void findSpriteObjectsNear(const BBoxf &box, std::vector<int> *ids) {
+    spriteObjectGrid.queryBox(expandedBox(box, spriteObjectGridMargin), ids);
+
+    // `pSpriteObjects` might have been compacted since the last refresh, see `CompactLayingItemsList`.
+    while (!ids->empty() && ids->back() >= static_cast<int>(pSpriteObjects.size()))
+        ids->pop_back();
+}
+
+int spriteObjectGridRevision() {
+    return spriteObjectGridUpdates;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+
+#include "Library/Geometry/BBox.h"
+
+/**
+ * Broadphase for the dynamic objects in the current level - actors and sprite objects are hashed by world XY cell, see
+ * `SpatialHash`.
+ *
+ * Actor positions are re-indexed at the start of each frame in `Actor::UpdateActorAI`. Actors then stay in place until
+ * `UpdateActors_BLV` / `UpdateActors_ODM`, and collision checks against actors are done before that. Actors spawned in
+ * between are placed after `AllocateActor` returns, so they are not indexed, and are always returned from
+ * `findActorsNear` until the next refresh instead. Sprite objects
+ * are re-indexed right after they are moved in `UpdateObjects`, newly created sprite objects are indexed in
+ * `SpriteObject::Create`.
+ *
+ * The party is not indexed - it's a single object, and everything that collides with it just checks it directly.
+ */
+
+/**
+ * Re-indexes all actors in `pActors`.
+ */
+void refreshActorGrid();
+
+/**
+ * Marks an actor slot as reused, see `AllocateActor`. Until the next `refreshActorGrid` call, the actor is always
+ * returned from `findActorsNear`.
+ *
+ * @param actorId                       Index of the actor in `pActors`.
+ */
+void markActorGridSlotReused(int actorId);
+
+/**
+ * Re-indexes all sprite objects in `pSpriteObjects`.
+ */
+void refreshSpriteObjectGrid();
+
+/**
+ * Re-indexes a single sprite object.
+ *
+ * @param spriteObjectId                Index of the sprite object in `pSpriteObjects`.
+ */
+void updateSpriteObjectGrid(int spriteObjectId);
+
+/**
+ * @param box                           Box to check against.
+ * @param[out] ids                      Ids of the actors whose collision cylinders might intersect `box`, sorted in
+ *                                      ascending order. Actors that were added or whose slots were reused after the
+ *                                      last refresh are always returned. Previous contents are discarded.
+ */
+void findActorsNear(const BBoxf &box, std::vector<int> *ids);
+
+/**
+ * @param box                           Box to check against.
+ * @param[out] ids                      Ids of the sprite objects whose collision cylinders might intersect `box`,
+ *                                      sorted in ascending order. Ids of removed sprite objects might also be
+ *                                      returned. Previous contents are discarded.
+ */
+void findSpriteObjectsNear(const BBoxf &box, std::vector<int> *ids);
+
+/**
+ * @return                              Counter that's incremented on every `updateSpriteObjectGrid` call. Can be used
+ *                                      to check whether the result of `findSpriteObjectsNear` is still complete.
+ */
+int spriteObjectGridRevision();
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/SpellFxRenderer.h"
@@ -17,6 +18,7 @@
 #include "Engine/Random/Random.h"
 
 #include "Engine/Objects/Actor.h"
+#include "Engine/Objects/ObjectGrid.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
 #include "Engine/Objects/SpriteEnumFunctions.h"
@@ -33,6 +35,8 @@
 
 #include "Media/Audio/AudioPlayer.h"
 
+#include "Library/Profiler/Profiler.h"
+
 #include "Utility/Math/TrigLut.h"
 #include "Utility/Math/FixPoint.h"
 
@@ -109,6 +113,7 @@ int SpriteObject::Create(int yaw, int pitch, int speed, int which_char) {
         pSpriteObjects.resize(sprite_slot + 1);
     }
     pSpriteObjects[sprite_slot] = *this;
+    updateSpriteObjectGrid(sprite_slot);
     return sprite_slot;
 }
 
@@ -143,6 +148,8 @@ static void createSpriteTrailParticle(Vec3i pos, ObjectDescFlags flags) {
 }
 
 void SpriteObject::updateObjectODM(unsigned int uLayingItemID) {
+    static std::vector<int> actorIds;
+
     ObjectDesc *object = &pObjectList->pObjects[pSpriteObjects[uLayingItemID].uObjectDescID];
     bool isHighSlope = IsTerrainSlopeTooHigh(pSpriteObjects[uLayingItemID].vPosition.x, pSpriteObjects[uLayingItemID].vPosition.y);
     int bmodelPid = 0;
@@ -244,14 +251,16 @@ void SpriteObject::updateObjectODM(unsigned int uLayingItemID) {
             int actorId = pSpriteObjects[uLayingItemID].spell_caster_pid.id();
             // TODO: why pActors.size() - 1? Should just check for .size()
             if ((actorId >= 0) && (actorId < (pActors.size() - 1))) {
-                for (int j = 0; j < pActors.size(); ++j) {
+                findActorsNear(collision_state.bbox, &actorIds);
+                for (int j : actorIds) {
                     if (pActors[actorId].GetActorsRelation(&pActors[j]) != HOSTILITY_FRIENDLY) {
                         CollideWithActor(j, 0);
                     }
                 }
             }
         } else {
-            for (int j = 0; j < pActors.size(); ++j) {
+            findActorsNear(collision_state.bbox, &actorIds);
+            for (int j : actorIds) {
                 CollideWithActor(j, 0);
             }
         }
@@ -343,6 +352,8 @@ void SpriteObject::updateObjectODM(unsigned int uLayingItemID) {
 
 //----- (0047136C) --------------------------------------------------------
 void SpriteObject::updateObjectBLV(unsigned int uLayingItemID) {
+    static std::vector<int> actorIds;
+
     SpriteObject *pSpriteObject = &pSpriteObjects[uLayingItemID];
     ObjectDesc *pObject = &pObjectList->pObjects[pSpriteObject->uObjectDescID];
 
@@ -393,7 +404,8 @@ LABEL_25:
                     CollideWithParty(true);
                 }
 
-                for (int actloop = 0; actloop < (signed int)pActors.size(); ++actloop) {
+                findActorsNear(collision_state.bbox, &actorIds);
+                for (int actloop : actorIds) {
                     // dont collide against self monster type
                     if (pSpriteObject->spell_caster_pid.type() == OBJECT_Actor) {
                         if (pActors[pSpriteObject->spell_caster_pid.id()].monsterInfo.id == pActors[actloop].monsterInfo.id) {
@@ -1295,6 +1307,8 @@ void applySpellSpriteDamage(unsigned int uLayingItemID, Pid pid) {
 }
 
 void UpdateObjects() {
+    MM_PROFILE_ZONE("UpdateObjects");
+
     for (unsigned i = 0; i < pSpriteObjects.size(); ++i) {
         if (pSpriteObjects[i].uAttributes & SPRITE_SKIP_A_FRAME) {
             pSpriteObjects[i].uAttributes &= ~SPRITE_SKIP_A_FRAME;
@@ -1362,6 +1376,8 @@ void UpdateObjects() {
             }
         }
     }
+
+    refreshSpriteObjectGrid();
 }
 
 unsigned int collideWithActor(unsigned int uLayingItemID, Pid pid) {
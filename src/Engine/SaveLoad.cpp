@@ -4,7 +4,11 @@
 #include <filesystem>
 #include <algorithm>
 #include <string>
-#include <memory>
+#include <string_view>
+#include <exception>
+#include <future>
+#include <map>
+#include <utility>
 
 #include "Engine/Engine.h"
 #include "Engine/LOD.h"
@@ -36,8 +40,12 @@
 #include "Library/Logger/Logger.h"
 #include "Library/LodFormats/LodFormats.h"
 #include "Library/Lod/LodWriter.h"
+#include "Library/Lod/LodJournal.h"
 
+#include "Utility/Streams/BlobOutputStream.h"
+#include "Utility/Streams/FileOutputStream.h"
 #include "Utility/DataPath.h"
+#include "Utility/ThreadPool.h"
 
 struct SavegameList *pSavegameList = new SavegameList;
 
@@ -49,28 +57,166 @@ static LodInfo makeSaveLodInfo() {
     return result;
 }
 
-void LoadGame(unsigned int uSlot) {
-    if (!pSavegameList->pSavegameUsedSlots[uSlot]) {
-        pAudioPlayer->playUISound(SOUND_error);
-        logger->warning("LoadGame: slot {} is empty", uSlot);
-        return;
+namespace {
+/**
+ * Writes a save into `data/new.lod` and into the save slot file in a single pass. Each entry is handed to both writers
+ * as it's produced, so the slot file doesn't need to be assembled from `new.lod` after the fact.
+ *
+ * `new.lod` is a LOD journal, so only the entries that have changed are appended to it. The save slot file is either a
+ * journal too, or a vanilla LOD file.
+ *
+ * Errors when writing `new.lod` are propagated to the caller. Errors when writing the save slot file are logged, and
+ * are reported from `closeSlot`.
+ */
+class SaveFileWriter {
+ public:
+    /**
+     * @param lodPath                   Path to the current save LOD, `data/new.lod`.
+     * @param slotPath                  Path to the save slot file, can be empty.
+     * @param slotJournaled             Whether the save slot file should be written as a LOD journal.
+     */
+    SaveFileWriter(const std::string &lodPath, const std::string &slotPath, bool slotJournaled) {
+        _lodWriter.open(lodPath, makeSaveLodInfo());
+
+        if (slotPath.empty())
+            return;
+
+        _slotPath = slotPath;
+        try {
+            if (slotJournaled) {
+                _slotJournalWriter.open(slotPath, makeSaveLodInfo());
+            } else {
+                _slotWriter.open(slotPath, makeSaveLodInfo());
+            }
+        } catch (const std::exception &e) {
+            fail(e);
+        }
     }
-    pSavegameList->selectedSlot = uSlot;
-    pSavegameList->lastLoadedSave = pSavegameList->pFileList[uSlot];
 
-    // TODO(captainurist): remained from Party::Reset, doesn't really belong here (or in Party::Reset).
-    current_character_screen_window = WINDOW_CharacterWindow_Stats;
+    /**
+     * Writes an entry that's already stored in `new.lod`, so only the save slot file needs it.
+     */
+    void writeUnchanged(const std::string &name, const Blob &data) {
+        writeSlot(name, data);
+    }
 
-    std::string filename = makeDataPath("saves", pSavegameList->pFileList[uSlot]);
-    std::string to_file_path = makeDataPath("data", "new.lod");
+    void write(const std::string &name, const Blob &data) {
+        _pendingFiles.erase(name);
+        _lodWriter.write(name, data);
+        writeSlot(name, data);
+    }
 
-    pSave_LOD->close();
+    /**
+     * Adds an entry whose contents are still being produced on a worker thread. The future is waited on in
+     * `closeSlot` or `close`, whichever is called first.
+     */
+    void write(const std::string &name, std::future<Blob> data) {
+        _pendingFiles.insert_or_assign(name, std::move(data));
+    }
 
-    std::error_code ec;
-    if (!std::filesystem::copy_file(filename, to_file_path, std::filesystem::copy_options::overwrite_existing, ec))
-        logger->error("Failed to copy: {}", filename);
+    void write(const SaveGameHeader &header) {
+        serialize(header, &_lodWriter, tags::via<SaveGame_MM7>);
+        if (_failed)
+            return;
+        if (_slotJournalWriter.isOpen())
+            serialize(header, &_slotJournalWriter, tags::via<SaveGame_MM7>);
+        if (_slotWriter.isOpen())
+            serialize(header, &_slotWriter, tags::via<SaveGame_MM7>);
+    }
 
-    pSave_LOD->open(to_file_path, LOD_ALLOW_DUPLICATES);
+    /**
+     * Writes out the save slot file. Must be called while the entries passed to `writeUnchanged` are still valid.
+     *
+     * @return                          Whether the save slot file was written successfully. `true` if there was no
+     *                                  save slot file to write.
+     */
+    bool closeSlot() {
+        resolvePendingFiles();
+
+        if (!_failed) {
+            try {
+                _slotJournalWriter.close();
+                _slotWriter.close();
+            } catch (const std::exception &e) {
+                fail(e);
+            }
+        }
+
+        return !_failed;
+    }
+
+    /**
+     * Writes out `new.lod`.
+     *
+     * @throws Exception                On error.
+     */
+    void close() {
+        resolvePendingFiles();
+        _lodWriter.close();
+    }
+
+ private:
+    void writeSlot(const std::string &name, const Blob &data) {
+        if (_failed)
+            return;
+        if (_slotJournalWriter.isOpen())
+            _slotJournalWriter.write(name, data);
+        if (_slotWriter.isOpen())
+            _slotWriter.write(name, data);
+    }
+
+    void resolvePendingFiles() {
+        std::map<std::string, std::future<Blob>> pendingFiles = std::move(_pendingFiles);
+        _pendingFiles.clear();
+        for (auto &[name, data] : pendingFiles)
+            write(name, data.get());
+    }
+
+    void fail(const std::exception &e) {
+        logger->error("Could not write save file '{}': {}", _slotPath, e.what());
+        _failed = true;
+    }
+
+ private:
+    LodJournalWriter _lodWriter;
+    std::string _slotPath;
+    LodJournalWriter _slotJournalWriter;
+    LodWriter _slotWriter;
+    bool _failed = false;
+    std::map<std::string, std::future<Blob>> _pendingFiles;
+};
+} // namespace
+
+/**
+ * Save LOD loaded with `LoadGameFromMemory` that is yet to be written out into `data/new.lod`. Empty if `new.lod` is
+ * in sync with `pSave_LOD`.
+ */
+static Blob pendingSaveLod;
+
+static std::string makeMapDeltaName(std::string_view mapName) {
+    std::string result(mapName);
+    size_t pos = result.find_last_of(".");
+    result[pos + 1] = 'd';
+    return result;
+}
+
+static Blob serializeMapDelta() {
+    Blob result;
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        serialize(*pIndoor, &result, tags::via<IndoorDelta_MM7>);
+    } else {
+        assert(uCurrentlyLoadedLevelType == LEVEL_OUTDOOR);
+        serialize(*pOutdoor, &result, tags::via<OutdoorDelta_MM7>);
+    }
+    return result;
+}
+
+/**
+ * Loads the game from `pSave_LOD`, which is expected to be already opened by the caller.
+ */
+static void loadGameFromSaveLod() {
+    // TODO(captainurist): remained from Party::Reset, doesn't really belong here (or in Party::Reset).
+    current_character_screen_window = WINDOW_CharacterWindow_Stats;
 
     SaveGameHeader header;
     deserialize(*pSave_LOD, &header, tags::via<SaveGame_MM7>);
@@ -151,7 +297,69 @@ void LoadGame(unsigned int uSlot) {
     bFlashHistoryBook = false;
 }
 
-SaveGameHeader SaveGame(bool IsAutoSAve, bool NotSaveWorld, const std::string &title) {
+void LoadGame(unsigned int uSlot) {
+    if (!pSavegameList->pSavegameUsedSlots[uSlot]) {
+        pAudioPlayer->playUISound(SOUND_error);
+        logger->warning("LoadGame: slot {} is empty", uSlot);
+        return;
+    }
+    pSavegameList->selectedSlot = uSlot;
+    pSavegameList->lastLoadedSave = pSavegameList->pFileList[uSlot];
+
+    std::string filename = makeDataPath("saves", pSavegameList->pFileList[uSlot]);
+    std::string to_file_path = makeDataPath("data", "new.lod");
+
+    pSave_LOD->close();
+    pendingSaveLod = Blob();
+
+    std::error_code ec;
+    if (!std::filesystem::copy_file(filename, to_file_path, std::filesystem::copy_options::overwrite_existing, ec))
+        logger->error("Failed to copy: {}", filename);
+
+    pSave_LOD->open(to_file_path, LOD_ALLOW_DUPLICATES);
+
+    loadGameFromSaveLod();
+}
+
+Blob SaveGameToMemory() {
+    Blob result;
+    BlobOutputStream stream(&result);
+    LodWriter lodWriter(&stream, makeDataPath("data", "new.lod"), makeSaveLodInfo());
+
+    for (const std::string &name : pSave_LOD->ls())
+        lodWriter.write(name, pSave_LOD->read(name));
+
+    SaveGameHeader header;
+    header.locationName = pCurrentMapName;
+    header.playingTime = pParty->GetPlayingTime();
+    serialize(header, &lodWriter, tags::via<SaveGame_MM7>);
+
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < pParty->pCharacters[i].vBeacons.size() && j < 5; ++j) {
+            const LloydBeacon &beacon = pParty->pCharacters[i].vBeacons[j];
+            if (beacon.uBeaconTime.isValid() && beacon.image != nullptr)
+                lodWriter.write(fmt::format("lloyd{}{}.pcx", i + 1, j + 1), pcx::encode(beacon.image->rgba()));
+        }
+    }
+
+    if (uCurrentlyLoadedLevelType != LEVEL_NULL)
+        lodWriter.write(makeMapDeltaName(pCurrentMapName), lod::encodeCompressed(serializeMapDelta()));
+
+    lodWriter.close();
+    stream.close();
+    return result;
+}
+
+void LoadGameFromMemory(const Blob &saveLod) {
+    pSave_LOD->close();
+    pendingSaveLod = Blob::share(saveLod);
+    pSave_LOD->open(Blob::share(saveLod), makeDataPath("data", "new.lod"), LOD_ALLOW_DUPLICATES);
+
+    loadGameFromSaveLod();
+}
+
+SaveGameHeader SaveGame(bool IsAutoSAve, bool NotSaveWorld, const std::string &title, const std::string &savePath,
+                        bool journaled, bool *slotWritten) {
     assert(IsAutoSAve || !title.empty());
     assert(pCurrentMapName != "d05.blv" || IsAutoSAve); // No manual saves in Arena.
 
@@ -188,22 +396,41 @@ SaveGameHeader SaveGame(bool IsAutoSAve, bool NotSaveWorld, const std::string &t
     //    render->Present();
     //}
 
-    pSave_LOD->close();
-    LodWriter lodWriter(makeDataPath("data", "new.lod"), makeSaveLodInfo());
+    std::string newLodPath = makeDataPath("data", "new.lod");
+    std::string slotPath = savePath;
+    if (slotPath.empty() && IsAutoSAve)
+        slotPath = makeDataPath("saves", "autosave.mm7");
+
+    // Game was loaded from memory, bring `new.lod` in sync with `pSave_LOD` first so that the journal is written on
+    // top of the right base.
+    if (!pendingSaveLod.empty()) {
+        pSave_LOD->close();
+        FileOutputStream(newLodPath).write(pendingSaveLod.data(), pendingSaveLod.size());
+        pSave_LOD->open(std::exchange(pendingSaveLod, Blob()), newLodPath, LOD_ALLOW_DUPLICATES);
+    }
+
+    // `new.lod` is a LOD journal, so only the entries that were changed since the last save are actually written out.
+    // A vanilla `new.lod` (e.g. one written by `SaveNewGame`) is converted on first save.
+    SaveFileWriter lodWriter(newLodPath, slotPath, journaled || IsAutoSAve);
 
-    LodReader lodReader(makeDataPath("data", "new.lod"), LOD_ALLOW_DUPLICATES);
-    for (const std::string &name : lodReader.ls())
-        lodWriter.write(name, lodReader.read(name));
-    lodReader.close();
+    // Entries of the current save are views into the memory-mapped `new.lod`, they are only copied into the slot file.
+    if (!pSave_LOD->isOpen())
+        pSave_LOD->open(newLodPath, LOD_ALLOW_DUPLICATES); // Closed in `SaveNewGame`.
+    if (!slotPath.empty())
+        for (const std::string &name : pSave_LOD->ls())
+            lodWriter.writeUnchanged(name, pSave_LOD->read(name));
 
-    lodWriter.write("image.pcx", render->PackScreenshot(150, 112));
+    // Encoding & compression is done on worker threads, `SaveFileWriter` waits for the results.
+    lodWriter.write("image.pcx", ThreadPool::shared().submit([screenshot = render->MakeScreenshot32(150, 112)] {
+        return pcx::encode(screenshot);
+    }));
 
     SaveGameHeader save_header;
     save_header.name = title;
     save_header.locationName = pCurrentMapName;
     save_header.playingTime = pParty->GetPlayingTime();
 
-    serialize(save_header, &lodWriter, tags::via<SaveGame_MM7>);
+    lodWriter.write(save_header);
 
     // TODO(captainurist): incapsulate this too
     for (size_t i = 0; i < 4; ++i) {  // 4 - players
@@ -217,27 +444,20 @@ SaveGameHeader SaveGame(bool IsAutoSAve, bool NotSaveWorld, const std::string &t
             if ((beacon->uBeaconTime.isValid()) && (image != nullptr)) {
                 assert(image->rgba());
                 std::string str = fmt::format("lloyd{}{}.pcx", i + 1, j + 1);
-                lodWriter.write(str, pcx::encode(image->rgba()));
+                lodWriter.write(str, ThreadPool::shared().submit([rgba = &image->rgba()] {
+                    return pcx::encode(*rgba);
+                }));
             }
         }
     }
 
-    Blob uncompressed;
     if (!NotSaveWorld) {  // autosave for change location
         currentLocationTime().last_visit = pParty->GetPlayingTime();
         CompactLayingItemsList();
 
-        if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
-            serialize(*pIndoor, &uncompressed, tags::via<IndoorDelta_MM7>);
-        } else {
-            assert(uCurrentlyLoadedLevelType == LEVEL_OUTDOOR);
-            serialize(*pOutdoor, &uncompressed, tags::via<OutdoorDelta_MM7>);
-        }
-
-        std::string file_name = pCurrentMapName;
-        size_t pos = file_name.find_last_of(".");
-        file_name[pos + 1] = 'd';
-        lodWriter.write(file_name, lod::encodeCompressed(uncompressed));
+        lodWriter.write(makeMapDeltaName(pCurrentMapName), ThreadPool::shared().submit([uncompressed = serializeMapDelta()] {
+            return lod::encodeCompressed(uncompressed);
+        }));
     }
 
     // Apparently vanilla had two bugs canceling each other out:
@@ -246,15 +466,16 @@ SaveGameHeader SaveGame(bool IsAutoSAve, bool NotSaveWorld, const std::string &t
     // Our code doesn't support duplicate entries, so we just add a dummy entry
     lodWriter.write("z.bin", Blob::fromString("dummy"));
 
+    // Slot file goes first, it references the entries of the old save LOD.
+    bool slotSuccess = lodWriter.closeSlot();
+    if (slotWritten)
+        *slotWritten = slotSuccess;
+
+    // Old save LOD has to be unmapped before `new.lod` is written to, as the journal might get compacted.
+    pSave_LOD->close();
     lodWriter.close();
+    pSave_LOD->open(newLodPath, LOD_ALLOW_DUPLICATES);
 
-    if (IsAutoSAve) {
-        std::string src = makeDataPath("data", "new.lod");
-        std::string dst = makeDataPath("saves", "autosave.mm7");
-        std::error_code ec;
-        if (!std::filesystem::copy_file(src, dst, std::filesystem::copy_options::overwrite_existing, ec))
-            logger->warning("Copying of autosave.mm7 failed");
-    }
     pParty->pos.x = pPositionX;
     pParty->pos.y = pPositionY;
     pParty->pos.z = pPositionZ;
@@ -262,21 +483,16 @@ SaveGameHeader SaveGame(bool IsAutoSAve, bool NotSaveWorld, const std::string &t
     pParty->_viewYaw = partyViewYaw;
     pParty->_viewPitch = partyViewPitch;
 
-    pSave_LOD->open(makeDataPath("data", "new.lod"), LOD_ALLOW_DUPLICATES);
-
     return save_header;
 }
 
 void DoSavegame(unsigned int uSlot) {
     assert(pCurrentMapName != "d05.blv"); // Not Arena.
 
-    pSavegameList->pSavegameHeader[uSlot] = SaveGame(0, 0, pSavegameList->pSavegameHeader[uSlot].name);
-
-    std::string src = makeDataPath("data", "new.lod");
-    std::string dst = makeDataPath("saves", fmt::format("save{:03}.mm7", uSlot));
-    std::error_code ec;
-    if (!std::filesystem::copy_file(src, dst, std::filesystem::copy_options::overwrite_existing, ec))
-        logger->error("Failed to copy: {}", src);
+    std::string savePath = makeDataPath("saves", fmt::format("save{:03}.mm7", uSlot));
+    bool saved = false;
+    pSavegameList->pSavegameHeader[uSlot] =
+        SaveGame(0, 0, pSavegameList->pSavegameHeader[uSlot].name, savePath, false, &saved);
 
     pSavegameList->selectedSlot = uSlot;
 
@@ -292,7 +508,11 @@ void DoSavegame(unsigned int uSlot) {
     }
 
     pEventTimer->setPaused(false);
-    engine->_statusBar->setEvent(LSTR_GAME_SAVED);
+    if (saved) {
+        engine->_statusBar->setEvent(LSTR_GAME_SAVED);
+    } else {
+        pAudioPlayer->playUISound(SOUND_error);
+    }
 }
 
 void SavegameList::Initialize() {
@@ -337,6 +557,7 @@ void SavegameList::Reset() {
 void SaveNewGame() {
     std::string file_path = makeDataPath("data", "new.lod");
     pSave_LOD->close();
+    pendingSaveLod = Blob();
     std::filesystem::remove(file_path);
 
     LodWriter lodWriter(file_path, makeSaveLodInfo());
@@ -408,13 +629,12 @@ void QuickSaveGame() {
     }
 
     pSavegameList->pSavegameHeader[uSlot].name = "Quicksave";
-    pSavegameList->pSavegameHeader[uSlot] = SaveGame(0, 0, pSavegameList->pSavegameHeader[uSlot].name);
+    std::string savePath = makeDataPath("saves", quickSaveName);
+    bool saved = false;
+    pSavegameList->pSavegameHeader[uSlot] =
+        SaveGame(0, 0, pSavegameList->pSavegameHeader[uSlot].name, savePath, true, &saved);
 
-    std::string src = makeDataPath("data", "new.lod");
-    std::string dst = makeDataPath("saves", quickSaveName);
-    std::error_code ec;
-    if (!std::filesystem::copy_file(src, dst, std::filesystem::copy_options::overwrite_existing, ec)) {
-        logger->error("Failed to copy: {}", src);
+    if (!saved) {
         engine->config->gameplay.QuickSavesCount.cycleDecrement();
         pAudioPlayer->playUISound(SOUND_error);
     } else {
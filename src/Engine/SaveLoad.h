@@ -5,6 +5,8 @@
 
 #include "Engine/Time/Time.h"
 
+#include "Utility/Memory/Blob.h"
+
 constexpr unsigned int MAX_SAVE_SLOTS = 45;
 
 struct SaveGameHeader {
@@ -31,7 +33,46 @@ struct SavegameList {
 };
 
 void LoadGame(unsigned int uSlot);
-SaveGameHeader SaveGame(bool IsAutoSAve, bool NotSaveWorld, const std::string &title = {});
+
+/**
+ * Saves the game into `data/new.lod`.
+ *
+ * @param IsAutoSAve                    Whether this is an autosave. Autosaves are also written into
+ *                                      `saves/autosave.mm7`, unless `savePath` is provided.
+ * @param NotSaveWorld                  Whether the current map delta shouldn't be saved.
+ * @param title                         Save title.
+ * @param savePath                      Path to the save slot file to also write the save into, can be empty.
+ * @param journaled                     Whether the save slot file should be written as a LOD journal. This is always
+ *                                      the case for autosaves. Note that `data/new.lod` is always a journal.
+ * @param[out] slotWritten              If not null, set to whether the save slot file was written successfully. Set
+ *                                      to `true` if there is no save slot file to write.
+ * @return                              Header of the new save.
+ */
+SaveGameHeader SaveGame(bool IsAutoSAve, bool NotSaveWorld, const std::string &title = {},
+                        const std::string &savePath = {}, bool journaled = false, bool *slotWritten = nullptr);
+
+/**
+ * Saves the game into memory. Unlike `SaveGame`, this doesn't alter the game state in any way - party position is
+ * not adjusted, and sprite objects are not compacted.
+ *
+ * Note that the result is still a vanilla save, so whatever doesn't fit into it is lost - e.g. party position is
+ * truncated to ints. See `EngineSnapshot` for the state that's saved separately.
+ *
+ * @return                              Vanilla save LOD containing the contents of `pSave_LOD`, the current party
+ *                                      state and the delta of the current map.
+ */
+Blob SaveGameToMemory();
+
+/**
+ * Loads the game from memory. Just like `LoadGame`, this only loads the party state, and the caller is expected to
+ * set `uGameState` to `GAME_STATE_LOADING_GAME` so that the game loop would then load the map.
+ *
+ * `data/new.lod` is not touched, it is overwritten with the provided save on the next call to `SaveGame`.
+ *
+ * @param saveLod                       Save LOD, as returned by `SaveGameToMemory`.
+ */
+void LoadGameFromMemory(const Blob &saveLod);
+
 void DoSavegame(unsigned int uSlot);
 bool Initialize_GamesLOD_NewLOD();
 void SaveNewGame();
@@ -21,6 +21,7 @@
 
 #include "Library/Snapshots/CommonSnapshots.h"
 #include "Library/Lod/LodWriter.h"
+#include "Library/Lod/LodJournal.h"
 #include "Library/Lod/LodReader.h"
 
 void reconstruct(const IndoorLocation_MM7 &src, IndoorLocation *dst) {
@@ -544,7 +545,8 @@ void reconstruct(const SaveGame_MM7 &src, SaveGameHeader *dst) {
     reconstruct(src.npcGroups, &pNPCStats->pGroups);
 }
 
-void serialize(const SaveGame_MM7 &src, LodWriter *dst) {
+template<class Writer>
+static void serializeSaveGame(const SaveGame_MM7 &src, Writer *dst) {
     dst->write("header.bin", toBlob(src.header));
     dst->write("party.bin", toBlob(src.party));
     dst->write("clock.bin", toBlob(src.eventTimer));
@@ -553,6 +555,14 @@ void serialize(const SaveGame_MM7 &src, LodWriter *dst) {
     dst->write("npcgroup.bin", toBlob(src.npcGroups));
 }
 
+void serialize(const SaveGame_MM7 &src, LodWriter *dst) {
+    serializeSaveGame(src, dst);
+}
+
+void serialize(const SaveGame_MM7 &src, LodJournalWriter *dst) {
+    serializeSaveGame(src, dst);
+}
+
 void deserialize(const LodReader &src, SaveGame_MM7 *dst) {
     deserialize(src.read("header.bin"), &dst->header);
     deserialize(src.read("party.bin"), &dst->party);
@@ -21,6 +21,7 @@ struct OutdoorLocation;
 struct SpriteFrameTable;
 class LodReader;
 class LodWriter;
+class LodJournalWriter;
 class FontData;
 
 struct IndoorLocation_MM7 {
@@ -136,6 +137,7 @@ struct SaveGame_MM7 {
 void snapshot(const SaveGameHeader &src, SaveGame_MM7 *dst);
 void reconstruct(const SaveGame_MM7 &src, SaveGameHeader *dst);
 void serialize(const SaveGame_MM7 &src, LodWriter *dst);
+void serialize(const SaveGame_MM7 &src, LodJournalWriter *dst);
 void deserialize(const LodReader &src, SaveGame_MM7 *dst);
 
 
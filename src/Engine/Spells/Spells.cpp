@@ -19,6 +19,7 @@
 
 #include "Utility/Math/TrigLut.h"
 #include "Utility/MapAccess.h"
+#include "Utility/String.h"
 
 SpellFxRenderer *spell_fx_renderer = EngineIocContainer::ResolveSpellFxRenderer();
 
@@ -492,12 +493,12 @@ void SpellStats::Initialize(const Blob &spells) {
 
     std::string txtRaw(spells.string_view());
 
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
     for (SpellId uSpellID : allRegularSpells()) {
         if (((std::to_underlying(uSpellID) % 11) - 1) == 0) {
-            strtok(NULL, "\r");
+            strtokThreadLocal(NULL, "\r");
         }
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
 
         auto tokens = tokenize(test_string, '\t');
 
@@ -14,10 +14,10 @@ void initializeAutonotes(const Blob &autonotes) {
     int decode_step;
 
     std::string txtRaw(autonotes.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     for (int i = 1; i < pAutonoteTxt.size(); ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -14,11 +14,11 @@ void initializeBuildings(const Blob &buildings) {
     int decode_step;
 
     std::string txtRaw(buildings.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
+    strtokThreadLocal(NULL, "\r");
 
     for (HouseId houseId : allHouses()) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -21,7 +21,7 @@
 
 static void strtokSkipLines(int n) {
     for (int i = 0; i < n; ++i) {
-        (void)strtok(NULL, "\r");
+        (void)strtokThreadLocal(NULL, "\r");
     }
 }
 
@@ -80,12 +80,12 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     std::string txtRaw;
 
     txtRaw = resourceManager->getEventsFile("stditems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
     strtokSkipLines(3);
     // Standard Bonuses by Group
     chanceByItemTypeSums.fill(0);
     for (CharacterAttributeType i : allEnchantableAttributes()) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         standardEnchantments[i].pBonusStat = removeQuotes(tokens[0]);
         standardEnchantments[i].pOfName = removeQuotes(tokens[1]);
@@ -100,7 +100,7 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     // Bonus range for Standard by Level
     strtokSkipLines(5);
     for (ItemTreasureLevel i : bonusRanges.indices()) {  // counted from 1
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         assert(tokens.size() == 4 && "Invalid number of tokens");
         bonusRanges[i].minR = atoi(tokens[2]);
@@ -108,10 +108,10 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     }
 
     txtRaw = resourceManager->getEventsFile("spcitems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
     strtokSkipLines(3);
     for (ItemEnchantment i : pSpecialEnchantments.indices()) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         assert(tokens.size() >= 17 && "Invalid number of tokens");
         pSpecialEnchantments[i].pBonusStatement = removeQuotes(tokens[0]);
@@ -137,10 +137,10 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     pSpecialEnchantments_count = 72;
 
     txtRaw = resourceManager->getEventsFile("items.txt").string_view();
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
     strtokSkipLines(1);
     for (size_t line = 0; line < 799; line++) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
 
         ItemId item_counter = ItemId(atoi(tokens[0]));
@@ -200,10 +200,10 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     }
 
     txtRaw = resourceManager->getEventsFile("rnditems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
     strtokSkipLines(3);
     for(size_t line = 0; line < 618; line++) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         assert(tokens.size() > 7 && "Invalid number of tokens");
 
@@ -224,7 +224,7 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
 
     strtokSkipLines(5);
     for (int i = 0; i < 3; ++i) {
-        lineContent = strtok(NULL, "\r") + 1;
+        lineContent = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(lineContent, '\t');
         assert(tokens.size() > 7 && "Invalid number of tokens");
         switch (i) {
@@ -255,9 +255,8 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
         }
     }
 
-    ItemGen::PopulateSpecialBonusMap();
-    ItemGen::PopulateArtifactBonusMap();
-    ItemGen::PopulateRegularBonusMap();
+    ItemGen::PopulateSpecialBonusTable();
+    ItemGen::PopulateArtifactBonusTable();
 }
 
 //----- (00456D17) --------------------------------------------------------
@@ -290,11 +289,11 @@ void ItemTable::LoadPotions(const Blob &potions) {
 
     std::vector<char *> tokens;
     std::string txtRaw(potions.string_view());
-    test_string = strtok(txtRaw.data(), "\r") + 1;
+    test_string = strtokThreadLocal(txtRaw.data(), "\r") + 1;
     while (test_string) {
         tokens = tokenize(test_string, '\t');
         if (!strcmp(tokens[0], "222")) break;
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
     }
     if (!test_string) {
         logger->error("Error Pre-Parsing Potion Table");
@@ -317,7 +316,7 @@ void ItemTable::LoadPotions(const Blob &potions) {
             this->potionCombination[row][column] = (ItemId)potion_value;
         }
 
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         if (!test_string) {
             logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row), 0);
             return;
@@ -334,11 +333,11 @@ void ItemTable::LoadPotionNotes(const Blob &potionNotes) {
 
     std::vector<char *> tokens;
     std::string txtRaw(potionNotes.string_view());
-    test_string = strtok(txtRaw.data(), "\r") + 1;
+    test_string = strtokThreadLocal(txtRaw.data(), "\r") + 1;
     while (test_string) {
         tokens = tokenize(test_string, '\t');
         if (!strcmp(tokens[0], "222")) break;
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
     }
     if (!test_string) {
         logger->error("Error Pre-Parsing Potion Table");
@@ -356,7 +355,7 @@ void ItemTable::LoadPotionNotes(const Blob &potionNotes) {
             this->potionNotes[row][column] = atoi(currValue);
         }
 
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         if (!test_string) {
             logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), 0);
             return;
@@ -19,10 +19,10 @@ void initializeMerchants(const Blob &merchants) {
     int decode_step;
 
     std::string txtRaw(merchants.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     for (MerchantPhrase i : allMerchantPhrases()) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -14,9 +14,9 @@ void initializeMessageScrolls(const Blob &scrolls) {
     int decode_step;
 
     std::string txtRaw(scrolls.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
     for (ItemId i : pMessageScrolls.indices()) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -25,10 +25,10 @@ void NPCStats::InitializeNPCText(const Blob &npcText) {
     int decode_step;
 
     std::string txtRaw(npcText.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     for (i = 0; i < 789; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -55,7 +55,7 @@ void NPCStats::InitializeNPCText(const Blob &npcText) {
 
 void NPCStats::InitializeNPCTopics(const Blob &npcTopics) {
     std::string txtRaw(npcTopics.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     char *test_string;
     unsigned char c;
@@ -65,7 +65,7 @@ void NPCStats::InitializeNPCTopics(const Blob &npcTopics) {
     int decode_step;
 
     for (int i = 1; i <= 579; ++i) {  // NPC topics count limit
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -92,8 +92,8 @@ void NPCStats::InitializeNPCTopics(const Blob &npcTopics) {
 
 void NPCStats::InitializeNPCDist(const Blob &npcDist) {
     std::string txtRaw(npcDist.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
+    strtokThreadLocal(NULL, "\r");
 
     char *test_string;
     unsigned char c;
@@ -103,7 +103,7 @@ void NPCStats::InitializeNPCDist(const Blob &npcDist) {
     int decode_step;
 
     for (int i = 1; i < 59; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -162,11 +162,11 @@ void NPCStats::InitializeNPCData(const Blob &npcData) {
     int decode_step;
 
     std::string txtRaw(npcData.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
+    strtokThreadLocal(NULL, "\r");
 
     for (i = 0; i < 500; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -229,7 +229,7 @@ void NPCStats::InitializeNPCData(const Blob &npcData) {
 
 void NPCStats::InitializeNPCGreets(const Blob &npcGreets) {
     std::string txtRaw(npcGreets.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     char *test_string;
     unsigned char c;
@@ -239,7 +239,7 @@ void NPCStats::InitializeNPCGreets(const Blob &npcGreets) {
     int decode_step;
 
     for (int i = 1; i <= 205; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -270,7 +270,7 @@ void NPCStats::InitializeNPCGreets(const Blob &npcGreets) {
 
 void NPCStats::InitializeNPCGroups(const Blob &npcGroups) {
     std::string txtRaw(npcGroups.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     char *test_string;
     unsigned char c;
@@ -280,7 +280,7 @@ void NPCStats::InitializeNPCGroups(const Blob &npcGroups) {
     int decode_step;
 
     for (int i = 0; i < 51; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -306,7 +306,7 @@ void NPCStats::InitializeNPCGroups(const Blob &npcGroups) {
 
 void NPCStats::InitializeNPCNews(const Blob &npcNews) {
     std::string txtRaw(npcNews.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     char *test_string;
     unsigned char c;
@@ -316,7 +316,7 @@ void NPCStats::InitializeNPCNews(const Blob &npcNews) {
     int decode_step;
 
     for (int i = 0; i < 51; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -355,7 +355,7 @@ void NPCStats::Initialize(GameResourceManager *resourceManager) {
 
 void NPCStats::InitializeNPCNames(const Blob &npcNames) {
     std::string txtRaw(npcNames.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     int i;
     char *test_string;
@@ -368,7 +368,7 @@ void NPCStats::InitializeNPCNames(const Blob &npcNames) {
     uNewlNPCBufPos = 0;
 
     for (i = 0; i < 540; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
@@ -405,10 +405,10 @@ void NPCStats::InitializeNPCNames(const Blob &npcNames) {
 
 void NPCStats::InitializeNPCProfs(const Blob &npcProfs) {
     std::string txtRaw(npcProfs.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
+    strtokThreadLocal(NULL, "\r");
+    strtokThreadLocal(NULL, "\r");
+    strtokThreadLocal(NULL, "\r");
 
     int i;
     char *test_string;
@@ -419,7 +419,7 @@ void NPCStats::InitializeNPCProfs(const Blob &npcProfs) {
     int decode_step;
 
     for (NpcProfession i : Segment(NPC_PROFESSION_FIRST_VALID, NPC_PROFESSION_LAST_VALID)) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
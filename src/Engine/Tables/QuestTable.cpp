@@ -14,10 +14,10 @@ void initializeQuests(const Blob &quests) {
     int decode_step;
 
     std::string txtRaw(quests.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
     memset(pQuestTable.data(), 0, sizeof(pQuestTable));
     for (auto i : pQuestTable.indices()) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
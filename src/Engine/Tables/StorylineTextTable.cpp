@@ -10,7 +10,7 @@ void StorylineText::Initialize(const Blob &history) {
     char *test_string;
 
     std::string txtRaw(history.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     StoreLine[0].pText = "";
     StoreLine[0].pPageTitle = "";
@@ -20,7 +20,7 @@ void StorylineText::Initialize(const Blob &history) {
     StoreLine[0].f_B = 0;
 
     for (int i = 0; i < 28; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         auto tokens = tokenize(test_string, '\t');
 
         StoreLine[i + 1].pText = removeQuotes(tokens[1]);
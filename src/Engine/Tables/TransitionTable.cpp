@@ -14,11 +14,11 @@ void initializeTransitions(const Blob &transitions) {
     int decode_step;
 
     std::string txtRaw(transitions.string_view());
-    strtok(txtRaw.data(), "\r");
+    strtokThreadLocal(txtRaw.data(), "\r");
 
     pTransitionStrings[0] = "";
     for (int i = 1; i < pTransitionStrings.size(); ++i) {
-        test_string = strtok(NULL, "\r") + 1;
+        test_string = strtokThreadLocal(NULL, "\r") + 1;
         break_loop = false;
         decode_step = 0;
         do {
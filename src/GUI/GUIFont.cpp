@@ -4,6 +4,8 @@
 #include <memory>
 #include <algorithm>
 #include <ranges>
+#include <functional>
+#include <utility>
 
 #include "Engine/AssetsManager.h"
 #include "Engine/LodTextureCache.h"
@@ -41,6 +43,10 @@ void ReloadFonts() {
         assets->pFontSmallnum->CreateFontTex();
 }
 
+// Text layout caches are cleared once they grow past this size. Texts that are drawn every frame get laid out again
+// on the next frame, so there's no need for anything more elaborate.
+static constexpr size_t MAX_TEXT_LAYOUT_CACHE_SIZE = 1024;
+
 static Color parseColorTag(const char *tag, const Color &defaultColor) {
     char color_code[20];
     strncpy(color_code, tag, 5);
@@ -353,11 +359,33 @@ int GUIFont::AlignText_Center(int width, const std::string &pString) {
     return (position < 0) ? 0 : position;
 }
 
+size_t GUIFont::TextLayoutKeyHash::operator()(const TextLayoutKey &key) const {
+    size_t result = std::hash<std::string>()(key.text);
+    result = result * 31 + std::hash<int>()(key.width);
+    result = result * 31 + std::hash<int>()(key.x);
+    result = result * 31 + std::hash<int>()(key.param);
+    return result;
+}
+
 std::string GUIFont::FitTextInAWindow(const std::string &inString, unsigned int width, int uX, bool return_on_carriage) {
     if (inString.empty()) {
         return "";
     }
 
+    TextLayoutKey key{inString, static_cast<int>(width), uX, return_on_carriage};
+    if (auto pos = _fittedTextCache.find(key); pos != _fittedTextCache.end())
+        return pos->second;
+
+    if (_fittedTextCache.size() >= MAX_TEXT_LAYOUT_CACHE_SIZE)
+        _fittedTextCache.clear();
+
+    std::string result = fitText(inString, width, uX, return_on_carriage);
+    _fittedTextCache.emplace(std::move(key), result);
+    return result;
+}
+
+std::string GUIFont::fitText(const std::string &inString, unsigned int width, int uX, bool return_on_carriage) {
+
     int lineWidth = uX;
     int newlinePos = -1;
     int lastCopyPos = 0;
@@ -429,7 +457,6 @@ std::string GUIFont::FitTextInAWindow(const std::string &inString, unsigned int
 void GUIFont::DrawText(GUIWindow *window, Pointi position, Color color, const std::string &text, int maxHeight, Color shadowColor) {
     assert(color.a > 0);
 
-    int left_margin = 0;
     if (text.empty()) {
         return;
     }
@@ -439,105 +466,135 @@ void GUIFont::DrawText(GUIWindow *window, Pointi position, Color color, const st
 
     render->BeginTextNew(fonttex, fontshadow);
 
-    size_t v30 = text.length();
     if (!position.x) {
         position.x = 12;
     }
 
-    std::string string_begin = text;
-    if (maxHeight == 0) {
-        string_begin = FitTextInAWindow(text, window->uFrameWidth, position.x);
-    }
-    auto string_end = string_begin;
-    auto string_base = string_begin;
+    const TextLayout &layout = cachedTextLayout(text, position.x, maxHeight == 0 ? window->uFrameWidth : -1, window->uFrameZ - window->uFrameX);
 
-    int out_x = position.x + window->uFrameX;
-    int out_y = position.y + window->uFrameY;
+    int base_x = window->uFrameX;
+    int base_y = window->uFrameY + position.y;
 
-    if (maxHeight != 0 && out_y + pData.header.uFontHeight > maxHeight) {
-        return;
+    size_t breakIndex = 0;
+    for (size_t i = 0; i <= layout.glyphs.size(); i++) {
+        for (; breakIndex < layout.breaks.size() && layout.breaks[breakIndex].glyphIndex == i; breakIndex++)
+            if (maxHeight != 0 && base_y + layout.breaks[breakIndex].bottom > maxHeight)
+                return;
+
+        if (i == layout.glyphs.size())
+            break;
+
+        const TextLayoutGlyph &glyph = layout.glyphs[i];
+        int out_x = base_x + glyph.position.x;
+        int out_y = base_y + glyph.position.y;
+        render->DrawTextNew(out_x, out_y, glyph.width, pData.header.uFontHeight, glyph.u1, glyph.v1, glyph.u2, glyph.v2, 1, shadowColor);
+        render->DrawTextNew(out_x, out_y, glyph.width, pData.header.uFontHeight, glyph.u1, glyph.v1, glyph.u2, glyph.v2, 0, glyph.defaultColor ? color : glyph.color);
     }
+    // render->EndTextNew();
+}
 
-    Color draw_color = color;
+const GUIFont::TextLayout &GUIFont::cachedTextLayout(const std::string &text, int x, int width, int frameRight) {
+    TextLayoutKey key{text, width, x, frameRight};
+    if (auto pos = _textLayoutCache.find(key); pos != _textLayoutCache.end())
+        return pos->second;
 
-    char Dest[6] = { 0 };
-    size_t v14 = 0;
-    if (v30 > 0) {
-        do {
-            uint8_t c = string_base[v14];
-            if (c >= pData.header.cFirstChar && c <= pData.header.cLastChar
-                || c == '\f'
-                || c == '\r'
-                || c == '\t'
-                || c == '\n') {
-                switch (c) {
-                case '\t':
-                    strncpy(Dest, &string_base[v14 + 1], 3);
-                    Dest[3] = 0;
-                    v14 += 3;
-                    left_margin = atoi(Dest);
-                    out_x = position.x + window->uFrameX + left_margin;
-                    break;
-                case '\n':
-                    position.y = position.y + pData.header.uFontHeight - 3;
-                    out_y = position.y + window->uFrameY;
-                    out_x = position.x + window->uFrameX + left_margin;
-                    if (maxHeight != 0) {
-                        if (pData.header.uFontHeight + out_y - 3 > maxHeight) {
-                            return;
-                        }
-                    }
-                    break;
-                case '\f':
-                    draw_color = parseColorTag(&string_base[v14 + 1], color);
-                    v14 += 5;
-                    break;
-                case '\r':
-                    strncpy(Dest, &string_base[v14 + 1], 3);
-                    Dest[3] = 0;
-                    v14 += 3;
-                    left_margin = atoi(Dest);
-                    out_x = window->uFrameZ - this->GetLineWidth(&string_base[v14]) - left_margin;
-                    out_y = position.y + window->uFrameY;
-                    if (maxHeight != 0) {
-                        if (pData.header.uFontHeight + out_y - 3 > maxHeight) {
-                            return;
-                        }
-                        break;
-                    }
-                    break;
+    if (_textLayoutCache.size() >= MAX_TEXT_LAYOUT_CACHE_SIZE)
+        _textLayoutCache.clear();
 
-                default:
-                    if (c == '\"' && string_base[v14 + 1] == '\"') {
-                        ++v14;
-                    }
+    TextLayout layout = layoutText(text, x, width, frameRight);
+    return _textLayoutCache.emplace(std::move(key), std::move(layout)).first->second;
+}
 
-                    c = (uint8_t)string_base[v14];
-                    if (v14 > 0) {
-                        out_x += pData.header.pMetrics[c].uLeftSpacing;
-                    }
+GUIFont::TextLayout GUIFont::layoutText(const std::string &text, int x, int width, int frameRight) {
+    TextLayout result;
 
-                    unsigned char *letter_pixels = &pData.pixels[pData.header.font_pixels_offset[c]];
-                    int xsq = c % 16;
-                    int ysq = c / 16;
-                    float u1 = (xsq * 32.0f) / 512.0f;
-                    float u2 = (xsq * 32.0f + pData.header.pMetrics[c].uWidth) / 512.0f;
-                    float v1 = (ysq * 32.0f) / 512.0f;
-                    float v2 = (ysq * 32.0f + pData.header.uFontHeight) / 512.0f;
+    int left_margin = 0;
+    int line_y = 0;
+    size_t v30 = text.length();
 
-                    render->DrawTextNew(out_x, out_y, pData.header.pMetrics[c].uWidth, pData.header.uFontHeight, u1, v1, u2, v2, 1, shadowColor);
-                    render->DrawTextNew(out_x, out_y, pData.header.pMetrics[c].uWidth, pData.header.uFontHeight, u1, v1, u2, v2, 0, draw_color);
+    std::string string_base = text;
+    if (width >= 0) {
+        string_base = FitTextInAWindow(text, width, x);
+    }
 
-                    out_x += pData.header.pMetrics[c].uWidth;
-                    if (v14 < v30) {
-                        out_x += pData.header.pMetrics[c].uRightSpacing;
-                    }
-                    break;
+    int out_x = x;
+    int out_y = 0;
+    result.breaks.push_back({0, pData.header.uFontHeight});
+
+    bool defaultColor = true;
+    Color draw_color;
+
+    char Dest[6] = { 0 };
+    for (size_t v14 = 0; v14 < v30; v14++) {
+        uint8_t c = string_base[v14];
+        if (c >= pData.header.cFirstChar && c <= pData.header.cLastChar
+            || c == '\f'
+            || c == '\r'
+            || c == '\t'
+            || c == '\n') {
+            switch (c) {
+            case '\t':
+                strncpy(Dest, &string_base[v14 + 1], 3);
+                Dest[3] = 0;
+                v14 += 3;
+                left_margin = atoi(Dest);
+                out_x = x + left_margin;
+                break;
+            case '\n':
+                line_y = line_y + pData.header.uFontHeight - 3;
+                out_y = line_y;
+                out_x = x + left_margin;
+                result.breaks.push_back({result.glyphs.size(), pData.header.uFontHeight + out_y - 3});
+                break;
+            case '\f':
+                // Color 0 means going back to the color passed to `DrawText`.
+                draw_color = parseColorTag(&string_base[v14 + 1], Color());
+                defaultColor = draw_color == Color();
+                v14 += 5;
+                break;
+            case '\r':
+                strncpy(Dest, &string_base[v14 + 1], 3);
+                Dest[3] = 0;
+                v14 += 3;
+                left_margin = atoi(Dest);
+                out_x = frameRight - this->GetLineWidth(&string_base[v14]) - left_margin;
+                out_y = line_y;
+                result.breaks.push_back({result.glyphs.size(), pData.header.uFontHeight + out_y - 3});
+                break;
+
+            default:
+                if (c == '\"' && string_base[v14 + 1] == '\"') {
+                    ++v14;
+                }
+
+                c = (uint8_t)string_base[v14];
+                if (v14 > 0) {
+                    out_x += pData.header.pMetrics[c].uLeftSpacing;
+                }
+
+                int xsq = c % 16;
+                int ysq = c / 16;
+
+                TextLayoutGlyph &glyph = result.glyphs.emplace_back();
+                glyph.position = Pointi(out_x, out_y);
+                glyph.width = pData.header.pMetrics[c].uWidth;
+                glyph.u1 = (xsq * 32.0f) / 512.0f;
+                glyph.u2 = (xsq * 32.0f + pData.header.pMetrics[c].uWidth) / 512.0f;
+                glyph.v1 = (ysq * 32.0f) / 512.0f;
+                glyph.v2 = (ysq * 32.0f + pData.header.uFontHeight) / 512.0f;
+                glyph.defaultColor = defaultColor;
+                glyph.color = draw_color;
+
+                out_x += pData.header.pMetrics[c].uWidth;
+                if (v14 < v30) {
+                    out_x += pData.header.pMetrics[c].uRightSpacing;
                 }
+                break;
             }
-        } while (++v14 < v30);
+        }
     }
-    // render->EndTextNew();
+
+    return result;
 }
 
 int GUIFont::DrawTextInRect(GUIWindow *window, Pointi position, Color color, const std::string &text, int rect_width, int reverse_text) {
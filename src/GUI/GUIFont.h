@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 #include "Library/Color/Color.h"
 #include "Library/Image/Palette.h"
@@ -88,6 +89,47 @@ class GUIFont {
     GraphicsImage *fontshadow = nullptr;
 
  private:
+    /**
+     * Cache key for text layouts. Font is implicit as caches are per-font.
+     */
+    struct TextLayoutKey {
+        std::string text;
+        int width = 0; // Wrap width, -1 if the text is not wrapped.
+        int x = 0; // Starting x offset.
+        int param = 0; // `return_on_carriage` for `FitTextInAWindow`, right frame edge for `DrawText`.
+
+        friend bool operator==(const TextLayoutKey &l, const TextLayoutKey &r) = default;
+    };
+
+    struct TextLayoutKeyHash {
+        size_t operator()(const TextLayoutKey &key) const;
+    };
+
+    struct TextLayoutGlyph {
+        Pointi position; // Relative to the window frame, y is also relative to the starting y.
+        int width = 0;
+        float u1 = 0, v1 = 0, u2 = 0, v2 = 0; // Texture coordinates in the font atlas.
+        bool defaultColor = true; // Whether the glyph is drawn with the color passed to `DrawText`.
+        Color color; // Glyph color, if not default.
+    };
+
+    struct TextLayoutBreak {
+        size_t glyphIndex = 0; // Index of the first glyph on the line.
+        int bottom = 0; // `DrawText` stops at this line if its bottom would go past the max height.
+    };
+
+    /**
+     * Text laid out for `DrawText`, i.e. with all the color tags parsed, lines wrapped & glyph quads computed.
+     */
+    struct TextLayout {
+        std::vector<TextLayoutGlyph> glyphs;
+        std::vector<TextLayoutBreak> breaks;
+    };
+
+    const TextLayout &cachedTextLayout(const std::string &text, int x, int width, int frameRight);
+    TextLayout layoutText(const std::string &text, int x, int width, int frameRight);
+    std::string fitText(const std::string &inString, unsigned int width, int uX, bool return_on_carriage);
+
     std::string FitTwoFontStringINWindow(const std::string &inString, GUIFont *pFontSecond,
                                     GUIWindow *pWindow, int startPixlOff,
                                     bool return_on_carriage = false);
@@ -97,6 +139,8 @@ class GUIFont {
  private:
     FontData pData;
     Palette palette;
+    std::unordered_map<TextLayoutKey, std::string, TextLayoutKeyHash> _fittedTextCache;
+    std::unordered_map<TextLayoutKey, TextLayout, TextLayoutKeyHash> _textLayoutCache;
 };
 
 void ReloadFonts();
@@ -238,6 +238,7 @@ void GameUI_DrawFoodAndGold();
 void GameUI_DrawLifeManaBars();
 void GameUI_DrawHiredNPCs();
 void GameUI_DrawPortraits();
+void GameUI_UpdatePortraits(); // Updates portrait animations & delayed reactions, called from GameUI_DrawPortraits.
 void GameUI_DrawMinimap(unsigned int uX, unsigned int uY, unsigned int uZ,
                         unsigned int uW, unsigned int uZoom, unsigned int bRedrawOdmMinimap);
 std::string GameUI_GetMinimapHintText();
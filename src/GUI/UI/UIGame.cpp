@@ -1286,13 +1286,36 @@ void GameUI_DrawPartySpells() {
     }
 }
 
+void GameUI_UpdatePortraits() {
+    pParty->updateDelayedReaction();
+
+    for (Character &character : pParty->pCharacters) {
+        if (character.IsEradicated() || character.IsDead())
+            continue;
+
+        unsigned int face_expression_ID = 0;
+        for (size_t j = 0; j < pPlayerFrameTable->pFrames.size(); ++j)
+            if (pPlayerFrameTable->pFrames[j].expression == character.expression) {
+                face_expression_ID = j;
+                break;
+            }
+        if (face_expression_ID == 0)
+            face_expression_ID = 1;
+
+        PlayerFrame *pFrame;
+        if (character.expression == CHARACTER_EXPRESSION_TALK)
+            pFrame = pPlayerFrameTable->GetFrameBy_y(&character._expression21_frameset, &character._expression21_animtime, pMiscTimer->dt());
+        else
+            pFrame = pPlayerFrameTable->GetFrameBy_x(face_expression_ID, character.uExpressionTimePassed);
+        character.uExpressionImageIndex = pFrame->uTextureID - 1;
+    }
+}
+
 //----- (004921C1) --------------------------------------------------------
 void GameUI_DrawPortraits() {
-    unsigned int face_expression_ID;  // eax@17
-    PlayerFrame *pFrame;              // eax@21
     GraphicsImage *pPortrait;                 // [sp-4h] [bp-1Ch]@27
 
-    pParty->updateDelayedReaction();
+    GameUI_UpdatePortraits();
 
     for (int i = 0; i < pParty->pCharacters.size(); ++i) {
         Character *pPlayer = &pParty->pCharacters[i];
@@ -1316,31 +1339,15 @@ void GameUI_DrawPortraits() {
                     388 / 480.0f, pPortrait);
             continue;
         }
-        face_expression_ID = 0;
-        for (size_t j = 0; j < pPlayerFrameTable->pFrames.size(); ++j)
-            if (pPlayerFrameTable->pFrames[j].expression == pPlayer->expression) {
-                face_expression_ID = j;
-                break;
-            }
-        if (face_expression_ID == 0)
-            face_expression_ID = 1;
-        if (pPlayer->expression == CHARACTER_EXPRESSION_TALK)
-            pFrame = pPlayerFrameTable->GetFrameBy_y(&pPlayer->_expression21_frameset, &pPlayer->_expression21_animtime, pMiscTimer->dt());
+        pPortrait = game_ui_player_faces[i][pPlayer->uExpressionImageIndex];
+        if (pParty->pPartyBuffs[PARTY_BUFF_INVISIBILITY].Active())
+            render->DrawTextureGrayShade(
+                pPlayerPortraitsXCoords_For_PlayerBuffAnimsDrawing[i] / 640.0f,
+                388 / 480.0f, pPortrait);
         else
-            pFrame = pPlayerFrameTable->GetFrameBy_x(face_expression_ID, pPlayer->uExpressionTimePassed);
-        if (true /* || pPlayer->uExpressionImageIndex != pFrame->uTextureID - 1*/) {
-            pPlayer->uExpressionImageIndex = pFrame->uTextureID - 1;
-            pPortrait = game_ui_player_faces[i][pPlayer->uExpressionImageIndex];  // pFace = (Texture_MM7*)game_ui_player_faces[i][pFrame->uTextureID];
-            if (pParty->pPartyBuffs[PARTY_BUFF_INVISIBILITY].Active())
-                render->DrawTextureGrayShade(
-                    pPlayerPortraitsXCoords_For_PlayerBuffAnimsDrawing[i] / 640.0f,
-                    388 / 480.0f, pPortrait);
-            else
-                render->DrawTextureNew(
-                    (pPlayerPortraitsXCoords_For_PlayerBuffAnimsDrawing[i] + 1) / 640.0f,
-                    388 / 480.0f, pPortrait);
-            continue;
-        }
+            render->DrawTextureNew(
+                (pPlayerPortraitsXCoords_For_PlayerBuffAnimsDrawing[i] + 1) / 640.0f,
+                388 / 480.0f, pPortrait);
     }
     if (pParty->bTurnBasedModeOn) {
         if (pTurnEngine->turn_stage != TE_WAIT) {
@@ -2,44 +2,162 @@
 
 #include <zlib.h>
 
+#include <cassert>
 #include <cstring>
 #include <algorithm>
+#include <limits>
 #include <memory>
+#include <utility>
 
 #include "Utility/Memory/FreeDeleter.h"
+#include "Utility/Streams/OutputStream.h"
+#include "Utility/Exception.h"
 
 namespace zlib {
 
-Blob compress(const Blob &source) {
-    uLongf destLen = source.size();
-    std::unique_ptr<void, FreeDeleter> dest;
-    int res = Z_BUF_ERROR;
-    while (res == Z_BUF_ERROR) {
-        if (dest) {
-            dest.reset();
-            destLen *= 2;
+namespace {
+class InflateStream {
+ public:
+    explicit InflateStream(const Blob &source) {
+        _stream.next_in = static_cast<Bytef *>(const_cast<void *>(source.data()));
+        _stream.avail_in = 0;
+        _remaining = source.size();
+        _initialized = inflateInit(&_stream) == Z_OK;
+    }
+
+    ~InflateStream() {
+        if (_initialized)
+            inflateEnd(&_stream);
+    }
+
+    [[nodiscard]] bool initialized() const {
+        return _initialized;
+    }
+
+    [[nodiscard]] size_t totalOut() const {
+        return _stream.total_out;
+    }
+
+    /**
+     * Inflates as much as fits into the provided buffer.
+     *
+     * @return                          `Z_STREAM_END` if the stream was fully decompressed, `Z_OK` if the output buffer
+     *                                  is full, error code otherwise.
+     */
+    int inflate(void *dst, size_t size, size_t *written) {
+        constexpr size_t maxChunk = std::numeric_limits<uInt>::max();
+
+        _stream.next_out = static_cast<Bytef *>(dst);
+        size_t outRemaining = size;
+        int res = Z_OK;
+        while (true) {
+            if (_stream.avail_in == 0 && _remaining > 0) {
+                _stream.avail_in = std::min(_remaining, maxChunk);
+                _remaining -= _stream.avail_in;
+            }
+            if (_stream.avail_out == 0 && outRemaining > 0) {
+                _stream.avail_out = std::min(outRemaining, maxChunk);
+                outRemaining -= _stream.avail_out;
+            }
+
+            res = ::inflate(&_stream, Z_NO_FLUSH);
+            if (res == Z_STREAM_END)
+                break;
+
+            // Note that we don't stop on Z_OK when the output buffer is full. Zlib might still need to consume the
+            // stream trailer, and this doesn't need any output space. If it can't make progress, it returns
+            // Z_BUF_ERROR.
+            bool outputFull = _stream.avail_out == 0 && outRemaining == 0;
+            if (res == Z_BUF_ERROR && outputFull) {
+                res = Z_OK;
+                break;
+            }
+            if (res != Z_OK)
+                break; // Error, or truncated input.
         }
-        dest.reset(malloc(destLen));
-        res = ::compress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
+
+        *written = size - outRemaining - _stream.avail_out;
+        _stream.avail_out = 0;
+        return res;
     }
 
+ private:
+    z_stream _stream = {};
+    size_t _remaining = 0; // Input bytes not yet passed to zlib.
+    bool _initialized = false;
+};
+} // namespace
+
+Blob compress(const Blob &source) {
+    // compressBound is the worst case size, so this never fails with Z_BUF_ERROR. Note that growing the buffer on
+    // Z_BUF_ERROR doesn't work for empty input, the initial buffer size is zero.
+    uLongf destLen = compressBound(source.size());
+    std::unique_ptr<void, FreeDeleter> dest(malloc(destLen));
+    int res = ::compress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
     return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
 }
 
 Blob uncompress(const Blob &source, size_t sizeHint) {
-    uLongf destLen = sizeHint > source.size() ? sizeHint : source.size() * 4;
-    std::unique_ptr<void, FreeDeleter> dest;
-    int res = Z_BUF_ERROR;
-    while (res == Z_BUF_ERROR) {
-        if (dest) {
-            dest.reset();
-            destLen *= 2;
+    InflateStream stream(source);
+    if (!stream.initialized())
+        return Blob();
+
+    size_t capacity = std::max<size_t>(1, sizeHint > 0 ? sizeHint : source.size() * 4);
+    std::unique_ptr<void, FreeDeleter> dest(malloc(capacity));
+    if (!dest)
+        return Blob();
+
+    size_t size = 0;
+    while (true) {
+        size_t written = 0;
+        int res = stream.inflate(static_cast<char *>(dest.get()) + size, capacity - size, &written);
+        size += written;
+
+        if (res == Z_STREAM_END)
+            break;
+        if (res != Z_OK)
+            return Blob();
+
+        // Output buffer is full, but there is more data. Size hint was wrong, so grow & continue.
+        capacity *= 2;
+        void *grown = realloc(dest.get(), capacity);
+        if (!grown)
+            return Blob();
+        (void) dest.release();
+        dest.reset(grown);
+    }
+
+    // Size hint was too large, give the unused tail back.
+    if (size < capacity) {
+        void *shrunk = realloc(dest.get(), std::max<size_t>(1, size));
+        if (shrunk) {
+            (void) dest.release();
+            dest.reset(shrunk);
         }
-        dest.reset(malloc(destLen));
-        res = ::uncompress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
     }
 
-    return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
+    return Blob::fromMalloc(std::move(dest), size);
+}
+
+void uncompressToStream(const Blob &source, OutputStream *dst) {
+    assert(dst);
+
+    InflateStream stream(source);
+    if (!stream.initialized())
+        throw Exception("Could not initialize zlib stream");
+
+    char buffer[16384];
+    while (true) {
+        size_t written = 0;
+        int res = stream.inflate(buffer, sizeof(buffer), &written);
+        dst->write(buffer, written);
+
+        if (res == Z_STREAM_END)
+            break;
+        if (res != Z_OK)
+            throw Exception("Could not uncompress zlib stream, error code {}, {} bytes uncompressed", res,
+                            stream.totalOut());
+    }
 }
 
 };  // namespace zlib
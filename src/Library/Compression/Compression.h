@@ -1,8 +1,33 @@
 #pragma once
 
+#include <cstddef>
+
 #include "Utility/Memory/Blob.h"
 
+class OutputStream;
+
 namespace zlib {
 Blob compress(const Blob &source);
+
+/**
+ * Decompresses the provided zlib stream. Decompresses straight into the resulting blob, so if `sizeHint` is exactly
+ * the uncompressed size, this is done with a single allocation and without any copying.
+ *
+ * @param source                        Compressed data.
+ * @param sizeHint                      Expected uncompressed size, zero if unknown. The output buffer is grown if the
+ *                                      actual size turns out to be larger, and shrunk if it turns out to be smaller.
+ * @return                              Uncompressed data, or an empty blob on error.
+ */
 Blob uncompress(const Blob &source, size_t sizeHint = 0);
+
+/**
+ * Decompresses the provided zlib stream into an output stream, chunk by chunk. Unlike `uncompress`, this never holds
+ * the whole uncompressed data in memory, so it's the one to use when the data is just passed on, e.g. written out
+ * into a file.
+ *
+ * @param source                        Compressed data.
+ * @param dst                           Output stream to write uncompressed data into.
+ * @throws Exception                    On error.
+ */
+void uncompressToStream(const Blob &source, OutputStream *dst);
 };  // namespace zlib
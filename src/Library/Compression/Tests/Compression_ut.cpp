@@ -0,0 +1,58 @@
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Compression/Compression.h"
+
+#include "Utility/Streams/StringOutputStream.h"
+#include "Utility/Exception.h"
+
+static std::string testData() {
+    std::string result;
+    for (int i = 0; i < 100000; i++)
+        result += std::to_string(i * 7 % 1013);
+    return result;
+}
+
+UNIT_TEST(Compression, RoundTrip) {
+    std::string data = testData();
+    Blob compressed = zlib::compress(Blob::view(data));
+    EXPECT_LT(compressed.size(), data.size());
+
+    // Exact hint, too small hints, no hint & too large hint should all work.
+    for (size_t hint : {data.size(), data.size() - 1, size_t(1), size_t(0), data.size() * 3})
+        EXPECT_EQ(zlib::uncompress(compressed, hint).string_view(), data);
+}
+
+UNIT_TEST(Compression, Empty) {
+    Blob compressed = zlib::compress(Blob());
+    EXPECT_TRUE(compressed);
+    EXPECT_EQ(zlib::uncompress(compressed, 0).size(), 0);
+    EXPECT_EQ(zlib::uncompress(compressed, 100).size(), 0);
+}
+
+UNIT_TEST(Compression, Stream) {
+    std::string data = testData();
+    Blob compressed = zlib::compress(Blob::view(data));
+
+    std::string result;
+    StringOutputStream stream(&result);
+    zlib::uncompressToStream(compressed, &stream);
+    stream.close();
+    EXPECT_EQ(result, data);
+}
+
+UNIT_TEST(Compression, Errors) {
+    std::string data = testData();
+    Blob compressed = zlib::compress(Blob::view(data));
+    Blob truncated = compressed.subBlob(0, compressed.size() / 2);
+    Blob garbage = Blob::fromString("this is not a zlib stream");
+
+    EXPECT_FALSE(zlib::uncompress(truncated, data.size()));
+    EXPECT_FALSE(zlib::uncompress(garbage, data.size()));
+
+    std::string result;
+    StringOutputStream stream(&result);
+    EXPECT_THROW(zlib::uncompressToStream(truncated, &stream), Exception);
+    EXPECT_THROW(zlib::uncompressToStream(garbage, &stream), Exception);
+}
@@ -33,6 +33,15 @@ void AnyConfigEntry::setValue(std::any value) {
         return;
 
     _value = std::move(value);
+    notifyListeners();
+}
+
+void AnyConfigEntry::reset() {
+    if (_handler->equals(_value, _defaultValue))
+        return;
+
+    _value = _defaultValue;
+    notifyListeners();
 }
 
 std::string AnyConfigEntry::defaultString() const {
@@ -46,3 +55,13 @@ std::string AnyConfigEntry::string() const {
 void AnyConfigEntry::setString(const std::string &value) {
     setValue(_handler->deserialize(value));
 }
+
+void AnyConfigEntry::addListener(Listener listener) {
+    assert(listener);
+    _listeners.push_back(std::move(listener));
+}
+
+void AnyConfigEntry::notifyListeners() {
+    for (const Listener &listener : _listeners)
+        listener();
+}
@@ -10,6 +10,7 @@
 class AnyConfigEntry {
  public:
     using Validator = std::function<std::any(std::any)>;
+    using Listener = std::function<void()>;
 
     AnyConfigEntry(ConfigSection *section, const std::string &name, const std::string &description, AnyHandler *handler,
                    std::any defaultValue, Validator validator);
@@ -29,9 +30,7 @@ class AnyConfigEntry {
 
     void setValue(std::any value);
 
-    void reset() {
-        _value = _defaultValue;
-    }
+    void reset();
 
     std::string defaultString() const;
 
@@ -51,11 +50,22 @@ class AnyConfigEntry {
         return _description;
     }
 
+    /**
+     * Adds a listener that's invoked every time the value of this config entry changes. Setting the same value again
+     * doesn't invoke the listeners.
+     *
+     * @param listener                  Listener to add.
+     */
+    void addListener(Listener listener);
+
  protected:
     Validator validator() const {
         return _validator;
     }
 
+ private:
+    void notifyListeners();
+
  private:
     ConfigSection *_section = nullptr;
     std::string _name;
@@ -64,4 +74,5 @@ class AnyConfigEntry {
     std::any _defaultValue;
     std::any _value;
     Validator _validator = nullptr;
+    std::vector<Listener> _listeners;
 };
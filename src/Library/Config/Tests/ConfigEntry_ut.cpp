@@ -0,0 +1,37 @@
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Config/Config.h"
+
+class TestConfig : public Config {
+ public:
+    class Section : public ConfigSection {
+     public:
+        explicit Section(TestConfig *config) : ConfigSection(config, "section") {}
+
+        ConfigEntry<int> IntEntry = {this, "int_entry", 1, "Int entry."};
+    };
+
+    Section section{this};
+};
+
+UNIT_TEST(ConfigEntry, Listeners) {
+    TestConfig config;
+    int calls = 0;
+    config.section.IntEntry.addListener([&] { calls++; });
+
+    config.section.IntEntry.setValue(2);
+    EXPECT_EQ(calls, 1);
+
+    config.section.IntEntry.setValue(2); // Same value => no call.
+    EXPECT_EQ(calls, 1);
+
+    config.section.IntEntry.setString("3");
+    EXPECT_EQ(calls, 2);
+
+    config.reset();
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(config.section.IntEntry.value(), 1);
+
+    config.reset(); // Already at default => no call.
+    EXPECT_EQ(calls, 3);
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cassert>
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "BBox.h"
+
+/**
+ * Static uniform grid over a set of axis-aligned boxes, projected onto the XY plane.
+ *
+ * Answers "which boxes might contain point (x, y)" queries in constant time. Box ids in each cell are stored in
+ * ascending order, so iterating over the query results visits the boxes in the same order as a linear scan over all
+ * the boxes would, just skipping the ones that can't contain the point.
+ */
+class BBoxGrid {
+ public:
+    BBoxGrid() = default;
+
+    /**
+     * @param boxes                     Boxes to index, box id is its index in this span. Boxes with `x1 > x2` or
+     *                                  `y1 > y2` are considered empty and are not added to the grid.
+     * @param cellSize                  Preferred cell size. Will be increased if the grid gets too large.
+     */
+    BBoxGrid(std::span<const BBoxi> boxes, int cellSize) {
+        assert(cellSize > 0);
+
+        BBoxi bounds;
+        bool first = true;
+        for (const BBoxi &box : boxes) {
+            if (isEmpty(box))
+                continue;
+            bounds = first ? box : (bounds | box);
+            first = false;
+        }
+        if (first)
+            return; // Nothing to index.
+
+        _x = bounds.x1;
+        _y = bounds.y1;
+        _cellSize = std::max({cellSize, (bounds.x2 - bounds.x1) / MAX_CELLS_PER_AXIS + 1, (bounds.y2 - bounds.y1) / MAX_CELLS_PER_AXIS + 1});
+        _width = (bounds.x2 - bounds.x1) / _cellSize + 1;
+        _height = (bounds.y2 - bounds.y1) / _cellSize + 1;
+
+        // Two passes - count ids per cell, then fill. Boxes are visited in order, so ids in each cell end up sorted.
+        _offsets.assign(_width * _height + 1, 0);
+        forEachCell(boxes, [&](int cell, int) { _offsets[cell + 1]++; });
+        for (size_t i = 1; i < _offsets.size(); i++)
+            _offsets[i] += _offsets[i - 1];
+
+        std::vector<int> positions(_offsets.begin(), _offsets.end() - 1);
+        _ids.resize(_offsets.back());
+        forEachCell(boxes, [&](int cell, int id) { _ids[positions[cell]++] = id; });
+    }
+
+    /**
+     * @param x                         X coordinate of the point to look up.
+     * @param y                         Y coordinate of the point to look up.
+     * @return                          Ids of the boxes that might contain the provided point, in ascending order.
+     *                                  It's guaranteed that all boxes that do contain the point are returned.
+     */
+    [[nodiscard]] std::span<const int> query(int x, int y) const {
+        if (x < _x || y < _y)
+            return {};
+
+        int cx = (x - _x) / _cellSize;
+        int cy = (y - _y) / _cellSize;
+        if (cx >= _width || cy >= _height)
+            return {};
+
+        int cell = cy * _width + cx;
+        return std::span<const int>(_ids).subspan(_offsets[cell], _offsets[cell + 1] - _offsets[cell]);
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _ids.empty();
+    }
+
+    [[nodiscard]] int cellSize() const {
+        return _cellSize;
+    }
+
+ private:
+    static bool isEmpty(const BBoxi &box) {
+        return box.x1 > box.x2 || box.y1 > box.y2;
+    }
+
+    template<class Callback>
+    void forEachCell(std::span<const BBoxi> boxes, Callback &&callback) const {
+        for (int id = 0; id < static_cast<int>(boxes.size()); id++) {
+            const BBoxi &box = boxes[id];
+            if (isEmpty(box))
+                continue;
+
+            int cx1 = (box.x1 - _x) / _cellSize;
+            int cx2 = (box.x2 - _x) / _cellSize;
+            int cy1 = (box.y1 - _y) / _cellSize;
+            int cy2 = (box.y2 - _y) / _cellSize;
+            for (int cy = cy1; cy <= cy2; cy++)
+                for (int cx = cx1; cx <= cx2; cx++)
+                    callback(cy * _width + cx, id);
+        }
+    }
+
+ private:
+    static constexpr int MAX_CELLS_PER_AXIS = 256;
+
+    int _x = 0;
+    int _y = 0;
+    int _cellSize = 1;
+    int _width = 0;
+    int _height = 0;
+    std::vector<int> _offsets;
+    std::vector<int> _ids;
+};
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "BBox.h"
+
+/**
+ * Static bounding volume hierarchy over a set of axis-aligned boxes.
+ *
+ * Built once, then answers box overlap and XY point queries in roughly logarithmic time. Query results are exact
+ * (i.e. only the boxes that actually pass the test are returned), and are sorted by id, so iterating over them visits
+ * the boxes in the same order as a linear scan would.
+ */
+class BBoxTree {
+ public:
+    BBoxTree() = default;
+
+    /**
+     * @param boxes                     Boxes to index, box id is its index in this span.
+     */
+    explicit BBoxTree(std::span<const BBoxi> boxes) {
+        if (boxes.empty())
+            return;
+
+        _ids.resize(boxes.size());
+        std::iota(_ids.begin(), _ids.end(), 0);
+        _nodes.reserve(2 * boxes.size() / LEAF_SIZE + 1);
+        build(boxes, 0, _ids.size());
+
+        _boxes.reserve(_ids.size());
+        for (int id : _ids)
+            _boxes.push_back(boxes[id]);
+    }
+
+    /**
+     * @param box                       Box to check against.
+     * @param[out] ids                  Ids of the boxes that intersect `box`, sorted in ascending order. Previous
+     *                                  contents are discarded.
+     */
+    template<class T>
+    void queryBox(const BBox<T> &box, std::vector<int> *ids) const {
+        query(ids, [&](const BBoxi &other) { return box.intersects(other); });
+    }
+
+    /**
+     * @param x                         X coordinate.
+     * @param y                         Y coordinate.
+     * @param[out] ids                  Ids of the boxes whose XY projections contain point (x, y), sorted in
+     *                                  ascending order. Previous contents are discarded.
+     */
+    void queryXY(int x, int y, std::vector<int> *ids) const {
+        query(ids, [&](const BBoxi &other) { return other.containsXY(x, y); });
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _nodes.empty();
+    }
+
+ private:
+    struct Node {
+        BBoxi box;
+        int first = 0; // First item in `_ids` / `_boxes` for leaves.
+        int count = 0; // Number of items for leaves, zero for inner nodes.
+        int right = 0; // Index of the right child for inner nodes, left child always follows its parent.
+    };
+
+    void build(std::span<const BBoxi> boxes, size_t begin, size_t end) {
+        assert(begin < end);
+
+        int index = _nodes.size();
+        _nodes.emplace_back();
+
+        BBoxi bounds = boxes[_ids[begin]];
+        BBoxi centers = BBoxi::forPoints(bounds.center(), bounds.center());
+        for (size_t i = begin + 1; i < end; i++) {
+            const BBoxi &box = boxes[_ids[i]];
+            bounds = bounds | box;
+            centers = centers | BBoxi::forPoints(box.center(), box.center());
+        }
+        _nodes[index].box = bounds;
+
+        if (end - begin <= LEAF_SIZE) {
+            _nodes[index].first = begin;
+            _nodes[index].count = end - begin;
+            return;
+        }
+
+        // Median split along the longest axis of the box centers.
+        Vec3i size = centers.size();
+        int axis = size.x >= size.y && size.x >= size.z ? 0 : size.y >= size.z ? 1 : 2;
+        auto key = [&](int id) {
+            Vec3i center = boxes[id].center();
+            return axis == 0 ? center.x : axis == 1 ? center.y : center.z;
+        };
+        size_t middle = begin + (end - begin) / 2;
+        std::nth_element(_ids.begin() + begin, _ids.begin() + middle, _ids.begin() + end,
+                         [&](int l, int r) { return key(l) < key(r); });
+
+        build(boxes, begin, middle);
+        _nodes[index].right = _nodes.size();
+        build(boxes, middle, end);
+    }
+
+    template<class Predicate>
+    void query(std::vector<int> *ids, Predicate &&predicate) const {
+        ids->clear();
+        if (_nodes.empty())
+            return;
+
+        int stack[MAX_DEPTH];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+        while (stackSize > 0) {
+            const Node &node = _nodes[stack[--stackSize]];
+            if (!predicate(node.box))
+                continue;
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++)
+                    if (predicate(_boxes[i]))
+                        ids->push_back(_ids[i]);
+            } else {
+                assert(stackSize + 2 <= MAX_DEPTH);
+                stack[stackSize++] = node.right;
+                stack[stackSize++] = &node - _nodes.data() + 1;
+            }
+        }
+
+        std::sort(ids->begin(), ids->end());
+    }
+
+ private:
+    static constexpr size_t LEAF_SIZE = 4;
+    static constexpr int MAX_DEPTH = 64; // Median splits keep the tree balanced, so this is plenty.
+
+    std::vector<Node> _nodes;
+    std::vector<int> _ids;
+    std::vector<BBoxi> _boxes; // Same order as `_ids`.
+};
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "BBox.h"
+#include "Vec.h"
+
+/**
+ * Incrementally maintained spatial hash over a set of points, keyed by XY cell.
+ *
+ * Meant for dynamic objects that move every frame. Updating a point that stays in the same cell is O(1), and so is
+ * moving it to another cell. Query results are exact (only the points that actually pass the test are returned) and
+ * are sorted by id, so iterating over them visits the objects in the same order as a linear scan would.
+ */
+class SpatialHash {
+ public:
+    /**
+     * @param cellSize                  Cell size. Should be comparable to the typical query size.
+     */
+    explicit SpatialHash(int cellSize) : _cellSize(cellSize) {
+        assert(cellSize > 0);
+    }
+
+    /**
+     * Inserts a point into the hash, or moves it if it's already there.
+     *
+     * @param id                        Point id, must be non-negative. Ids are expected to be dense.
+     * @param pos                       New point position.
+     */
+    void update(int id, Vec3i pos) {
+        assert(id >= 0);
+
+        if (id >= static_cast<int>(_entries.size()))
+            _entries.resize(id + 1);
+
+        Entry &entry = _entries[id];
+        int64_t cell = cellKey(cellCoord(pos.x), cellCoord(pos.y));
+        entry.pos = pos;
+        if (entry.present && entry.cell == cell)
+            return;
+
+        if (entry.present)
+            removeFromCell(id, entry.cell);
+        entry.present = true;
+        entry.cell = cell;
+        _cells[cell].push_back(id);
+        _size++;
+    }
+
+    /**
+     * Removes a point from the hash. Does nothing if there is no point with the provided id.
+     *
+     * @param id                        Point id.
+     */
+    void erase(int id) {
+        if (!contains(id))
+            return;
+
+        removeFromCell(id, _entries[id].cell);
+        _entries[id].present = false;
+    }
+
+    [[nodiscard]] bool contains(int id) const {
+        return id >= 0 && id < static_cast<int>(_entries.size()) && _entries[id].present;
+    }
+
+    void clear() {
+        _entries.clear();
+        _cells.clear();
+        _size = 0;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _size == 0;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    /**
+     * @param box                       Box to check against, only its XY projection is used.
+     * @param[out] ids                  Ids of the points that lie inside the XY projection of `box`, sorted in
+     *                                  ascending order. Previous contents are discarded.
+     */
+    void queryBox(const BBoxi &box, std::vector<int> *ids) const {
+        query(box.x1, box.y1, box.x2, box.y2, ids, [&](Vec3i pos) { return box.containsXY(pos.x, pos.y); });
+    }
+
+    /**
+     * @param center                    Center of the circle to check against, only X and Y are used.
+     * @param radius                    Circle radius.
+     * @param[out] ids                  Ids of the points that lie inside the circle in XY plane, sorted in ascending
+     *                                  order. Previous contents are discarded.
+     */
+    void queryRadius(Vec3i center, int radius, std::vector<int> *ids) const {
+        int64_t radiusSqr = static_cast<int64_t>(radius) * radius;
+        query(center.x - radius, center.y - radius, center.x + radius, center.y + radius, ids, [&](Vec3i pos) {
+            int64_t dx = pos.x - center.x;
+            int64_t dy = pos.y - center.y;
+            return dx * dx + dy * dy <= radiusSqr;
+        });
+    }
+
+ private:
+    struct Entry {
+        Vec3i pos;
+        int64_t cell = 0;
+        bool present = false;
+    };
+
+    int cellCoord(int coord) const {
+        // Round towards negative infinity so that cells are uniform around zero.
+        return coord >= 0 ? coord / _cellSize : -((-coord - 1) / _cellSize) - 1;
+    }
+
+    static int64_t cellKey(int cx, int cy) {
+        return (static_cast<int64_t>(cx) << 32) | static_cast<uint32_t>(cy);
+    }
+
+    void removeFromCell(int id, int64_t cell) {
+        auto pos = _cells.find(cell);
+        assert(pos != _cells.end());
+
+        std::vector<int> &cellIds = pos->second;
+        auto idPos = std::find(cellIds.begin(), cellIds.end(), id);
+        assert(idPos != cellIds.end());
+        *idPos = cellIds.back();
+        cellIds.pop_back();
+        if (cellIds.empty())
+            _cells.erase(pos);
+        _size--;
+    }
+
+    template<class Predicate>
+    void query(int x1, int y1, int x2, int y2, std::vector<int> *ids, Predicate &&predicate) const {
+        ids->clear();
+        if (_size == 0)
+            return;
+
+        auto collect = [&](const std::vector<int> &cellIds) {
+            for (int id : cellIds)
+                if (predicate(_entries[id].pos))
+                    ids->push_back(id);
+        };
+
+        int cx1 = cellCoord(x1);
+        int cx2 = cellCoord(x2);
+        int cy1 = cellCoord(y1);
+        int cy2 = cellCoord(y2);
+        int64_t cellCount = (static_cast<int64_t>(cx2) - cx1 + 1) * (static_cast<int64_t>(cy2) - cy1 + 1);
+        if (cellCount > static_cast<int64_t>(_cells.size())) {
+            // Huge query, cheaper to just go through all the non-empty cells.
+            for (const auto &cell : _cells)
+                collect(cell.second);
+        } else {
+            for (int cy = cy1; cy <= cy2; cy++) {
+                for (int cx = cx1; cx <= cx2; cx++) {
+                    auto pos = _cells.find(cellKey(cx, cy));
+                    if (pos != _cells.end())
+                        collect(pos->second);
+                }
+            }
+        }
+
+        std::sort(ids->begin(), ids->end());
+    }
+
+ private:
+    int _cellSize = 1;
+    size_t _size = 0;
+    std::vector<Entry> _entries; // Indexed by id.
+    std::unordered_map<int64_t, std::vector<int>> _cells;
+};
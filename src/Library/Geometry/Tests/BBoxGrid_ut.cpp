@@ -0,0 +1,75 @@
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/BBoxGrid.h"
+
+static BBoxi makeBox(int x1, int y1, int x2, int y2) {
+    BBoxi result;
+    result.x1 = x1;
+    result.y1 = y1;
+    result.x2 = x2;
+    result.y2 = y2;
+    return result;
+}
+
+UNIT_TEST(BBoxGrid, Empty) {
+    BBoxGrid grid;
+    EXPECT_TRUE(grid.empty());
+    EXPECT_TRUE(grid.query(0, 0).empty());
+
+    std::vector<BBoxi> boxes = {makeBox(10, 10, 0, 0)}; // Inverted box is empty.
+    BBoxGrid grid2(boxes, 16);
+    EXPECT_TRUE(grid2.empty());
+    EXPECT_TRUE(grid2.query(5, 5).empty());
+}
+
+UNIT_TEST(BBoxGrid, MatchesLinearScan) {
+    std::vector<BBoxi> boxes = {
+        makeBox(1, 1, 0, 0), // Empty, should never be returned.
+        makeBox(-100, -100, 100, 100),
+        makeBox(0, 0, 10, 10),
+        makeBox(50, -30, 300, 20),
+        makeBox(-250, 90, -240, 400),
+        makeBox(99, 99, 99, 99)
+    };
+    BBoxGrid grid(boxes, 32);
+
+    for (int y = -300; y <= 450; y += 7) {
+        for (int x = -300; x <= 350; x += 7) {
+            std::vector<int> expected;
+            for (int i = 0; i < static_cast<int>(boxes.size()); i++)
+                if (boxes[i].containsXY(x, y))
+                    expected.push_back(i);
+
+            std::vector<int> actual;
+            for (int id : grid.query(x, y))
+                if (boxes[id].containsXY(x, y))
+                    actual.push_back(id);
+
+            EXPECT_EQ(actual, expected);
+        }
+    }
+}
+
+UNIT_TEST(BBoxGrid, EdgesAndOrder) {
+    std::vector<BBoxi> boxes = {makeBox(0, 0, 100, 100), makeBox(100, 100, 200, 200), makeBox(0, 0, 200, 200)};
+    BBoxGrid grid(boxes, 10);
+
+    std::span<const int> ids = grid.query(100, 100);
+    EXPECT_EQ(std::vector<int>(ids.begin(), ids.end()), std::vector<int>({0, 1, 2}));
+
+    ids = grid.query(200, 200);
+    EXPECT_EQ(std::vector<int>(ids.begin(), ids.end()), std::vector<int>({1, 2}));
+
+    EXPECT_TRUE(grid.query(210, 0).empty());
+    EXPECT_TRUE(grid.query(-1, 0).empty());
+}
+
+UNIT_TEST(BBoxGrid, HugeBoundsLimitGridSize) {
+    std::vector<BBoxi> boxes = {makeBox(-1000000, -1000000, 1000000, 1000000)};
+    BBoxGrid grid(boxes, 1);
+    EXPECT_GT(grid.cellSize(), 1);
+    EXPECT_EQ(grid.query(0, 0).size(), 1);
+    EXPECT_EQ(grid.query(1000000, -1000000).size(), 1);
+}
@@ -0,0 +1,87 @@
+#include <random>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/BBoxTree.h"
+
+static std::vector<BBoxi> randomBoxes(int count, int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pos(-10000, 10000);
+    std::uniform_int_distribution<int> size(0, 1500);
+
+    std::vector<BBoxi> result;
+    for (int i = 0; i < count; i++) {
+        Vec3i a(pos(rng), pos(rng), pos(rng));
+        Vec3i b = a + Vec3i(size(rng), size(rng), size(rng));
+        result.push_back(BBoxi::forPoints(a, b));
+    }
+    return result;
+}
+
+UNIT_TEST(BBoxTree, Empty) {
+    BBoxTree tree;
+    std::vector<int> ids = {1, 2, 3};
+    tree.queryXY(0, 0, &ids);
+    EXPECT_TRUE(ids.empty());
+    EXPECT_TRUE(tree.empty());
+}
+
+UNIT_TEST(BBoxTree, QueryBoxMatchesLinearScan) {
+    std::vector<BBoxi> boxes = randomBoxes(1000, 1);
+    std::vector<BBoxi> probes = randomBoxes(500, 2);
+    BBoxTree tree(boxes);
+
+    std::vector<int> actual;
+    for (const BBoxi &probe : probes) {
+        std::vector<int> expected;
+        for (int i = 0; i < static_cast<int>(boxes.size()); i++)
+            if (probe.intersects(boxes[i]))
+                expected.push_back(i);
+
+        tree.queryBox(probe, &actual);
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+UNIT_TEST(BBoxTree, QueryXYMatchesLinearScan) {
+    std::vector<BBoxi> boxes = randomBoxes(1000, 3);
+    BBoxTree tree(boxes);
+
+    std::vector<int> actual;
+    for (int y = -10000; y <= 10000; y += 731) {
+        for (int x = -10000; x <= 10000; x += 677) {
+            std::vector<int> expected;
+            for (int i = 0; i < static_cast<int>(boxes.size()); i++)
+                if (boxes[i].containsXY(x, y))
+                    expected.push_back(i);
+
+            tree.queryXY(x, y, &actual);
+            EXPECT_EQ(actual, expected);
+        }
+    }
+}
+
+UNIT_TEST(BBoxTree, DuplicateBoxes) {
+    std::vector<BBoxi> boxes(100, BBoxi::cubic(Vec3i(0, 0, 0), 10));
+    BBoxTree tree(boxes);
+
+    std::vector<int> ids;
+    tree.queryXY(5, 5, &ids);
+    EXPECT_EQ(ids.size(), 100);
+    EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+
+    tree.queryBox(BBoxi::cubic(Vec3i(0, 0, 100), 10), &ids);
+    EXPECT_TRUE(ids.empty());
+}
+
+UNIT_TEST(BBoxTree, QueryFloatBox) {
+    std::vector<BBoxi> boxes = {BBoxi::forPoints(Vec3i(0, 0, 0), Vec3i(10, 10, 10))};
+    BBoxTree tree(boxes);
+
+    std::vector<int> ids;
+    tree.queryBox(BBoxf::forPoints(Vec3f(10.5f, 0, 0), Vec3f(20, 10, 10)), &ids);
+    EXPECT_TRUE(ids.empty());
+    tree.queryBox(BBoxf::forPoints(Vec3f(9.5f, 0, 0), Vec3f(20, 10, 10)), &ids);
+    EXPECT_EQ(ids, std::vector<int>({0}));
+}
@@ -0,0 +1,93 @@
+#include <random>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/SpatialHash.h"
+
+UNIT_TEST(SpatialHash, Empty) {
+    SpatialHash hash(128);
+    std::vector<int> ids = {1, 2, 3};
+    hash.queryBox(BBoxi::forPoints(Vec3i(-1000, -1000, -1000), Vec3i(1000, 1000, 1000)), &ids);
+    EXPECT_TRUE(ids.empty());
+    EXPECT_TRUE(hash.empty());
+    EXPECT_FALSE(hash.contains(0));
+}
+
+UNIT_TEST(SpatialHash, UpdateErase) {
+    SpatialHash hash(100);
+    hash.update(3, Vec3i(10, 10, 0));
+    hash.update(1, Vec3i(-10, -10, 0));
+    EXPECT_EQ(hash.size(), 2);
+    EXPECT_TRUE(hash.contains(3));
+    EXPECT_FALSE(hash.contains(2));
+
+    std::vector<int> ids;
+    hash.queryBox(BBoxi::forPoints(Vec3i(-20, -20, 0), Vec3i(20, 20, 0)), &ids);
+    EXPECT_EQ(ids, std::vector<int>({1, 3}));
+
+    hash.update(3, Vec3i(500, 500, 0)); // Move to another cell.
+    hash.update(1, Vec3i(-11, -11, 0)); // Move within the same cell.
+    EXPECT_EQ(hash.size(), 2);
+    hash.queryBox(BBoxi::forPoints(Vec3i(-20, -20, 0), Vec3i(20, 20, 0)), &ids);
+    EXPECT_EQ(ids, std::vector<int>({1}));
+
+    hash.erase(1);
+    hash.erase(1);
+    hash.erase(100);
+    EXPECT_EQ(hash.size(), 1);
+    hash.queryRadius(Vec3i(500, 500, 0), 1, &ids);
+    EXPECT_EQ(ids, std::vector<int>({3}));
+
+    hash.clear();
+    EXPECT_TRUE(hash.empty());
+    hash.queryRadius(Vec3i(500, 500, 0), 1, &ids);
+    EXPECT_TRUE(ids.empty());
+}
+
+UNIT_TEST(SpatialHash, MatchesLinearScan) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> pos(-20000, 20000);
+    std::uniform_int_distribution<int> size(0, 3000);
+    std::uniform_int_distribution<int> step(-300, 300);
+
+    SpatialHash hash(512);
+    std::vector<Vec3i> points(300);
+    for (int i = 0; i < static_cast<int>(points.size()); i++) {
+        points[i] = Vec3i(pos(rng), pos(rng), pos(rng));
+        hash.update(i, points[i]);
+    }
+
+    std::vector<int> ids;
+    for (int frame = 0; frame < 50; frame++) {
+        // Move everything around a bit, just like actors & projectiles do.
+        for (int i = 0; i < static_cast<int>(points.size()); i++) {
+            points[i] += Vec3i(step(rng), step(rng), 0);
+            hash.update(i, points[i]);
+        }
+
+        Vec3i a(pos(rng), pos(rng), pos(rng));
+        BBoxi box = BBoxi::forPoints(a, a + Vec3i(size(rng), size(rng), size(rng)));
+        std::vector<int> expectedBox;
+        for (int i = 0; i < static_cast<int>(points.size()); i++)
+            if (box.containsXY(points[i].x, points[i].y))
+                expectedBox.push_back(i);
+        hash.queryBox(box, &ids);
+        EXPECT_EQ(ids, expectedBox);
+
+        int radius = size(rng);
+        std::vector<int> expectedRadius;
+        for (int i = 0; i < static_cast<int>(points.size()); i++) {
+            int64_t dx = points[i].x - a.x;
+            int64_t dy = points[i].y - a.y;
+            if (dx * dx + dy * dy <= static_cast<int64_t>(radius) * radius)
+                expectedRadius.push_back(i);
+        }
+        hash.queryRadius(a, radius, &ids);
+        EXPECT_EQ(ids, expectedRadius);
+    }
+
+    // Query that covers everything goes through the fallback path.
+    hash.queryBox(BBoxi::forPoints(Vec3i(-1000000, -1000000, 0), Vec3i(1000000, 1000000, 0)), &ids);
+    EXPECT_EQ(ids.size(), points.size());
+}
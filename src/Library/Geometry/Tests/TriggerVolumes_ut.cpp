@@ -0,0 +1,103 @@
+#include <random>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/TriggerVolumes.h"
+
+UNIT_TEST(TriggerVolumes, Empty) {
+    TriggerVolumes volumes;
+    std::vector<int> ids = {1, 2, 3};
+    volumes.query(Vec3i(0, 0, 0), &ids);
+    EXPECT_TRUE(ids.empty());
+    EXPECT_TRUE(volumes.empty());
+}
+
+UNIT_TEST(TriggerVolumes, Query) {
+    TriggerVolumes volumes(100);
+    EXPECT_EQ(volumes.add(Vec3i(0, 0, 0), 50), 0);
+    EXPECT_EQ(volumes.add(Vec3i(-1000, 1000, 0), 300), 1); // Spans several cells.
+    EXPECT_EQ(volumes.add(Vec3i(20, 0, 0), 50), 2);
+    EXPECT_EQ(volumes.size(), 3);
+
+    std::vector<int> ids;
+    volumes.query(Vec3i(10, 0, 0), &ids);
+    EXPECT_EQ(ids, std::vector<int>({0, 2}));
+
+    volumes.query(Vec3i(50, 0, 0), &ids); // Distance to the first volume is exactly its radius.
+    EXPECT_EQ(ids, std::vector<int>({2}));
+
+    volumes.query(Vec3i(10, 0, 100), &ids); // Volumes are spheres, not cylinders.
+    EXPECT_TRUE(ids.empty());
+
+    volumes.query(Vec3i(-1250, 1100, 0), &ids);
+    EXPECT_EQ(ids, std::vector<int>({1}));
+
+    EXPECT_TRUE(volumes.contains(0, Vec3i(10, 0, 0)));
+    EXPECT_FALSE(volumes.contains(0, Vec3i(50, 0, 0)));
+    EXPECT_TRUE(volumes.contains(2, Vec3i(50, 0, 0)));
+    EXPECT_FALSE(volumes.contains(1, Vec3i(10, 0, 0)));
+}
+
+UNIT_TEST(TriggerVolumes, MatchesLinearScan) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coord(-5000, 5000);
+    std::uniform_int_distribution<int> radius(0, 1000);
+
+    std::vector<std::pair<Vec3i, int>> spheres;
+    TriggerVolumes volumes(256);
+    for (int i = 0; i < 200; i++) {
+        Vec3i center(coord(rng), coord(rng), coord(rng) / 10);
+        int r = radius(rng);
+        spheres.emplace_back(center, r);
+        volumes.add(center, r);
+    }
+
+    std::vector<int> ids;
+    for (int i = 0; i < 1000; i++) {
+        Vec3i pos(coord(rng), coord(rng), coord(rng) / 10);
+
+        std::vector<int> expected;
+        for (size_t j = 0; j < spheres.size(); j++) {
+            Vec3i d = pos - spheres[j].first;
+            if (static_cast<int64_t>(d.x) * d.x + static_cast<int64_t>(d.y) * d.y + static_cast<int64_t>(d.z) * d.z <
+                static_cast<int64_t>(spheres[j].second) * spheres[j].second)
+                expected.push_back(j);
+        }
+
+        volumes.query(pos, &ids);
+        EXPECT_EQ(ids, expected);
+    }
+}
+
+UNIT_TEST(TriggerVolumeTracker, RecomputesOnlyOnMove) {
+    TriggerVolumes volumes(100);
+    volumes.add(Vec3i(0, 0, 0), 50);
+
+    TriggerVolumeTracker tracker;
+    EXPECT_EQ(tracker.update(volumes, 0, Vec3i(0, 0, 0)), std::vector<int>({0}));
+    EXPECT_EQ(tracker.update(volumes, 1, Vec3i(500, 0, 0)), std::vector<int>());
+    EXPECT_EQ(tracker.recomputeCount(), 2);
+
+    // Standing still is free.
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(tracker.update(volumes, 0, Vec3i(0, 0, 0)), std::vector<int>({0}));
+        EXPECT_EQ(tracker.update(volumes, 1, Vec3i(500, 0, 0)), std::vector<int>());
+    }
+    EXPECT_EQ(tracker.recomputeCount(), 2);
+
+    // Moving in & out.
+    EXPECT_EQ(tracker.update(volumes, 0, Vec3i(100, 0, 0)), std::vector<int>());
+    EXPECT_EQ(tracker.update(volumes, 1, Vec3i(10, 0, 0)), std::vector<int>({0}));
+    EXPECT_EQ(tracker.recomputeCount(), 4);
+
+    // Changing the volumes invalidates the cache.
+    volumes.add(Vec3i(100, 0, 0), 10);
+    EXPECT_EQ(tracker.update(volumes, 0, Vec3i(100, 0, 0)), std::vector<int>({1}));
+    EXPECT_EQ(tracker.recomputeCount(), 5);
+
+    // Truncated entities are recomputed.
+    tracker.truncate(1);
+    EXPECT_EQ(tracker.update(volumes, 1, Vec3i(10, 0, 0)), std::vector<int>({0}));
+    EXPECT_EQ(tracker.recomputeCount(), 6);
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Vec.h"
+
+/**
+ * Static set of sphere trigger volumes, bucketed into a uniform XY grid.
+ *
+ * Each volume is inserted into all the grid cells that its bounding square touches, so a point query only has to look
+ * at a single cell. Volume ids are assigned in insertion order, starting at zero.
+ */
+class TriggerVolumes {
+ public:
+    /**
+     * @param cellSize                  Grid cell size. Should be comparable to the typical volume radius.
+     */
+    explicit TriggerVolumes(int cellSize = 512) : _cellSize(cellSize) {
+        assert(cellSize > 0);
+    }
+
+    /**
+     * @param center                    Sphere center.
+     * @param radius                    Sphere radius. Points at exactly this distance from the center are not inside
+     *                                  the sphere.
+     * @return                          Id of the new volume.
+     */
+    int add(Vec3i center, int radius) {
+        assert(radius >= 0);
+
+        int id = _volumes.size();
+        _volumes.push_back({center, radius});
+        for (int cy = cellCoord(center.y - radius); cy <= cellCoord(center.y + radius); cy++)
+            for (int cx = cellCoord(center.x - radius); cx <= cellCoord(center.x + radius); cx++)
+                _cells[cellKey(cx, cy)].push_back(id);
+        _revision++;
+        return id;
+    }
+
+    void clear() {
+        _volumes.clear();
+        _cells.clear();
+        _revision++;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _volumes.empty();
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _volumes.size();
+    }
+
+    /**
+     * @return                          Counter that's incremented every time the set of volumes changes. Used by
+     *                                  `TriggerVolumeTracker` to invalidate its cache.
+     */
+    [[nodiscard]] int revision() const {
+        return _revision;
+    }
+
+    /**
+     * @param pos                       Point to check.
+     * @param[out] ids                  Ids of the volumes that contain `pos`, sorted in ascending order. Previous
+     *                                  contents are discarded.
+     */
+    void query(Vec3i pos, std::vector<int> *ids) const {
+        ids->clear();
+
+        auto cell = _cells.find(cellKey(cellCoord(pos.x), cellCoord(pos.y)));
+        if (cell == _cells.end())
+            return;
+
+        // Cell lists are filled in insertion order, so the result is already sorted.
+        for (int id : cell->second)
+            if (contains(id, pos))
+                ids->push_back(id);
+    }
+
+    /**
+     * @param id                        Volume id.
+     * @param pos                       Point to check.
+     * @return                          Whether the volume contains `pos`.
+     */
+    [[nodiscard]] bool contains(int id, Vec3i pos) const {
+        assert(id >= 0 && id < static_cast<int>(_volumes.size()));
+
+        const Volume &volume = _volumes[id];
+        int64_t dx = static_cast<int64_t>(pos.x) - volume.center.x;
+        int64_t dy = static_cast<int64_t>(pos.y) - volume.center.y;
+        int64_t dz = static_cast<int64_t>(pos.z) - volume.center.z;
+        return dx * dx + dy * dy + dz * dz < static_cast<int64_t>(volume.radius) * volume.radius;
+    }
+
+ private:
+    struct Volume {
+        Vec3i center;
+        int radius = 0;
+    };
+
+    int cellCoord(int coord) const {
+        // Round towards negative infinity so that cells are uniform around zero.
+        return coord >= 0 ? coord / _cellSize : -((-coord - 1) / _cellSize) - 1;
+    }
+
+    static int64_t cellKey(int cx, int cy) {
+        return (static_cast<int64_t>(cx) << 32) | static_cast<uint32_t>(cy);
+    }
+
+    int _cellSize = 1;
+    int _revision = 0;
+    std::vector<Volume> _volumes;
+    std::unordered_map<int64_t, std::vector<int>> _cells;
+};
+
+/**
+ * Tracks which trigger volumes a set of moving entities are inside of.
+ *
+ * Containing volumes are a function of the entity position alone, so they are cached per entity together with the
+ * position they were computed for, and are only recomputed for the entities that have moved. For entities that stay
+ * in place an update is a single position comparison.
+ */
+class TriggerVolumeTracker {
+ public:
+    /**
+     * @param volumes                   Trigger volumes to check against.
+     * @param id                        Entity id, must be non-negative. Ids are expected to be dense.
+     * @param pos                       Current entity position.
+     * @return                          Ids of the volumes that contain the entity, sorted in ascending order. The
+     *                                  reference stays valid until the next call to a non-const method.
+     */
+    const std::vector<int> &update(const TriggerVolumes &volumes, int id, Vec3i pos) {
+        assert(id >= 0);
+
+        if (_revision != volumes.revision()) {
+            _entries.clear();
+            _revision = volumes.revision();
+        }
+
+        if (id >= static_cast<int>(_entries.size()))
+            _entries.resize(id + 1);
+
+        Entry &entry = _entries[id];
+        if (!entry.valid || entry.pos != pos) {
+            volumes.query(pos, &entry.volumes);
+            entry.pos = pos;
+            entry.valid = true;
+            _recomputeCount++;
+        }
+        return entry.volumes;
+    }
+
+    /**
+     * Forgets about the entities with ids `>= size`.
+     *
+     * @param size                      New number of tracked entities.
+     */
+    void truncate(size_t size) {
+        if (_entries.size() > size)
+            _entries.resize(size);
+    }
+
+    void clear() {
+        _entries.clear();
+    }
+
+    /**
+     * @return                          Total number of times the containing volumes were recomputed because an entity
+     *                                  has moved. Mainly useful for tests.
+     */
+    [[nodiscard]] int64_t recomputeCount() const {
+        return _recomputeCount;
+    }
+
+ private:
+    struct Entry {
+        Vec3i pos;
+        bool valid = false;
+        std::vector<int> volumes;
+    };
+
+    int _revision = -1;
+    int64_t _recomputeCount = 0;
+    std::vector<Entry> _entries;
+};
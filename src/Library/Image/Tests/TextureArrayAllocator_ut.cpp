@@ -0,0 +1,63 @@
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Image/TextureArrayAllocator.h"
+
+UNIT_TEST(TextureArrayAllocator, GroupsBySize) {
+    TextureArrayAllocator allocator(4, 16);
+
+    EXPECT_EQ(allocator.insert("a", {128, 128}), (TextureArraySlot{0, 0}));
+    EXPECT_EQ(allocator.insert("b", {64, 128}), (TextureArraySlot{1, 0}));
+    EXPECT_EQ(allocator.insert("c", {128, 128}), (TextureArraySlot{0, 1}));
+    EXPECT_EQ(allocator.insert("d", {64, 128}), (TextureArraySlot{1, 1}));
+
+    EXPECT_EQ(allocator.arrayCount(), 2);
+    EXPECT_EQ(allocator.arraySize(0), Sizei(128, 128));
+    EXPECT_EQ(allocator.arraySize(1), Sizei(64, 128));
+    EXPECT_EQ(allocator.layers(0), std::vector<std::string>({"a", "c"}));
+    EXPECT_EQ(allocator.layers(1), std::vector<std::string>({"b", "d"}));
+}
+
+UNIT_TEST(TextureArrayAllocator, InsertExisting) {
+    TextureArrayAllocator allocator(4, 16);
+
+    EXPECT_EQ(allocator.insert("a", {128, 128}), (TextureArraySlot{0, 0}));
+    EXPECT_EQ(allocator.insert("a", {64, 64}), (TextureArraySlot{0, 0})); // Size is ignored for existing textures.
+    EXPECT_EQ(allocator.find("a"), (TextureArraySlot{0, 0}));
+    EXPECT_FALSE(allocator.find("b"));
+    EXPECT_EQ(allocator.arrayCount(), 1);
+}
+
+UNIT_TEST(TextureArrayAllocator, OutOfArrays) {
+    TextureArrayAllocator allocator(2, 16);
+
+    EXPECT_TRUE(allocator.insert("a", {32, 32}));
+    EXPECT_TRUE(allocator.insert("b", {64, 64}));
+    EXPECT_FALSE(allocator.insert("c", {128, 128}));
+    EXPECT_FALSE(allocator.find("c"));
+}
+
+UNIT_TEST(TextureArrayAllocator, OutOfLayers) {
+    TextureArrayAllocator allocator(4, 2);
+
+    EXPECT_EQ(allocator.insert("a", {32, 32}), (TextureArraySlot{0, 0}));
+    EXPECT_EQ(allocator.insert("b", {32, 32}), (TextureArraySlot{0, 1}));
+    EXPECT_FALSE(allocator.insert("c", {32, 32}));
+    EXPECT_FALSE(allocator.find("c"));
+    EXPECT_EQ(allocator.layers(0), std::vector<std::string>({"a", "b"}));
+
+    // Other arrays are not affected.
+    EXPECT_EQ(allocator.insert("d", {64, 64}), (TextureArraySlot{1, 0}));
+}
+
+UNIT_TEST(TextureArrayAllocator, Clear) {
+    TextureArrayAllocator allocator(4, 16);
+
+    allocator.insert("a", {32, 32});
+    allocator.insert("b", {64, 64});
+    allocator.clear();
+    EXPECT_EQ(allocator.arrayCount(), 0);
+    EXPECT_FALSE(allocator.find("a"));
+    EXPECT_EQ(allocator.insert("b", {64, 64}), (TextureArraySlot{0, 0}));
+}
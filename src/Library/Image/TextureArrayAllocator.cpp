@@ -0,0 +1,49 @@
+#include "TextureArrayAllocator.h"
+
+#include <cassert>
+
+TextureArrayAllocator::TextureArrayAllocator(int maxArrays, int maxLayers) : _maxArrays(maxArrays), _maxLayers(maxLayers) {
+    assert(maxArrays > 0 && maxLayers > 0);
+}
+
+TextureArraySlot TextureArrayAllocator::insert(const std::string &name, Sizei size) {
+    if (TextureArraySlot slot = find(name))
+        return slot;
+
+    int array = findArray(size);
+    if (array == -1) {
+        if (arrayCount() == _maxArrays)
+            return {};
+
+        array = _arrays.size();
+        _arrays.push_back({size});
+    }
+
+    Array &target = _arrays[array];
+    if (static_cast<int>(target.layers.size()) == _maxLayers)
+        return {};
+
+    TextureArraySlot slot = {array, static_cast<int>(target.layers.size())};
+    target.layers.push_back(name);
+    _slotByName.emplace(name, slot);
+    return slot;
+}
+
+TextureArraySlot TextureArrayAllocator::find(const std::string &name) const {
+    auto pos = _slotByName.find(name);
+    if (pos == _slotByName.end())
+        return {};
+    return pos->second;
+}
+
+void TextureArrayAllocator::clear() {
+    _arrays.clear();
+    _slotByName.clear();
+}
+
+int TextureArrayAllocator::findArray(Sizei size) const {
+    for (int i = 0; i < arrayCount(); i++)
+        if (_arrays[i].size == size)
+            return i;
+    return -1;
+}
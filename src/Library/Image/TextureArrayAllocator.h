@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Library/Geometry/Size.h"
+
+/**
+ * Location of a texture inside a set of texture arrays.
+ */
+struct TextureArraySlot {
+    int array = -1;
+    int layer = -1;
+
+    explicit operator bool() const {
+        return array >= 0;
+    }
+
+    friend bool operator==(const TextureArraySlot &l, const TextureArraySlot &r) = default;
+};
+
+/**
+ * CPU-side bookkeeping for packing textures into texture arrays.
+ *
+ * All layers in a texture array must have the same size, so textures are grouped into arrays by size, one array per
+ * size. Arrays are numbered in the order their sizes were first seen, and layers are assigned in insertion order.
+ * Textures are never moved or evicted once packed, as the renderer bakes their slots into the vertex data.
+ *
+ * This class doesn't talk to the GPU. The renderer is supposed to use `layers` to find out what to upload, and
+ * `layerCount` to size the arrays.
+ */
+class TextureArrayAllocator {
+ public:
+    /**
+     * @param maxArrays                 Max number of texture arrays, i.e. max number of different texture sizes.
+     * @param maxLayers                 Max number of layers in a single array.
+     */
+    TextureArrayAllocator(int maxArrays, int maxLayers);
+
+    /**
+     * @param name                      Texture name.
+     * @param size                      Texture size. Ignored if the texture is already in this allocator.
+     * @return                          Slot for the texture, or an empty slot if there is no room for it.
+     */
+    TextureArraySlot insert(const std::string &name, Sizei size);
+
+    /**
+     * @param name                      Texture name.
+     * @return                          Slot of the texture, or an empty slot if it's not in this allocator.
+     */
+    [[nodiscard]] TextureArraySlot find(const std::string &name) const;
+
+    /**
+     * Removes all the textures and all the arrays.
+     */
+    void clear();
+
+    [[nodiscard]] int arrayCount() const {
+        return _arrays.size();
+    }
+
+    [[nodiscard]] Sizei arraySize(int array) const {
+        return _arrays[array].size;
+    }
+
+    /**
+     * @param array                     Array index.
+     * @return                          Number of layers that need to be allocated for the provided array.
+     */
+    [[nodiscard]] int layerCount(int array) const {
+        return _arrays[array].layers.size();
+    }
+
+    /**
+     * @param array                     Array index.
+     * @return                          Texture names by layer.
+     */
+    [[nodiscard]] const std::vector<std::string> &layers(int array) const {
+        return _arrays[array].layers;
+    }
+
+    [[nodiscard]] int maxArrays() const {
+        return _maxArrays;
+    }
+
+    [[nodiscard]] int maxLayers() const {
+        return _maxLayers;
+    }
+
+ private:
+    struct Array {
+        Sizei size;
+        std::vector<std::string> layers;
+    };
+
+    int findArray(Sizei size) const;
+
+ private:
+    int _maxArrays = 0;
+    int _maxLayers = 0;
+    std::vector<Array> _arrays;
+    std::unordered_map<std::string, TextureArraySlot> _slotByName;
+};
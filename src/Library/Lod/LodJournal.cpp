@@ -0,0 +1,339 @@
+#include "LodJournal.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <filesystem>
+#include <utility>
+
+#include "Library/Binary/BinarySerialization.h"
+
+#include "Utility/Streams/FileOutputStream.h"
+#include "Utility/Streams/TempFileOutputStream.h"
+#include "Utility/Exception.h"
+#include "Utility/String.h"
+
+#include "LodReader.h"
+#include "LodWriter.h"
+
+// Bump this when changing the file format.
+static constexpr uint32_t JOURNAL_VERSION = 1;
+
+static constexpr std::array<char, 8> JOURNAL_HEADER_SIGNATURE = {{'O', 'E', 'J', 'O', 'U', 'R', 'N', 'L'}};
+static constexpr std::array<char, 8> JOURNAL_TRAILER_SIGNATURE = {{'O', 'E', 'J', 'I', 'N', 'D', 'E', 'X'}};
+
+// Journal is compacted once the garbage in it outgrows both the live data and this limit.
+static constexpr size_t JOURNAL_MIN_GARBAGE_SIZE = 1024 * 1024;
+
+struct LodJournalHeader {
+    std::array<char, 8> signature;
+    uint32_t version;
+    uint32_t reserved;
+};
+static_assert(sizeof(LodJournalHeader) == 16);
+MM_DECLARE_MEMCOPY_SERIALIZABLE(LodJournalHeader)
+
+struct LodJournalTrailer {
+    uint64_t indexOffset;
+    uint64_t indexSize;
+    uint64_t indexHash; // FNV-1a hash of the index data, used to detect partially written commits.
+    std::array<char, 8> signature;
+};
+static_assert(sizeof(LodJournalTrailer) == 32);
+MM_DECLARE_MEMCOPY_SERIALIZABLE(LodJournalTrailer)
+
+static uint64_t hashIndex(const Blob &data) {
+    // FNV-1a.
+    uint64_t result = 14695981039346656037ull;
+    for (char c : data.string_view()) {
+        result ^= static_cast<unsigned char>(c);
+        result *= 1099511628211ull;
+    }
+    return result;
+}
+
+static void serialize(const LodJournalEntry &src, OutputStream *dst) {
+    serialize(src.name, dst);
+    serialize(static_cast<uint64_t>(src.offset), dst);
+    serialize(static_cast<uint64_t>(src.size), dst);
+}
+
+static void deserialize(InputStream &src, LodJournalEntry *dst) {
+    uint64_t offset = 0;
+    uint64_t size = 0;
+    deserialize(src, &dst->name);
+    deserialize(src, &offset);
+    deserialize(src, &size);
+    dst->offset = offset;
+    dst->size = size;
+}
+
+static void serialize(const LodJournalIndex &src, OutputStream *dst) {
+    serialize(static_cast<int32_t>(src.info.version), dst);
+    serialize(src.info.description, dst);
+    serialize(src.info.rootName, dst);
+    serialize(src.entries, dst);
+}
+
+static void deserialize(InputStream &src, LodJournalIndex *dst) {
+    int32_t version = 0;
+    deserialize(src, &version);
+    dst->info.version = static_cast<LodVersion>(version);
+    deserialize(src, &dst->info.description);
+    deserialize(src, &dst->info.rootName);
+    deserialize(src, &dst->entries);
+}
+
+static bool operator==(const LodInfo &l, const LodInfo &r) {
+    return l.version == r.version && l.description == r.description && l.rootName == r.rootName;
+}
+
+/**
+ * @param data                          Journal contents.
+ * @param trailerOffset                 Offset of the trailer to check.
+ * @param[out] index                    Index that the trailer points to.
+ * @return                              Whether there is a valid trailer at `trailerOffset`.
+ */
+static bool tryParseCommit(const Blob &data, size_t trailerOffset, LodJournalIndex *index) {
+    LodJournalTrailer trailer;
+    std::memcpy(&trailer, static_cast<const char *>(data.data()) + trailerOffset, sizeof(trailer));
+    if (trailer.signature != JOURNAL_TRAILER_SIGNATURE)
+        return false;
+    if (trailer.indexOffset < sizeof(LodJournalHeader) || trailer.indexSize > trailerOffset || trailer.indexOffset != trailerOffset - trailer.indexSize)
+        return false;
+
+    Blob indexData = data.subBlob(trailer.indexOffset, trailer.indexSize);
+    if (hashIndex(indexData) != trailer.indexHash)
+        return false;
+
+    deserialize(indexData, index);
+    for (const LodJournalEntry &entry : index->entries)
+        if (entry.offset < sizeof(LodJournalHeader) || entry.offset > trailer.indexOffset || entry.size > trailer.indexOffset - entry.offset)
+            return false;
+    return true;
+}
+
+static void writeIndex(const LodJournalIndex &index, size_t indexOffset, OutputStream *dst) {
+    Blob indexData = toBlob(index);
+
+    LodJournalTrailer trailer;
+    trailer.indexOffset = indexOffset;
+    trailer.indexSize = indexData.size();
+    trailer.indexHash = hashIndex(indexData);
+    trailer.signature = JOURNAL_TRAILER_SIGNATURE;
+
+    dst->write(indexData.data(), indexData.size());
+    serialize(trailer, dst);
+}
+
+bool isLodJournal(const Blob &data) {
+    return data.size() >= sizeof(LodJournalHeader) && std::memcmp(data.data(), JOURNAL_HEADER_SIGNATURE.data(), JOURNAL_HEADER_SIGNATURE.size()) == 0;
+}
+
+LodJournalIndex parseLodJournal(const Blob &data, std::string_view path) {
+    if (!isLodJournal(data))
+        throw Exception("File '{}' is not a valid LOD journal: invalid signature", path);
+
+    LodJournalHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.version != JOURNAL_VERSION)
+        throw Exception("File '{}' is not a valid LOD journal: unsupported version {}", path, header.version);
+
+    // Normally the last trailer is right at the end of the file. If it's not there, the last commit wasn't written
+    // out completely, and we look for the previous one.
+    std::string_view contents = data.string_view();
+    std::string_view signature(JOURNAL_TRAILER_SIGNATURE.data(), JOURNAL_TRAILER_SIGNATURE.size());
+    size_t signatureOffset = offsetof(LodJournalTrailer, signature);
+    size_t searchPos = std::string_view::npos;
+    while (true) {
+        size_t pos = contents.rfind(signature, searchPos);
+        if (pos == std::string_view::npos || pos < sizeof(LodJournalHeader) + signatureOffset)
+            throw Exception("File '{}' is not a valid LOD journal: no complete commits found", path);
+
+        LodJournalIndex result;
+        try {
+            if (tryParseCommit(data, pos - signatureOffset, &result))
+                return result;
+        } catch (const Exception &) {
+            // Index didn't deserialize, keep looking.
+        }
+
+        searchPos = pos - 1;
+    }
+}
+
+LodJournalWriter::LodJournalWriter() = default;
+
+LodJournalWriter::LodJournalWriter(std::string_view path, LodInfo info) {
+    open(path, std::move(info));
+}
+
+LodJournalWriter::~LodJournalWriter() {
+    close();
+}
+
+void LodJournalWriter::open(std::string_view path, LodInfo info) {
+    close();
+
+    _path = path;
+    _info = std::move(info);
+
+    if (!std::filesystem::exists(_path))
+        return;
+
+    try {
+        _base = Blob::fromFile(_path);
+        if (isLodJournal(_base)) {
+            LodJournalIndex index = parseLodJournal(_base, _path);
+            _baseIsJournal = true;
+            _baseInfo = std::move(index.info);
+            for (const LodJournalEntry &entry : index.entries)
+                _baseFiles.emplace(entry.name, _base.subBlob(entry.offset, entry.size));
+        } else if (_base) {
+            LodReader reader(Blob::share(_base), _path, LOD_ALLOW_DUPLICATES);
+            for (const std::string &name : reader.ls())
+                _baseFiles.emplace(name, reader.read(name));
+        }
+    } catch (const std::exception &) {
+        // Not a LOD, or a broken one. It will be overwritten.
+        _base = Blob();
+        _baseIsJournal = false;
+        _baseFiles.clear();
+    }
+}
+
+void LodJournalWriter::close() {
+    if (!isOpen())
+        return; // Double-closing is OK.
+
+    // Wait for the deferred entries, same as in `LodWriter::close`.
+    std::map<std::string, std::future<Blob>> pendingFiles = std::move(_pendingFiles);
+    _pendingFiles.clear();
+    for (auto &[name, data] : pendingFiles)
+        write(name, data.get());
+
+    size_t liveSize = 0;
+    for (const auto &[name, data] : _baseFiles)
+        if (!_files.contains(name))
+            liveSize += data.size();
+    size_t changedSize = 0;
+    for (const auto &[_, data] : _files)
+        changedSize += data.size();
+    liveSize += changedSize;
+
+    bool compact = !_baseIsJournal;
+    if (!compact) {
+        size_t garbageSize = _base.size() + changedSize - liveSize; // Includes the old indices.
+        compact = garbageSize > std::max(liveSize, JOURNAL_MIN_GARBAGE_SIZE);
+    }
+
+    if (compact) {
+        writeCompacted();
+    } else if (!_files.empty() || !(_info == _baseInfo)) {
+        writeCommit();
+    }
+
+    reset();
+}
+
+void LodJournalWriter::write(const std::string &filename, const Blob &data) {
+    write(filename, Blob::share(data));
+}
+
+void LodJournalWriter::write(const std::string &filename, Blob &&data) {
+    assert(isOpen());
+
+    std::string name = toLower(filename);
+    _pendingFiles.erase(name);
+    auto pos = _baseFiles.find(name);
+    if (pos != _baseFiles.end() && pos->second.string_view() == data.string_view()) {
+        _files.erase(name); // Same as what's already in the file.
+    } else {
+        _files.insert_or_assign(std::move(name), std::move(data));
+    }
+}
+
+void LodJournalWriter::write(const std::string &filename, std::future<Blob> data) {
+    assert(isOpen());
+    assert(data.valid());
+
+    std::string name = toLower(filename);
+    _files.erase(name);
+    _pendingFiles.insert_or_assign(std::move(name), std::move(data));
+}
+
+void LodJournalWriter::writeCompacted() {
+    std::map<std::string, Blob> files = std::move(_baseFiles);
+    for (auto &[name, data] : _files)
+        files.insert_or_assign(name, std::move(data));
+
+    TempFileOutputStream stream(_path);
+
+    LodJournalHeader header;
+    header.signature = JOURNAL_HEADER_SIGNATURE;
+    header.version = JOURNAL_VERSION;
+    header.reserved = 0;
+    serialize(header, &stream);
+
+    LodJournalIndex index;
+    index.info = _info;
+    size_t offset = sizeof(LodJournalHeader);
+    for (const auto &[name, data] : files) {
+        index.entries.push_back({name, offset, data.size()});
+        stream.write(data.string_view());
+        offset += data.size();
+    }
+    writeIndex(index, offset, &stream);
+
+    // Blobs might point into the file that we're about to overwrite, so they need to be released first.
+    files.clear();
+    reset();
+    stream.close();
+}
+
+void LodJournalWriter::writeCommit() {
+    LodJournalIndex index;
+    index.info = _info;
+    for (const auto &[name, data] : _baseFiles) {
+        if (_files.contains(name))
+            continue;
+        size_t offset = static_cast<const char *>(data.data()) - static_cast<const char *>(_base.data());
+        index.entries.push_back({name, offset, data.size()});
+    }
+
+    FileOutputStream stream(_path, FILE_OUTPUT_APPEND);
+    size_t offset = _base.size();
+    for (const auto &[name, data] : _files) {
+        index.entries.push_back({name, offset, data.size()});
+        stream.write(data.string_view());
+        offset += data.size();
+    }
+    std::ranges::sort(index.entries, {}, &LodJournalEntry::name);
+    writeIndex(index, offset, &stream);
+    stream.close();
+}
+
+void LodJournalWriter::reset() {
+    _path = {};
+    _info = {};
+    _files.clear();
+    _pendingFiles.clear();
+    _baseFiles.clear();
+    _baseInfo = {};
+    _baseIsJournal = false;
+    _base = Blob();
+}
+
+void exportLod(std::string_view srcPath, std::string_view dstPath) {
+    LodReader reader(srcPath, LOD_ALLOW_DUPLICATES);
+    LodWriter writer(dstPath, reader.info());
+    for (const std::string &name : reader.ls())
+        writer.write(name, reader.read(name));
+
+    // Reader needs to be closed first in case we're overwriting the source file, see LodWriter tests.
+    reader.close();
+    writer.close();
+}
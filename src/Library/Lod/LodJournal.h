@@ -0,0 +1,124 @@
+#pragma once
+
+#include <future>
+#include <string>
+#include <string_view>
+#include <map>
+#include <vector>
+
+#include "Utility/Memory/Blob.h"
+
+#include "LodInfo.h"
+
+/**
+ * Journaled LOD container, meant for save files that are rewritten often, but only change a little between writes.
+ *
+ * A journal starts with a fixed header, followed by a sequence of commits. Each commit consists of the data of the
+ * entries that were changed in it, an index of all the live entries in the file, and a trailer pointing to that index.
+ * Thus, writing a commit only costs as much as the changed entries plus the index, and reading a journal only requires
+ * looking at the last trailer. Entries that were overwritten by later commits become garbage, which is dropped when
+ * the journal is compacted, see `LodJournalWriter`.
+ *
+ * If the last commit was only partially written, the journal is read as of the last complete commit.
+ *
+ * Journals are read with `LodReader`, which detects the format automatically. Use `exportLod` to convert a journal
+ * into a vanilla LOD file.
+ */
+struct LodJournalEntry {
+    std::string name;
+    size_t offset = 0; // Offset of the entry data from the start of the file.
+    size_t size = 0;
+};
+
+struct LodJournalIndex {
+    LodInfo info;
+    std::vector<LodJournalEntry> entries;
+};
+
+/**
+ * @param data                          File contents.
+ * @return                              Whether the provided data looks like a LOD journal.
+ */
+[[nodiscard]] bool isLodJournal(const Blob &data);
+
+/**
+ * @param data                          Journal contents.
+ * @param path                          Journal path, for error reporting.
+ * @return                              Index of the last complete commit in the journal.
+ * @throws Exception                    If the provided data is not a valid journal.
+ */
+[[nodiscard]] LodJournalIndex parseLodJournal(const Blob &data, std::string_view path);
+
+class LodJournalWriter {
+ public:
+    LodJournalWriter();
+    LodJournalWriter(std::string_view path, LodInfo info);
+    ~LodJournalWriter();
+
+    /**
+     * Opens a journal for writing. The entries that are already in the file are kept unless overwritten.
+     *
+     * If the file is a regular LOD, its entries are kept too, and it's converted into a journal on close. If the file
+     * is neither a LOD nor a journal, it's overwritten.
+     *
+     * @param path                      Path to the journal.
+     * @param info                      LOD info to store in the journal.
+     */
+    void open(std::string_view path, LodInfo info);
+
+    /**
+     * Writes out a new commit with all the changed entries, or compacts the journal if there is too much garbage in
+     * it. Does nothing if nothing has changed.
+     *
+     * @throws Exception                On error.
+     */
+    void close();
+
+    [[nodiscard]] bool isOpen() const {
+        return !_path.empty();
+    }
+
+    /**
+     * Writes an entry into the journal. Writing an entry with the same contents as the one that's already in the file
+     * is a no-op.
+     *
+     * @param filename                  Name of the entry.
+     * @param data                      Entry contents.
+     */
+    void write(const std::string &filename, const Blob &data);
+    void write(const std::string &filename, Blob &&data);
+
+    /**
+     * Adds an entry whose contents are still being produced, e.g. compressed on a worker thread. The future is waited
+     * on in `close`.
+     *
+     * @param filename                  Name of the entry.
+     * @param data                      Future for the entry contents.
+     */
+    void write(const std::string &filename, std::future<Blob> data);
+
+ private:
+    void writeCompacted();
+    void writeCommit();
+    void reset();
+
+ private:
+    std::string _path;
+    LodInfo _info;
+    Blob _base; // Contents of the file as of `open`.
+    bool _baseIsJournal = false;
+    LodInfo _baseInfo;
+    std::map<std::string, Blob> _baseFiles; // Entries in `_base`, these point into `_base`.
+    std::map<std::string, Blob> _files; // Changed entries.
+    std::map<std::string, std::future<Blob>> _pendingFiles;
+};
+
+/**
+ * Converts a LOD journal (or a LOD) into a vanilla LOD file. It's OK for `srcPath` and `dstPath` to point to the same
+ * file.
+ *
+ * @param srcPath                       Path to the journal.
+ * @param dstPath                       Path to the LOD file to write.
+ * @throws Exception                    On error.
+ */
+void exportLod(std::string_view srcPath, std::string_view dstPath);
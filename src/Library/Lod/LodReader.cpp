@@ -13,6 +13,7 @@
 
 #include "LodSnapshots.h"
 #include "LodEnums.h"
+#include "LodJournal.h"
 
 static LodHeader parseHeader(InputStream &stream, std::string_view path, LodVersion *version) {
     LodHeader header;
@@ -86,6 +87,11 @@ void LodReader::open(std::string_view path, LodOpenFlags openFlags) {
 void LodReader::open(Blob blob, std::string_view path, LodOpenFlags openFlags) {
     close();
 
+    if (isLodJournal(blob)) {
+        openJournal(std::move(blob), path);
+        return;
+    }
+
     size_t expectedSize = sizeof(LodHeader_MM6) + sizeof(LodEntry_MM6); // Header + directory entry.
     if (blob.size() < expectedSize)
         throw Exception("File '{}' is not a valid LOD: expected file size at least {} bytes, got {} bytes", path, expectedSize, _lod.size());
@@ -125,6 +131,23 @@ void LodReader::open(Blob blob, std::string_view path, LodOpenFlags openFlags) {
     _files = std::move(files);
 }
 
+void LodReader::openJournal(Blob blob, std::string_view path) {
+    LodJournalIndex index = parseLodJournal(blob, path);
+
+    std::unordered_map<std::string, LodRegion> files;
+    for (const LodJournalEntry &entry : index.entries) {
+        LodRegion region;
+        region.offset = entry.offset;
+        region.size = entry.size;
+        files.emplace(toLower(entry.name), region);
+    }
+
+    _lod = std::move(blob);
+    _path = path;
+    _info = std::move(index.info);
+    _files = std::move(files);
+}
+
 void LodReader::close() {
     // Double-closing is OK.
     _lod = Blob();
@@ -17,6 +17,8 @@ class InputStream;
  * 
  * Given that we don't plan to expand the LOD format support, when resolving the files this class always looks
  * into the first available directory, which is consistent with the vanilla behaviour.
+ *
+ * LOD journals (see `LodJournalWriter`) are also supported, the format is detected automatically.
  */
 class LodReader final {
  public:
@@ -74,6 +76,9 @@ class LodReader final {
      */
     [[nodiscard]] const LodInfo &info() const;
 
+ private:
+    void openJournal(Blob blob, std::string_view path);
+
  private:
     struct LodRegion {
         size_t offset = 0;
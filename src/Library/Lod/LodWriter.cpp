@@ -45,6 +45,13 @@ void LodWriter::close() {
     if (!isOpen())
         return; // Double-closing is OK.
 
+    // Wait for the deferred entries. Note that if one of these throws, the remaining futures are dropped, so that
+    // calling `close` again won't wait on them again.
+    std::map<std::string, std::future<Blob>> pendingFiles = std::move(_pendingFiles);
+    _pendingFiles.clear();
+    for (auto &[name, data] : pendingFiles)
+        _files.insert_or_assign(name, data.get());
+
     // Write out LOD header.
     LodHeader header;
     header.signature = "LOD";
@@ -103,5 +110,16 @@ void LodWriter::write(const std::string &filename, const Blob &data) {
 void LodWriter::write(const std::string &filename, Blob &&data) {
     assert(isOpen());
 
-    _files.insert_or_assign(toLower(filename), std::move(data));
+    std::string name = toLower(filename);
+    _pendingFiles.erase(name);
+    _files.insert_or_assign(std::move(name), std::move(data));
+}
+
+void LodWriter::write(const std::string &filename, std::future<Blob> data) {
+    assert(isOpen());
+    assert(data.valid());
+
+    std::string name = toLower(filename);
+    _files.erase(name);
+    _pendingFiles.insert_or_assign(std::move(name), std::move(data));
 }
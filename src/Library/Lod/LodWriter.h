@@ -4,6 +4,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <future>
 
 #include "Utility/Streams/OutputStream.h"
 #include "Utility/Memory/Blob.h"
@@ -29,10 +30,20 @@ class LodWriter {
     void write(const std::string &filename, const Blob &data);
     void write(const std::string &filename, Blob &&data);
 
+    /**
+     * Adds a file entry whose contents are still being produced, e.g. compressed on a worker thread. The future is
+     * waited on in `close`.
+     *
+     * @param filename                  Name of the LOD file entry.
+     * @param data                      Future for the file contents.
+     */
+    void write(const std::string &filename, std::future<Blob> data);
+
  private:
     std::unique_ptr<OutputStream> _ownedStream;
     OutputStream *_stream = nullptr;
     std::string _path;
     LodInfo _info;
     std::map<std::string, Blob> _files; // Having this one sorted makes implementation simpler.
+    std::map<std::string, std::future<Blob>> _pendingFiles;
 };
@@ -0,0 +1,198 @@
+#include <filesystem>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Lod/LodJournal.h"
+#include "Library/Lod/LodReader.h"
+#include "Library/Lod/LodWriter.h"
+
+#include "Utility/Streams/FileOutputStream.h"
+
+static LodInfo makeTestInfo() {
+    LodInfo result;
+    result.version = LOD_VERSION_MM7;
+    result.description = "Test journal";
+    result.rootName = "chapter";
+    return result;
+}
+
+static void cleanup(const std::string &path) {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+UNIT_TEST(LodJournal, ReadWrite) {
+    std::string path = "tmp_journal.lod";
+    cleanup(path);
+
+    std::string file1 = "123";
+    std::string file2 = std::string(1000, 'a');
+
+    LodJournalWriter writer(path, makeTestInfo());
+    writer.write("1", Blob::view(file1));
+    writer.write("Two", Blob::view(file2));
+    writer.close();
+
+    LodReader reader(path);
+    EXPECT_EQ(reader.ls(), (std::vector<std::string>{"1", "two"}));
+    EXPECT_EQ(reader.info().version, LOD_VERSION_MM7);
+    EXPECT_EQ(reader.info().description, "Test journal");
+    EXPECT_EQ(reader.info().rootName, "chapter");
+    EXPECT_EQ(reader.read("1").string_view(), file1);
+    EXPECT_EQ(reader.read("two").string_view(), file2);
+    reader.close();
+
+    cleanup(path);
+}
+
+UNIT_TEST(LodJournal, AppendChangedOnly) {
+    std::string path = "tmp_journal.lod";
+    cleanup(path);
+
+    std::string big = std::string(100'000, 'b');
+    std::string small1 = "small1";
+    std::string small2 = "small2";
+
+    LodJournalWriter writer(path, makeTestInfo());
+    writer.write("big", Blob::view(big));
+    writer.write("small", Blob::view(small1));
+    writer.close();
+    size_t size0 = std::filesystem::file_size(path);
+
+    // Nothing changed => nothing written.
+    writer.open(path, makeTestInfo());
+    writer.write("big", Blob::view(big));
+    writer.write("small", Blob::view(small1));
+    writer.close();
+    EXPECT_EQ(std::filesystem::file_size(path), size0);
+
+    // Only the changed entry is appended.
+    writer.open(path, makeTestInfo());
+    writer.write("big", Blob::view(big));
+    writer.write("small", Blob::view(small2));
+    writer.close();
+    size_t size1 = std::filesystem::file_size(path);
+    EXPECT_GT(size1, size0);
+    EXPECT_LT(size1 - size0, 1000);
+
+    LodReader reader(path);
+    EXPECT_EQ(reader.ls(), (std::vector<std::string>{"big", "small"}));
+    EXPECT_EQ(reader.read("big").string_view(), big);
+    EXPECT_EQ(reader.read("small").string_view(), small2);
+    reader.close();
+
+    cleanup(path);
+}
+
+UNIT_TEST(LodJournal, DeferredWrite) {
+    std::string path = "tmp_journal.lod";
+    cleanup(path);
+
+    std::string file1 = "123";
+    std::string file2 = "456";
+
+    std::promise<Blob> promise;
+    LodJournalWriter writer(path, makeTestInfo());
+    writer.write("1", promise.get_future());
+    writer.write("2", Blob::view(file2));
+    promise.set_value(Blob::fromString(file1));
+    writer.close();
+
+    LodReader reader(path);
+    EXPECT_EQ(reader.ls(), (std::vector<std::string>{"1", "2"}));
+    EXPECT_EQ(reader.read("1").string_view(), file1);
+    EXPECT_EQ(reader.read("2").string_view(), file2);
+    reader.close();
+
+    cleanup(path);
+}
+
+UNIT_TEST(LodJournal, Compaction) {
+    std::string path = "tmp_journal.lod";
+    cleanup(path);
+
+    LodJournalWriter writer;
+    for (int i = 0; i < 20; i++) {
+        std::string data = std::string(500'000, static_cast<char>('a' + i));
+        writer.open(path, makeTestInfo());
+        writer.write("data", Blob::view(data));
+        writer.close();
+
+        // Garbage is allowed to outgrow live data only up to the min garbage size.
+        EXPECT_LT(std::filesystem::file_size(path), 2'000'000);
+
+        LodReader reader(path);
+        EXPECT_EQ(reader.read("data").string_view(), data);
+    }
+
+    cleanup(path);
+}
+
+UNIT_TEST(LodJournal, PartialCommit) {
+    std::string path = "tmp_journal.lod";
+    cleanup(path);
+
+    std::string file1 = "123";
+    LodJournalWriter writer(path, makeTestInfo());
+    writer.write("1", Blob::view(file1));
+    writer.close();
+
+    // Simulate a commit that was cut short.
+    FileOutputStream stream(path, FILE_OUTPUT_APPEND);
+    stream.write(std::string(100, 'x'));
+    stream.close();
+
+    LodReader reader(path);
+    EXPECT_EQ(reader.ls(), (std::vector<std::string>{"1"}));
+    EXPECT_EQ(reader.read("1").string_view(), file1);
+    reader.close();
+
+    // Next commit should still work.
+    std::string file2 = "456";
+    writer.open(path, makeTestInfo());
+    writer.write("2", Blob::view(file2));
+    writer.close();
+
+    reader.open(path);
+    EXPECT_EQ(reader.ls(), (std::vector<std::string>{"1", "2"}));
+    EXPECT_EQ(reader.read("1").string_view(), file1);
+    EXPECT_EQ(reader.read("2").string_view(), file2);
+    reader.close();
+
+    cleanup(path);
+}
+
+UNIT_TEST(LodJournal, ConvertAndExport) {
+    std::string path = "tmp_journal.lod";
+    cleanup(path);
+
+    std::string file1 = "123";
+    std::string file2 = "456";
+
+    LodWriter lodWriter(path, makeTestInfo());
+    lodWriter.write("1", Blob::view(file1));
+    lodWriter.close();
+    EXPECT_FALSE(isLodJournal(Blob::fromFile(path)));
+
+    // Regular LOD is converted into a journal.
+    LodJournalWriter writer(path, makeTestInfo());
+    writer.write("2", Blob::view(file2));
+    writer.close();
+    EXPECT_TRUE(isLodJournal(Blob::fromFile(path)));
+
+    // And back.
+    exportLod(path, path);
+    EXPECT_FALSE(isLodJournal(Blob::fromFile(path)));
+
+    LodReader reader(path);
+    EXPECT_EQ(reader.ls(), (std::vector<std::string>{"1", "2"}));
+    EXPECT_EQ(reader.info().description, "Test journal");
+    EXPECT_EQ(reader.read("1").string_view(), file1);
+    EXPECT_EQ(reader.read("2").string_view(), file2);
+    reader.close();
+
+    cleanup(path);
+}
@@ -1,4 +1,8 @@
 #include <filesystem>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "Testing/Unit/UnitTest.h"
 
@@ -90,3 +94,35 @@ UNIT_TEST(LodWriter, Overwrite) {
 
     cleanup();
 }
+
+UNIT_TEST(LodWriter, DeferredWrite) {
+    LodInfo info;
+    info.version = LOD_VERSION_MM7;
+    info.description = "Some LOD";
+    info.rootName = "data";
+
+    std::string file1 = "123";
+    std::string file2 = "deferred";
+
+    Blob lod;
+    BlobOutputStream stream(&lod);
+
+    std::promise<Blob> promise2;
+    std::promise<Blob> promise3;
+
+    LodWriter writer(&stream, "some.lod", info);
+    writer.write("1", Blob::view(file1));
+    writer.write("2", promise2.get_future());
+    writer.write("3", promise3.get_future());
+    writer.write("3", Blob::view(file1)); // Overrides the deferred entry.
+
+    promise2.set_value(Blob::view(file2));
+    writer.close();
+    stream.close();
+
+    LodReader reader(std::move(lod), "some.lod");
+    EXPECT_EQ(reader.ls(), (std::vector<std::string>{"1", "2", "3"}));
+    EXPECT_EQ(reader.read("1").string_view(), file1);
+    EXPECT_EQ(reader.read("2").string_view(), file2);
+    EXPECT_EQ(reader.read("3").string_view(), file1);
+}
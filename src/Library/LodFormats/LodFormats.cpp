@@ -13,6 +13,7 @@
 
 #include "Utility/Streams/MemoryInputStream.h"
 #include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Streams/OutputStream.h"
 #include "Utility/Memory/Blob.h"
 #include "Utility/String.h"
 #include "Utility/Exception.h"
@@ -104,8 +105,16 @@ LodFileFormat lod::magic(const Blob &blob, const std::string &fileName) {
     return LOD_FILE_RAW;
 }
 
-Blob lod::decodeCompressed(const Blob &blob) {
-    LodFileFormat format = magic(blob, {});
+/**
+ * @param blob                          `Blob` from a LOD file.
+ * @param[out] decompressedSize         Size of the uncompressed data, or zero if the returned payload is not
+ *                                      compressed.
+ * @return                              Payload of the provided LOD entry, sharing memory with `blob`.
+ */
+static Blob compressedPayload(const Blob &blob, size_t *decompressedSize) {
+    *decompressedSize = 0;
+
+    LodFileFormat format = lod::magic(blob, {});
     if (format == LOD_FILE_RAW)
         return Blob::share(blob); // Not compressed.
 
@@ -114,17 +123,14 @@ Blob lod::decodeCompressed(const Blob &blob) {
         LodCompressionHeader_MM6 header;
         deserialize(stream, &header);
 
-        Blob result;
+        *decompressedSize = header.decompressedSize;
         if (header.dataSize == blob.size()) {
             // Workaround for a bug in the original LOD writer, where header.dataSize was equal to LOD record size,
             // instead of the size of the data that followed.
-            result = stream.tail();
+            return stream.tail();
         } else {
-            result = stream.readBlobOrFail(header.dataSize);
+            return stream.readBlobOrFail(header.dataSize);
         }
-        if (header.decompressedSize)
-            result = zlib::uncompress(result, header.decompressedSize);
-        return result;
     }
 
     if (format == LodFileFormat::LOD_FILE_PSEUDO_IMAGE) {
@@ -132,15 +138,31 @@ Blob lod::decodeCompressed(const Blob &blob) {
         LodImageHeader_MM6 header;
         deserialize(stream, &header);
 
-        Blob result = stream.readBlobOrFail(header.dataSize);
-        if (header.decompressedSize)
-            result = zlib::uncompress(result, header.decompressedSize);
-        return result;
+        *decompressedSize = header.decompressedSize;
+        return stream.readBlobOrFail(header.dataSize);
     }
 
     throw Exception("Cannot uncompress LOD entry of type '{}', operation is not supported", toString(format));
 }
 
+Blob lod::decodeCompressed(const Blob &blob) {
+    size_t decompressedSize = 0;
+    Blob result = compressedPayload(blob, &decompressedSize);
+    if (decompressedSize)
+        result = zlib::uncompress(result, decompressedSize);
+    return result;
+}
+
+void lod::decodeCompressed(const Blob &blob, OutputStream *dst) {
+    size_t decompressedSize = 0;
+    Blob payload = compressedPayload(blob, &decompressedSize);
+    if (decompressedSize) {
+        zlib::uncompressToStream(payload, dst);
+    } else {
+        dst->write(payload.data(), payload.size());
+    }
+}
+
 Blob lod::encodeCompressed(const Blob &blob) {
     Blob compressed = zlib::compress(blob);
 
@@ -8,6 +8,7 @@
 #include "LodFormatEnums.h"
 
 class Blob;
+class OutputStream;
 
 struct LodSprite {
     GrayscaleImage image;
@@ -37,6 +38,16 @@ LodFileFormat magic(const Blob &blob, const std::string &fileName);
  */
 Blob decodeCompressed(const Blob &blob);
 
+/**
+ * Same as `decodeCompressed` above, but writes the uncompressed data into the provided output stream chunk by chunk,
+ * without ever holding all of it in memory.
+ *
+ * @param blob                          `Blob` from a LOD file.
+ * @param dst                           Output stream to write uncompressed data into.
+ * @throw Exception                     If the provided `Blob` is of unsupported type, or on decompression error.
+ */
+void decodeCompressed(const Blob &blob, OutputStream *dst);
+
 /**
  * This function compresses the provided `Blob` into the `LOD_FILE_COMPRESSED` format.
  *
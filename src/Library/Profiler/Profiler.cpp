@@ -0,0 +1,194 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "Utility/Streams/OutputStream.h"
+#include "Utility/Format.h"
+
+namespace {
+
+struct ProfilerEvent {
+    const char *name = nullptr;
+    int64_t startNs = 0;
+    int64_t endNs = 0;
+};
+
+struct ProfilerThreadState {
+    explicit ProfilerThreadState(int threadId) : threadId(threadId), events(Profiler::THREAD_BUFFER_CAPACITY) {}
+
+    int threadId = 0;
+    std::vector<ProfilerEvent> events; // Ring buffer, next event goes into `events[size % THREAD_BUFFER_CAPACITY]`.
+    std::atomic<size_t> size = 0; // Total number of events ever recorded on this thread.
+
+    // Frame statistics, only accessed from the owning thread.
+    size_t frameStart = 0; // Value of `size` at the start of the current frame.
+    int64_t periodStartNs = -1;
+    int periodFrames = 0;
+    std::vector<ProfilerZoneStats> periodStats; // Totals over the current period.
+    std::vector<ProfilerZoneStats> publishedStats; // Per-frame averages over the previous period.
+};
+
+} // namespace
+
+static constexpr int64_t STATS_PERIOD_NS = 1'000'000'000;
+
+std::atomic<bool> Profiler::_enabled = false;
+
+static std::mutex globalThreadsMutex;
+static std::vector<std::unique_ptr<ProfilerThreadState>> globalThreads; // Never shrinks, thread states outlive threads.
+static thread_local ProfilerThreadState *threadState = nullptr;
+
+static ProfilerThreadState *currentThreadState() {
+    if (!threadState) {
+        std::lock_guard lock(globalThreadsMutex);
+        threadState = globalThreads.emplace_back(std::make_unique<ProfilerThreadState>(globalThreads.size())).get();
+    }
+    return threadState;
+}
+
+/**
+ * @param state                         Thread state.
+ * @param from                          Index of the first event to look at.
+ * @return                              Index of the first event in `[from, state->size)` that is still in the
+ *                                      ring buffer.
+ */
+static size_t firstAvailableEvent(const ProfilerThreadState &state, size_t from) {
+    size_t size = state.size.load(std::memory_order_acquire);
+    return std::max(from, size > Profiler::THREAD_BUFFER_CAPACITY ? size - Profiler::THREAD_BUFFER_CAPACITY : 0);
+}
+
+static ProfilerZoneStats &zoneStats(std::vector<ProfilerZoneStats> *stats, const char *name) {
+    for (ProfilerZoneStats &zone : *stats)
+        if (zone.name == name || std::string_view(zone.name) == name)
+            return zone;
+
+    ProfilerZoneStats &result = stats->emplace_back();
+    result.name = name;
+    return result;
+}
+
+static void appendJsonString(std::string *dst, std::string_view s) {
+    *dst += '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            *dst += '\\';
+            *dst += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            fmt::format_to(std::back_inserter(*dst), "\\u{:04x}", static_cast<int>(c));
+        } else {
+            *dst += c;
+        }
+    }
+    *dst += '"';
+}
+
+void Profiler::setEnabled(bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+int64_t Profiler::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::record(const char *name, int64_t startNs, int64_t endNs) {
+    ProfilerThreadState *state = currentThreadState();
+    size_t size = state->size.load(std::memory_order_relaxed);
+    state->events[size % THREAD_BUFFER_CAPACITY] = {name, startNs, endNs};
+    state->size.store(size + 1, std::memory_order_release);
+}
+
+void Profiler::markFrame() {
+    if (!isEnabled())
+        return;
+
+    ProfilerThreadState *state = currentThreadState();
+    size_t size = state->size.load(std::memory_order_relaxed);
+    for (size_t i = firstAvailableEvent(*state, state->frameStart); i < size; i++) {
+        const ProfilerEvent &event = state->events[i % THREAD_BUFFER_CAPACITY];
+        ProfilerZoneStats &stats = zoneStats(&state->periodStats, event.name);
+        stats.calls += 1;
+        stats.ms += (event.endNs - event.startNs) / 1'000'000.0;
+    }
+    state->frameStart = size;
+    state->periodFrames++;
+
+    int64_t nowNs = now();
+    if (state->periodStartNs < 0)
+        state->periodStartNs = nowNs;
+    if (nowNs - state->periodStartNs < STATS_PERIOD_NS)
+        return;
+
+    for (ProfilerZoneStats &stats : state->periodStats) {
+        stats.calls /= state->periodFrames;
+        stats.ms /= state->periodFrames;
+    }
+    std::ranges::sort(state->periodStats, std::greater<>(), &ProfilerZoneStats::ms);
+
+    state->publishedStats = std::exchange(state->periodStats, {});
+    state->periodFrames = 0;
+    state->periodStartNs = nowNs;
+}
+
+std::vector<ProfilerZoneStats> Profiler::frameStats() {
+    if (!threadState)
+        return {};
+    return threadState->publishedStats;
+}
+
+void Profiler::writeChromeTrace(OutputStream *dst) {
+    std::lock_guard lock(globalThreadsMutex);
+
+    // Timestamps are written relative to the first recorded zone, otherwise they're unreadable in the viewers.
+    int64_t baseNs = std::numeric_limits<int64_t>::max();
+    for (const std::unique_ptr<ProfilerThreadState> &state : globalThreads) {
+        size_t size = state->size.load(std::memory_order_acquire);
+        for (size_t i = firstAvailableEvent(*state, 0); i < size; i++)
+            baseNs = std::min(baseNs, state->events[i % THREAD_BUFFER_CAPACITY].startNs);
+    }
+
+    std::string buffer = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    const char *separator = "\n";
+    for (const std::unique_ptr<ProfilerThreadState> &state : globalThreads) {
+        fmt::format_to(std::back_inserter(buffer),
+                       "{}{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"Thread {}\"}}}}",
+                       separator, state->threadId, state->threadId);
+        separator = ",\n";
+
+        size_t size = state->size.load(std::memory_order_acquire);
+        for (size_t i = firstAvailableEvent(*state, 0); i < size; i++) {
+            const ProfilerEvent &event = state->events[i % THREAD_BUFFER_CAPACITY];
+            buffer += ",\n{\"name\":";
+            appendJsonString(&buffer, event.name);
+            fmt::format_to(std::back_inserter(buffer), ",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                           state->threadId, (event.startNs - baseNs) / 1000.0, (event.endNs - event.startNs) / 1000.0);
+
+            if (buffer.size() >= 64 * 1024) {
+                dst->write(buffer);
+                buffer.clear();
+            }
+        }
+    }
+    buffer += "\n]}\n";
+    dst->write(buffer);
+}
+
+void Profiler::clear() {
+    std::lock_guard lock(globalThreadsMutex);
+    for (const std::unique_ptr<ProfilerThreadState> &state : globalThreads) {
+        state->size.store(0, std::memory_order_relaxed);
+        state->frameStart = 0;
+        state->periodStartNs = -1;
+        state->periodFrames = 0;
+        state->periodStats.clear();
+        state->publishedStats.clear();
+    }
+}
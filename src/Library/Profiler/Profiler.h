@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Utility/Preprocessor.h"
+
+class OutputStream;
+
+struct ProfilerZoneStats {
+    const char *name = nullptr; // Zone name, as passed to `MM_PROFILE_ZONE`.
+    double calls = 0; // Average number of times the zone was entered per frame.
+    double ms = 0; // Average time spent in the zone per frame, in milliseconds.
+};
+
+/**
+ * Lightweight CPU profiler.
+ *
+ * Scopes are instrumented with `MM_PROFILE_ZONE`. When profiling is disabled, the cost of a zone is a single relaxed
+ * atomic load. When it's enabled, each zone is recorded into a thread-local ring buffer that holds the last
+ * `THREAD_BUFFER_CAPACITY` zones, so threads never contend with each other.
+ *
+ * Recorded zones can then be exported in Chrome trace event format with `writeChromeTrace`, and opened in
+ * `chrome://tracing` or Perfetto. Per-frame timings for the overlay are available via `frameStats`.
+ */
+class Profiler {
+ public:
+    static constexpr size_t THREAD_BUFFER_CAPACITY = 256 * 1024;
+
+    [[nodiscard]] static bool isEnabled() {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    static void setEnabled(bool enabled);
+
+    /**
+     * @return                          Current profiler time, in nanoseconds.
+     */
+    [[nodiscard]] static int64_t now();
+
+    /**
+     * Records a zone into the calling thread's ring buffer. This is what `MM_PROFILE_ZONE` calls on scope exit.
+     *
+     * @param name                      Zone name. Must be a string literal, or otherwise outlive the profiler.
+     * @param startNs                   Zone start time, as returned by `now`.
+     * @param endNs                     Zone end time, as returned by `now`.
+     */
+    static void record(const char *name, int64_t startNs, int64_t endNs);
+
+    /**
+     * Marks the end of a frame on the calling thread. Zones recorded on this thread since the last call are added to
+     * the frame statistics, which are averaged & published once a second.
+     */
+    static void markFrame();
+
+    /**
+     * @return                          Per-zone statistics for the calling thread, averaged over the frames of the
+     *                                  last full second, sorted by time spent in the zone. Nested zones are counted
+     *                                  separately, so the times don't add up.
+     */
+    [[nodiscard]] static std::vector<ProfilerZoneStats> frameStats();
+
+    /**
+     * Writes out all the zones that are still in the ring buffers as a Chrome trace event JSON.
+     *
+     * Zones that are recorded concurrently with this call might not make it into the output, so it's best to call it
+     * with profiling disabled.
+     *
+     * @param dst                       Output stream to write to.
+     * @throws Exception                On write error.
+     */
+    static void writeChromeTrace(OutputStream *dst);
+
+    /**
+     * Drops all recorded zones and frame statistics. Must be called with profiling disabled.
+     */
+    static void clear();
+
+ private:
+    static std::atomic<bool> _enabled;
+};
+
+/**
+ * RAII zone, use `MM_PROFILE_ZONE` instead of using this class directly.
+ */
+class ProfilerZone {
+ public:
+    explicit ProfilerZone(const char *name) : _name(name) {
+        if (Profiler::isEnabled())
+            _startNs = Profiler::now();
+    }
+
+    ~ProfilerZone() {
+        if (_startNs >= 0)
+            Profiler::record(_name, _startNs, Profiler::now());
+    }
+
+    ProfilerZone(const ProfilerZone &) = delete;
+    ProfilerZone &operator=(const ProfilerZone &) = delete;
+
+ private:
+    const char *_name = nullptr;
+    int64_t _startNs = -1;
+};
+
+/**
+ * Profiles the rest of the enclosing scope.
+ *
+ * @param NAME                          Zone name, must be a string literal.
+ */
+#define MM_PROFILE_ZONE(NAME) ProfilerZone MM_PP_CAT(profilerZone, __LINE__)(NAME)
@@ -0,0 +1,71 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Json/Json.h"
+#include "Library/Profiler/Profiler.h"
+
+#include "Utility/Streams/StringOutputStream.h"
+
+static Json chromeTrace() {
+    std::string result;
+    StringOutputStream stream(&result);
+    Profiler::writeChromeTrace(&stream);
+    stream.close();
+    return Json::parse(result);
+}
+
+static std::vector<Json> zones(const Json &trace) {
+    std::vector<Json> result;
+    for (const Json &event : trace["traceEvents"])
+        if (event["ph"] == "X")
+            result.push_back(event);
+    return result;
+}
+
+UNIT_TEST(Profiler, Disabled) {
+    Profiler::setEnabled(false);
+    Profiler::clear();
+
+    {
+        MM_PROFILE_ZONE("Disabled");
+    }
+
+    EXPECT_TRUE(zones(chromeTrace()).empty());
+}
+
+UNIT_TEST(Profiler, ChromeTrace) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    {
+        MM_PROFILE_ZONE("Outer");
+        MM_PROFILE_ZONE("Inner \"quoted\"");
+    }
+    Profiler::setEnabled(false);
+
+    std::vector<Json> events = zones(chromeTrace());
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0]["name"], "Inner \"quoted\""); // Inner zone is exited first.
+    EXPECT_EQ(events[1]["name"], "Outer");
+    EXPECT_EQ(events[0]["tid"], events[1]["tid"]);
+    EXPECT_GE(events[0]["ts"].get<double>(), events[1]["ts"].get<double>());
+    EXPECT_LE(events[0]["dur"].get<double>(), events[1]["dur"].get<double>());
+}
+
+UNIT_TEST(Profiler, Threads) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    {
+        MM_PROFILE_ZONE("Main");
+    }
+    std::thread([] {
+        MM_PROFILE_ZONE("Worker");
+    }).join();
+    Profiler::setEnabled(false);
+
+    std::vector<Json> events = zones(chromeTrace());
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0]["tid"], events[1]["tid"]);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <memory>
 #include <random>
 
 #include "RandomEngine.h"
@@ -32,6 +33,10 @@ class MersenneTwisterRandomEngine: public RandomEngine {
         }
     }
 
+    virtual std::unique_ptr<RandomEngine> clone() const override {
+        return std::make_unique<MersenneTwisterRandomEngine>(*this);
+    }
+
  private:
     std::mt19937 _base;
 };
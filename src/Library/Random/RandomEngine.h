@@ -42,6 +42,12 @@ class RandomEngine {
      */
     virtual void seed(int seed) = 0;
 
+    /**
+     * @return                          Copy of this random engine, in the same state. Calling the same methods on the
+     *                                  copy and on this engine will produce the same results.
+     */
+    [[nodiscard]] virtual std::unique_ptr<RandomEngine> clone() const = 0;
+
     /**
      * @param min                       Minimal result value.
      * @param max                       Maximal result value. Must be greater or equal to `min`.
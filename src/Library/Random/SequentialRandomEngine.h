@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <memory>
 
 #include "RandomEngine.h"
 
@@ -26,6 +27,10 @@ class SequentialRandomEngine : public RandomEngine {
         _state = seed;
     }
 
+    virtual std::unique_ptr<RandomEngine> clone() const override {
+        return std::make_unique<SequentialRandomEngine>(*this);
+    }
+
  private:
     unsigned _state = 0; // Using unsigned here so that it wraps around safely.
 };
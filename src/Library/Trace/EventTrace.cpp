@@ -9,9 +9,11 @@
 
 #include "Io/Key.h" // TODO(captainurist): doesn't belong here
 
-#include "Utility/Streams/FileInputStream.h"
 #include "Utility/Streams/FileOutputStream.h"
+#include "Utility/Streams/MemoryInputStream.h"
+#include "Utility/Memory/Blob.h"
 
+#include "EventTraceBinary.h"
 #include "PaintEvent.h"
 
 MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(Pointi, (
@@ -210,9 +212,14 @@ MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(EventTrace, (
     (events, "trace")
 ))
 
-void EventTrace::saveToFile(std::string_view path, const EventTrace &trace) {
+void EventTrace::saveToFile(std::string_view path, const EventTrace &trace, EventTraceFormat format) {
     FileOutputStream output(path);
 
+    if (format == EVENT_TRACE_BINARY) {
+        serialize(trace, &output);
+        return;
+    }
+
     // TODO(captainurist): well, nlohmann json is retarded in that it chokes if we throw exceptions inside
     // to_json calls for individual elements. Fix upstream?
     // Note: there is an example in tests to reproduce.
@@ -222,11 +229,16 @@ void EventTrace::saveToFile(std::string_view path, const EventTrace &trace) {
 }
 
 EventTrace EventTrace::loadFromFile(std::string_view path, PlatformWindow *window) {
-    FileInputStream input(path);
-    Json json = Json::parse(input.handle());
+    Blob data = Blob::fromFile(path);
 
     EventTrace result;
-    from_json(json, result);
+    if (detectFormat(data) == EVENT_TRACE_BINARY) {
+        MemoryInputStream input(data.data(), data.size());
+        deserialize(input, &result);
+    } else {
+        Json json = Json::parse(data.string_view());
+        from_json(json, result);
+    }
 
     for (std::unique_ptr<PlatformEvent> &event : result.events) {
         dispatchByEventType(event->type, [&]<class T>(T *) {
@@ -239,6 +251,10 @@ EventTrace EventTrace::loadFromFile(std::string_view path, PlatformWindow *windo
     return result;
 }
 
+EventTraceFormat EventTrace::detectFormat(const Blob &data) {
+    return isBinaryEventTrace(data) ? EVENT_TRACE_BINARY : EVENT_TRACE_JSON;
+}
+
 bool EventTrace::isTraceable(const PlatformEvent *event) {
     bool result = false;
     dispatchByEventType(event->type, [&](auto) { result = true; }); // Callback not invoked => not supported.
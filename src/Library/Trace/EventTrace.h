@@ -9,6 +9,10 @@
 #include "Library/Config/ConfigPatch.h"
 #include "Library/Geometry/Vec.h"
 
+#include "EventTraceEnums.h"
+
+class Blob;
+
 // TODO(captainurist): this should go to Core/, not Library/,
 
 struct EventTraceCharacterState {
@@ -42,9 +46,28 @@ struct EventTraceHeader {
 };
 
 struct EventTrace {
-    static void saveToFile(std::string_view path, const EventTrace &trace);
+    /**
+     * @param path                      Path to save the trace to.
+     * @param trace                     Trace to save.
+     * @param format                    Format to use.
+     */
+    static void saveToFile(std::string_view path, const EventTrace &trace, EventTraceFormat format = EVENT_TRACE_JSON);
+
+    /**
+     * Loads a trace from file. File format is detected automatically.
+     *
+     * @param path                      Path to the trace file.
+     * @param window                    Window to use for all the window events in the trace.
+     * @return                          Loaded trace.
+     */
     static EventTrace loadFromFile(std::string_view path, PlatformWindow *window);
 
+    /**
+     * @param data                      Contents of a trace file.
+     * @return                          Format of the trace file.
+     */
+    static EventTraceFormat detectFormat(const Blob &data);
+
     static bool isTraceable(const PlatformEvent *event);
     static std::unique_ptr<PlatformEvent> cloneEvent(const PlatformEvent *event);
 
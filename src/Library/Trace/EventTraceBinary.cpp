@@ -0,0 +1,284 @@
+#include "EventTraceBinary.h"
+
+#include <cstring>
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Library/Binary/BinarySerialization.h"
+
+#include "Utility/Workaround/ToUnderlying.h"
+#include "Utility/Exception.h"
+
+#include "EventTrace.h"
+#include "PaintEvent.h"
+
+// Bump this when changing the file format.
+static constexpr uint32_t TRACE_VERSION = 1;
+
+static constexpr std::array<char, 8> TRACE_SIGNATURE = {{'O', 'E', 'T', 'R', 'A', 'C', 'E', '\0'}};
+
+/**
+ * State that's carried over from one event to the next, deltas are calculated against it.
+ */
+struct EventTraceDeltaState {
+    int64_t tickCount = 0;
+    Pointi mousePos;
+};
+
+static void serializeVarint(int64_t value, OutputStream *dst) {
+    uint64_t bits = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); // Zigzag.
+    std::array<uint8_t, 10> buffer;
+    size_t size = 0;
+    do {
+        buffer[size++] = (bits & 0x7F) | (bits > 0x7F ? 0x80 : 0);
+        bits >>= 7;
+    } while (bits);
+    dst->write(buffer.data(), size);
+}
+
+static int64_t deserializeVarint(InputStream &src) {
+    uint64_t bits = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte = 0;
+        deserialize(src, &byte);
+        bits |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return static_cast<int64_t>(bits >> 1) ^ -static_cast<int64_t>(bits & 1);
+    }
+    throw Exception("Invalid varint in binary event trace");
+}
+
+static void serialize(const ConfigPatchEntry &src, OutputStream *dst) {
+    serialize(src.section, dst);
+    serialize(src.key, dst);
+    serialize(src.value, dst);
+}
+
+static void deserialize(InputStream &src, ConfigPatchEntry *dst) {
+    deserialize(src, &dst->section);
+    deserialize(src, &dst->key);
+    deserialize(src, &dst->value);
+}
+
+static void serialize(const EventTraceCharacterState &src, OutputStream *dst) {
+    serializeVarint(src.hp, dst);
+    serializeVarint(src.mp, dst);
+}
+
+static void deserialize(InputStream &src, EventTraceCharacterState *dst) {
+    dst->hp = deserializeVarint(src);
+    dst->mp = deserializeVarint(src);
+}
+
+static void serialize(const EventTraceGameState &src, OutputStream *dst) {
+    serialize(src.locationName, dst);
+    serializeVarint(src.partyPosition.x, dst);
+    serializeVarint(src.partyPosition.y, dst);
+    serializeVarint(src.partyPosition.z, dst);
+    serialize(src.characters, dst);
+}
+
+static void deserialize(InputStream &src, EventTraceGameState *dst) {
+    deserialize(src, &dst->locationName);
+    dst->partyPosition.x = deserializeVarint(src);
+    dst->partyPosition.y = deserializeVarint(src);
+    dst->partyPosition.z = deserializeVarint(src);
+    deserialize(src, &dst->characters);
+}
+
+static void serialize(const EventTraceHeader &src, OutputStream *dst) {
+    serializeVarint(src.saveFileSize, dst);
+    serialize(src.config.entries(), dst);
+    serialize(src.startState, dst);
+    serialize(src.endState, dst);
+    serialize(static_cast<int32_t>(src.afterLoadRandomState), dst);
+}
+
+static void deserialize(InputStream &src, EventTraceHeader *dst) {
+    dst->saveFileSize = deserializeVarint(src);
+    std::vector<ConfigPatchEntry> entries;
+    deserialize(src, &entries);
+    dst->config = ConfigPatch::fromEntries(std::move(entries));
+    deserialize(src, &dst->startState);
+    deserialize(src, &dst->endState);
+    int32_t afterLoadRandomState = 0;
+    deserialize(src, &afterLoadRandomState);
+    dst->afterLoadRandomState = afterLoadRandomState;
+}
+
+static void serializeEvent(const PlatformEvent *src, EventTraceDeltaState *state, OutputStream *dst) {
+    serialize(static_cast<uint8_t>(src->type), dst);
+
+    switch (src->type) {
+    case EVENT_KEY_PRESS:
+    case EVENT_KEY_RELEASE: {
+        const PlatformKeyEvent *event = static_cast<const PlatformKeyEvent *>(src);
+        serializeVarint(std::to_underlying(event->key), dst);
+        serializeVarint(static_cast<uint32_t>(event->mods), dst);
+        serialize(static_cast<uint8_t>(event->isAutoRepeat), dst);
+        break;
+    }
+    case EVENT_MOUSE_BUTTON_PRESS:
+    case EVENT_MOUSE_BUTTON_RELEASE:
+    case EVENT_MOUSE_MOVE: {
+        const PlatformMouseEvent *event = static_cast<const PlatformMouseEvent *>(src);
+        serialize(static_cast<uint8_t>(std::to_underlying(event->button)), dst);
+        serialize(static_cast<uint8_t>(static_cast<int>(event->buttons)), dst);
+        serializeVarint(event->pos.x - state->mousePos.x, dst);
+        serializeVarint(event->pos.y - state->mousePos.y, dst);
+        serialize(static_cast<uint8_t>(event->isDoubleClick), dst);
+        state->mousePos = event->pos;
+        break;
+    }
+    case EVENT_MOUSE_WHEEL: {
+        const PlatformWheelEvent *event = static_cast<const PlatformWheelEvent *>(src);
+        serializeVarint(event->angleDelta.x, dst);
+        serializeVarint(event->angleDelta.y, dst);
+        break;
+    }
+    case EVENT_WINDOW_MOVE: {
+        const PlatformMoveEvent *event = static_cast<const PlatformMoveEvent *>(src);
+        serializeVarint(event->pos.x, dst);
+        serializeVarint(event->pos.y, dst);
+        break;
+    }
+    case EVENT_WINDOW_RESIZE: {
+        const PlatformResizeEvent *event = static_cast<const PlatformResizeEvent *>(src);
+        serializeVarint(event->size.w, dst);
+        serializeVarint(event->size.h, dst);
+        break;
+    }
+    case EVENT_WINDOW_ACTIVATE:
+    case EVENT_WINDOW_DEACTIVATE:
+    case EVENT_WINDOW_CLOSE_REQUEST:
+        break;
+    case EVENT_PAINT: {
+        const PaintEvent *event = static_cast<const PaintEvent *>(src);
+        serializeVarint(event->tickCount - state->tickCount, dst);
+        serialize(static_cast<int32_t>(event->randomState), dst);
+        state->tickCount = event->tickCount;
+        break;
+    }
+    default:
+        throw Exception("Event of type {} is not traceable", std::to_underlying(src->type));
+    }
+}
+
+static std::unique_ptr<PlatformEvent> deserializeEvent(InputStream &src, EventTraceDeltaState *state) {
+    uint8_t type = 0;
+    deserialize(src, &type);
+
+    std::unique_ptr<PlatformEvent> result;
+    switch (static_cast<PlatformEventType>(type)) {
+    case EVENT_KEY_PRESS:
+    case EVENT_KEY_RELEASE: {
+        std::unique_ptr<PlatformKeyEvent> event = std::make_unique<PlatformKeyEvent>();
+        uint8_t isAutoRepeat = 0;
+        event->key = static_cast<PlatformKey>(deserializeVarint(src));
+        event->mods = PlatformModifiers(static_cast<uint32_t>(deserializeVarint(src)));
+        deserialize(src, &isAutoRepeat);
+        event->isAutoRepeat = isAutoRepeat;
+        result = std::move(event);
+        break;
+    }
+    case EVENT_MOUSE_BUTTON_PRESS:
+    case EVENT_MOUSE_BUTTON_RELEASE:
+    case EVENT_MOUSE_MOVE: {
+        std::unique_ptr<PlatformMouseEvent> event = std::make_unique<PlatformMouseEvent>();
+        uint8_t button = 0, buttons = 0, isDoubleClick = 0;
+        deserialize(src, &button);
+        deserialize(src, &buttons);
+        event->button = static_cast<PlatformMouseButton>(button);
+        event->buttons = PlatformMouseButtons(static_cast<int>(buttons));
+        event->pos.x = state->mousePos.x + deserializeVarint(src);
+        event->pos.y = state->mousePos.y + deserializeVarint(src);
+        deserialize(src, &isDoubleClick);
+        event->isDoubleClick = isDoubleClick;
+        state->mousePos = event->pos;
+        result = std::move(event);
+        break;
+    }
+    case EVENT_MOUSE_WHEEL: {
+        std::unique_ptr<PlatformWheelEvent> event = std::make_unique<PlatformWheelEvent>();
+        event->angleDelta.x = deserializeVarint(src);
+        event->angleDelta.y = deserializeVarint(src);
+        result = std::move(event);
+        break;
+    }
+    case EVENT_WINDOW_MOVE: {
+        std::unique_ptr<PlatformMoveEvent> event = std::make_unique<PlatformMoveEvent>();
+        event->pos.x = deserializeVarint(src);
+        event->pos.y = deserializeVarint(src);
+        result = std::move(event);
+        break;
+    }
+    case EVENT_WINDOW_RESIZE: {
+        std::unique_ptr<PlatformResizeEvent> event = std::make_unique<PlatformResizeEvent>();
+        event->size.w = deserializeVarint(src);
+        event->size.h = deserializeVarint(src);
+        result = std::move(event);
+        break;
+    }
+    case EVENT_WINDOW_ACTIVATE:
+    case EVENT_WINDOW_DEACTIVATE:
+    case EVENT_WINDOW_CLOSE_REQUEST:
+        result = std::make_unique<PlatformWindowEvent>();
+        break;
+    case EVENT_PAINT: {
+        std::unique_ptr<PaintEvent> event = std::make_unique<PaintEvent>();
+        int32_t randomState = 0;
+        event->tickCount = state->tickCount + deserializeVarint(src);
+        deserialize(src, &randomState);
+        event->randomState = randomState;
+        state->tickCount = event->tickCount;
+        result = std::move(event);
+        break;
+    }
+    default:
+        throw Exception("Invalid event type {} in binary event trace", type);
+    }
+
+    result->type = static_cast<PlatformEventType>(type);
+    return result;
+}
+
+void serialize(const EventTrace &src, OutputStream *dst) {
+    serialize(TRACE_SIGNATURE, dst);
+    serialize(TRACE_VERSION, dst);
+    serialize(src.header, dst);
+
+    EventTraceDeltaState state;
+    serialize(static_cast<uint32_t>(src.events.size()), dst);
+    for (const std::unique_ptr<PlatformEvent> &event : src.events)
+        serializeEvent(event.get(), &state, dst);
+}
+
+void deserialize(InputStream &src, EventTrace *dst) {
+    std::array<char, 8> signature;
+    uint32_t version = 0;
+    deserialize(src, &signature);
+    if (signature != TRACE_SIGNATURE)
+        throw Exception("Invalid binary event trace signature");
+    deserialize(src, &version);
+    if (version != TRACE_VERSION)
+        throw Exception("Unsupported binary event trace version {}", version);
+
+    EventTrace result;
+    deserialize(src, &result.header);
+
+    EventTraceDeltaState state;
+    uint32_t size = 0;
+    deserialize(src, &size);
+    result.events.reserve(size);
+    for (uint32_t i = 0; i < size; i++)
+        result.events.push_back(deserializeEvent(src, &state));
+
+    *dst = std::move(result);
+}
+
+bool isBinaryEventTrace(const Blob &data) {
+    return data.size() >= TRACE_SIGNATURE.size() && std::memcmp(data.data(), TRACE_SIGNATURE.data(), TRACE_SIGNATURE.size()) == 0;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+class Blob;
+class InputStream;
+class OutputStream;
+struct EventTrace;
+
+/**
+ * Binary encoding for event traces.
+ *
+ * Traces are dominated by paint events and mouse moves, so tick counts are stored as deltas from the previous paint
+ * event, mouse positions as deltas from the previous mouse event, and all the deltas are written as zigzag varints.
+ * A typical paint event thus takes 6 bytes, vs ~90 bytes in JSON.
+ *
+ * Window pointers are not stored, `EventTrace::loadFromFile` sets them after loading.
+ */
+void serialize(const EventTrace &src, OutputStream *dst);
+void deserialize(InputStream &src, EventTrace *dst);
+
+/**
+ * @param data                          File contents.
+ * @return                              Whether the provided data starts with a binary event trace signature.
+ */
+bool isBinaryEventTrace(const Blob &data);
@@ -0,0 +1,8 @@
+#include "EventTraceEnums.h"
+
+#include "Library/Serialization/EnumSerialization.h"
+
+MM_DEFINE_ENUM_SERIALIZATION_FUNCTIONS(EventTraceFormat, CASE_INSENSITIVE, {
+    {EVENT_TRACE_JSON, "json"},
+    {EVENT_TRACE_BINARY, "binary"},
+})
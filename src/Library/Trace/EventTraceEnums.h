@@ -0,0 +1,10 @@
+#pragma once
+
+#include "Library/Serialization/SerializationFwd.h"
+
+enum class EventTraceFormat {
+    EVENT_TRACE_JSON, // Human-readable & diffable, this is what's stored in the test data repo.
+    EVENT_TRACE_BINARY, // Compact binary encoding, see `EventTraceBinary.h`.
+};
+using enum EventTraceFormat;
+MM_DECLARE_SERIALIZATION_FUNCTIONS(EventTraceFormat)
@@ -0,0 +1,117 @@
+#include <memory>
+#include <utility>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Binary/BinarySerialization.h"
+#include "Library/Trace/EventTrace.h"
+#include "Library/Trace/EventTraceBinary.h"
+#include "Library/Trace/PaintEvent.h"
+
+static std::unique_ptr<PlatformEvent> makePaintEvent(int64_t tickCount, int randomState) {
+    std::unique_ptr<PaintEvent> result = std::make_unique<PaintEvent>();
+    result->type = EVENT_PAINT;
+    result->tickCount = tickCount;
+    result->randomState = randomState;
+    return result;
+}
+
+static std::unique_ptr<PlatformEvent> makeMouseEvent(PlatformEventType type, PlatformMouseButton button, Pointi pos) {
+    std::unique_ptr<PlatformMouseEvent> result = std::make_unique<PlatformMouseEvent>();
+    result->type = type;
+    result->button = button;
+    result->buttons = button;
+    result->pos = pos;
+    return result;
+}
+
+static EventTrace makeTestTrace() {
+    EventTrace result;
+    result.header.saveFileSize = 123456;
+    result.header.config = ConfigPatch::fromEntries({{"debug", "trace_frame_time_ms", "15"}});
+    result.header.startState.locationName = "out01.odm";
+    result.header.startState.partyPosition = Vec3i(-1000, 2000, 3);
+    result.header.startState.characters = {{100, 20}, {-5, 0}};
+    result.header.endState.locationName = "d01.blv";
+    result.header.afterLoadRandomState = -123;
+
+    std::unique_ptr<PlatformKeyEvent> keyEvent = std::make_unique<PlatformKeyEvent>();
+    keyEvent->type = EVENT_KEY_PRESS;
+    keyEvent->key = PlatformKey::KEY_RETURN;
+    keyEvent->mods = MOD_SHIFT | MOD_CTRL;
+    keyEvent->isAutoRepeat = true;
+
+    std::unique_ptr<PlatformResizeEvent> resizeEvent = std::make_unique<PlatformResizeEvent>();
+    resizeEvent->type = EVENT_WINDOW_RESIZE;
+    resizeEvent->size = Sizei(640, 480);
+
+    result.events.push_back(makePaintEvent(1000, 42));
+    result.events.push_back(std::move(keyEvent));
+    result.events.push_back(makeMouseEvent(EVENT_MOUSE_MOVE, BUTTON_NONE, Pointi(320, 240)));
+    result.events.push_back(makeMouseEvent(EVENT_MOUSE_BUTTON_PRESS, BUTTON_LEFT, Pointi(10, 5)));
+    result.events.push_back(std::move(resizeEvent));
+    result.events.push_back(makePaintEvent(1015, -7));
+    result.events.push_back(makePaintEvent(1000000000000, 0x7FFFFFFF));
+    return result;
+}
+
+UNIT_TEST(EventTraceBinary, RoundTrip) {
+    EventTrace trace = makeTestTrace();
+    Blob blob = toBlob(trace);
+    EXPECT_TRUE(isBinaryEventTrace(blob));
+    EXPECT_EQ(EventTrace::detectFormat(blob), EVENT_TRACE_BINARY);
+
+    EventTrace loaded = fromBlob<EventTrace>(blob);
+    EXPECT_EQ(loaded.header.saveFileSize, trace.header.saveFileSize);
+    EXPECT_EQ(loaded.header.config.entries().size(), 1);
+    EXPECT_EQ(loaded.header.config.entries()[0].value, "15");
+    EXPECT_EQ(loaded.header.startState.locationName, "out01.odm");
+    EXPECT_EQ(loaded.header.startState.partyPosition, trace.header.startState.partyPosition);
+    EXPECT_EQ(loaded.header.startState.characters.size(), 2);
+    EXPECT_EQ(loaded.header.startState.characters[1].hp, -5);
+    EXPECT_EQ(loaded.header.endState.locationName, "d01.blv");
+    EXPECT_EQ(loaded.header.afterLoadRandomState, -123);
+
+    ASSERT_EQ(loaded.events.size(), trace.events.size());
+    for (size_t i = 0; i < trace.events.size(); i++)
+        EXPECT_EQ(loaded.events[i]->type, trace.events[i]->type);
+
+    const PlatformKeyEvent *keyEvent = static_cast<const PlatformKeyEvent *>(loaded.events[1].get());
+    EXPECT_EQ(keyEvent->key, PlatformKey::KEY_RETURN);
+    EXPECT_EQ(keyEvent->mods, MOD_SHIFT | MOD_CTRL);
+    EXPECT_TRUE(keyEvent->isAutoRepeat);
+
+    const PlatformMouseEvent *mouseEvent = static_cast<const PlatformMouseEvent *>(loaded.events[3].get());
+    EXPECT_EQ(mouseEvent->button, BUTTON_LEFT);
+    EXPECT_EQ(mouseEvent->buttons, BUTTON_LEFT);
+    EXPECT_EQ(mouseEvent->pos.x, 10);
+    EXPECT_EQ(mouseEvent->pos.y, 5);
+
+    const PlatformResizeEvent *resizeEvent = static_cast<const PlatformResizeEvent *>(loaded.events[4].get());
+    EXPECT_EQ(resizeEvent->size, Sizei(640, 480));
+
+    for (size_t i : {0, 5, 6}) {
+        const PaintEvent *expected = static_cast<const PaintEvent *>(trace.events[i].get());
+        const PaintEvent *actual = static_cast<const PaintEvent *>(loaded.events[i].get());
+        EXPECT_EQ(actual->tickCount, expected->tickCount);
+        EXPECT_EQ(actual->randomState, expected->randomState);
+    }
+}
+
+UNIT_TEST(EventTraceBinary, CompactPaintEvents) {
+    EventTrace trace;
+    for (int i = 0; i < 1000; i++)
+        trace.events.push_back(makePaintEvent(1000 + i * 15, i * 7919));
+
+    // Type, one byte for the tick delta, four bytes for the random state.
+    EXPECT_LT(toBlob(trace).size(), 1000 * 6 + 100);
+}
+
+UNIT_TEST(EventTraceBinary, InvalidData) {
+    EXPECT_FALSE(isBinaryEventTrace(Blob::fromString("{\"header\": {}}")));
+    EXPECT_EQ(EventTrace::detectFormat(Blob::fromString("{\"header\": {}}")), EVENT_TRACE_JSON);
+
+    Blob truncated = toBlob(makeTestTrace());
+    truncated = truncated.subBlob(0, truncated.size() - 3);
+    EXPECT_ANY_THROW((void) fromBlob<EventTrace>(truncated));
+}
@@ -24,6 +24,7 @@
 #include "Library/Logger/Logger.h"
 
 #include "Utility/DataPath.h"
+#include "Utility/ThreadPool.h"
 
 #include "SoundList.h"
 #include "OpenALTrack16.h"
@@ -43,7 +44,11 @@ constexpr Pid FAKE_HOUSE_SPEECH_PID = Pid::fromPacked(-6);
 
 extern OpenALSoundProvider *provider;
 
-AudioPlayer::~AudioPlayer() = default;
+AudioPlayer::~AudioPlayer() {
+    // Prefetch tasks read from `_sndReader`, so we need to wait for them to finish.
+    for (auto &[_, pending] : _pendingSounds)
+        pending.wait();
+}
 
 void AudioPlayer::MusicPlayTrack(MusicId eTrack) {
     if (currentMusicTrack == eTrack) {
@@ -204,6 +209,8 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
 
     //logger->Info("AudioPlayer: sound id {} found as '{}'", eSoundID, si.sName);
 
+    _playedSounds.insert(eSoundID);
+
     if (!loadSoundDataSource(si)) return;
 
     PAudioSample sample = CreateAudioSample();
@@ -334,6 +341,10 @@ bool AudioPlayer::loadSoundDataSource(SoundInfo* si) {
         if (si->sName == "") {  // enable this for bonus sound effects
             //logger->Info("AudioPlayer: trying to load bonus sound {}", eSoundID);
             //buffer = LoadSound(int(eSoundID));
+        } else if (auto pending = _pendingSounds.find(si->uSoundID); pending != _pendingSounds.end()) {
+            std::future<Blob> future = std::move(pending->second);
+            _pendingSounds.erase(pending);
+            buffer = future.get(); // Rethrows decompression errors, if any.
         } else {
             buffer = LoadSound(si->sName);
         }
@@ -456,6 +467,32 @@ Blob AudioPlayer::LoadSound(const std::string &pSoundName) {
     return _sndReader.read(pSoundName);
 }
 
+void AudioPlayer::prefetchSounds(std::span<const SoundId> sounds) {
+    if (!bPlayerReady)
+        return;
+
+    for (SoundId id : sounds) {
+        SoundInfo *si = pSoundList->soundInfo(id);
+        if (!si || si->dataSource || si->sName.empty() || _pendingSounds.contains(id) || !_sndReader.exists(si->sName))
+            continue;
+
+        // Unlike LODs, SND entries are decompressed by the reader itself, so the whole read goes to the pool.
+        _pendingSounds.emplace(id, ThreadPool::shared().submit([this, name = si->sName] {
+            return _sndReader.read(name);
+        }));
+    }
+}
+
+std::vector<SoundId> AudioPlayer::playedSounds() const {
+    std::vector<SoundId> result(_playedSounds.begin(), _playedSounds.end());
+    std::ranges::sort(result);
+    return result;
+}
+
+void AudioPlayer::resetPlayedSounds() {
+    _playedSounds.clear();
+}
+
 void AudioPlayer::playSpellSound(SpellId spell, bool is_impact, SoundPlaybackMode mode, Pid pid) {
     if (spell != SPELL_NONE)
         playSound(static_cast<SoundId>(SpellSoundIds[spell] + is_impact), mode, pid);
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <future>
 #include <map>
 #include <string>
 #include <memory>
 #include <list>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "Engine/Pid.h"
 #include "Engine/Spells/SpellEnums.h"
@@ -31,6 +36,23 @@ class AudioPlayer {
 
     Blob LoadSound(const std::string &pSoundName);
 
+    /**
+     * Starts reading and decompressing the provided sounds on the shared thread pool. A subsequent `playSound` call
+     * for any of these sounds picks up the decompressed data instead of loading it on the calling thread.
+     *
+     * Sounds that are already loaded or that don't exist in the SND are skipped.
+     *
+     * @param sounds                    Ids of the sounds to prefetch.
+     */
+    void prefetchSounds(std::span<const SoundId> sounds);
+
+    /**
+     * @return                          Ids of all the sounds that were played since the last `resetPlayedSounds`
+     *                                  call, sorted in ascending order.
+     */
+    [[nodiscard]] std::vector<SoundId> playedSounds() const;
+    void resetPlayedSounds();
+
     void SetMasterVolume(int level);
     void SetVoiceVolume(int level);
     void SetMusicVolume(int level);
@@ -157,6 +179,8 @@ class AudioPlayer {
     AudioSamplePool _loopingSoundPool = AudioSamplePool(true);
     PAudioSample _currentWalkingSample;
     SndReader _sndReader;
+    std::unordered_set<SoundId> _playedSounds;
+    std::unordered_map<SoundId, std::future<Blob>> _pendingSounds;
 };
 
 extern std::unique_ptr<AudioPlayer> pAudioPlayer;
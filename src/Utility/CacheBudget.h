@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * Memory used by a cache of decoded assets.
+ */
+struct CacheUsage {
+    size_t entries = 0; // Number of cache entries.
+    size_t cpuBytes = 0; // Size of the decoded data in main memory.
+    size_t gpuBytes = 0; // Size of the textures uploaded to the GPU.
+};
+
+/**
+ * Cache entry that can be evicted.
+ */
+template<class T>
+struct LruCandidate {
+    T value = {};
+    uint64_t lastUse = 0; // Larger values mean more recent use.
+    size_t size = 0;
+};
+
+/**
+ * Picks the cache entries to evict so that the cache fits into the provided budget. Least recently used entries are
+ * picked first.
+ *
+ * @param candidates                    Entries that can be evicted.
+ * @param totalSize                     Total size of the cache, this includes the entries that can't be evicted.
+ * @param budget                        Max total size of the cache. Zero means no limit.
+ * @return                              Entries to evict, least recently used first. If the cache can't be made to fit
+ *                                      into the budget, all candidates are returned.
+ */
+template<class T>
+std::vector<T> selectLruVictims(std::vector<LruCandidate<T>> candidates, size_t totalSize, size_t budget) {
+    std::vector<T> result;
+    if (budget == 0 || totalSize <= budget)
+        return result;
+
+    std::ranges::sort(candidates, std::less(), &LruCandidate<T>::lastUse);
+    for (LruCandidate<T> &candidate : candidates) {
+        if (totalSize <= budget)
+            break;
+        totalSize -= std::min(totalSize, candidate.size);
+        result.push_back(std::move(candidate.value));
+    }
+    return result;
+}
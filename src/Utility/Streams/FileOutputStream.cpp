@@ -5,21 +5,21 @@
 #include "Utility/Exception.h"
 #include "Utility/UnicodeCrt.h"
 
-FileOutputStream::FileOutputStream(std::string_view path) {
-    open(path);
+FileOutputStream::FileOutputStream(std::string_view path, FileOutputMode mode) {
+    open(path, mode);
 }
 
 FileOutputStream::~FileOutputStream() {
     closeInternal(false);
 }
 
-void FileOutputStream::open(std::string_view path) {
+void FileOutputStream::open(std::string_view path, FileOutputMode mode) {
     assert(UnicodeCrt::isInitialized()); // Otherwise fopen on Windows will choke on UTF-8 paths.
 
     close();
 
     _path = std::string(path);
-    _file = fopen(_path.c_str(), "wb");
+    _file = fopen(_path.c_str(), mode == FILE_OUTPUT_APPEND ? "ab" : "wb");
     if (!_file)
         Exception::throwFromErrno(_path);
 }
@@ -6,13 +6,19 @@
 
 #include "OutputStream.h"
 
+enum class FileOutputMode {
+    FILE_OUTPUT_TRUNCATE, // Overwrite the file if it exists.
+    FILE_OUTPUT_APPEND, // Append to the end of the file if it exists.
+};
+using enum FileOutputMode;
+
 class FileOutputStream : public OutputStream {
  public:
     FileOutputStream() = default;
-    explicit FileOutputStream(std::string_view path);
+    explicit FileOutputStream(std::string_view path, FileOutputMode mode = FILE_OUTPUT_TRUNCATE);
     virtual ~FileOutputStream();
 
-    void open(std::string_view path);
+    void open(std::string_view path, FileOutputMode mode = FILE_OUTPUT_TRUNCATE);
 
     [[nodiscard]] bool isOpen() const {
         return _file != nullptr;
@@ -28,6 +28,27 @@ UNIT_TEST(FileOutputStream, Write) {
     remove(tmpfile);
 }
 
+UNIT_TEST(FileOutputStream, Append) {
+    const char *tmpfile = "tmp_test.txt";
+
+    FileOutputStream out(tmpfile);
+    out.write("12", 2);
+    out.close();
+
+    out.open(tmpfile, FILE_OUTPUT_APPEND);
+    out.write("34", 2);
+    out.close();
+
+    FileInputStream in(tmpfile);
+    char buf[1024] = {};
+    size_t bytes = in.read(buf, 1024);
+    EXPECT_EQ(bytes, 4);
+    EXPECT_EQ(strcmp(buf, "1234"), 0);
+    in.close();
+
+    remove(tmpfile);
+}
+
 UNIT_TEST(FileInputStream, Skip) {
     const char *tmpfile = "tmp_test.txt";
     std::string data(3000, 'a');
@@ -42,6 +42,30 @@ std::vector<char *> tokenize(char *input, const char separator) {
     return retVect;
 }
 
+char *strtokThreadLocal(char *str, const char *delims) {
+    static thread_local char *next = nullptr;
+    if (str)
+        next = str;
+    if (!next)
+        return nullptr;
+
+    next += strspn(next, delims);
+    if (!*next) {
+        next = nullptr;
+        return nullptr;
+    }
+
+    char *result = next;
+    next += strcspn(next, delims);
+    if (*next) {
+        *next = '\0';
+        next++;
+    } else {
+        next = nullptr;
+    }
+    return result;
+}
+
 std::string toLower(std::string_view text) {
     std::string result(text);
     std::transform(result.begin(), result.end(), result.begin(), ::tolower);
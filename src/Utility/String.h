@@ -8,6 +8,19 @@ std::string toLower(std::string_view text);
 std::string toUpper(std::string_view text);
 std::vector<char*> tokenize(char *input, const char separator);
 
+/**
+ * Same as `strtok`, but the tokenizer state is stored in a thread-local variable.
+ *
+ * Some C runtimes, e.g. glibc, store the state of `strtok` in a global. This makes `strtok` unusable from code that
+ * might run on several threads at once, like the game table loaders.
+ *
+ * @param str                           String to tokenize, or `nullptr` to continue tokenizing the string passed into
+ *                                      the previous call on this thread.
+ * @param delims                        Delimiter characters.
+ * @return                              Next token, or `nullptr` if there are no more tokens.
+ */
+char *strtokThreadLocal(char *str, const char *delims);
+
 //----- (00452C30) --------------------------------------------------------
 inline char *removeQuotes(char *str) {
     if (*str == '"') {
@@ -0,0 +1,103 @@
+#include "TaskGraph.h"
+
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+#include "ThreadPool.h"
+
+int TaskGraph::add(std::function<void()> task, std::initializer_list<int> dependencies, TaskFlags flags) {
+    int id = _tasks.size();
+
+    Task &result = _tasks.emplace_back();
+    result.function = std::move(task);
+    result.flags = flags;
+    for (int dependency : dependencies) {
+        assert(dependency >= 0 && dependency < id);
+        _tasks[dependency].dependents.push_back(id);
+        result.dependencyCount++;
+    }
+
+    return id;
+}
+
+void TaskGraph::run(ThreadPool *pool) {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<int> dependencyCounts;
+    std::deque<int> mainThreadQueue;
+    int unfinishedCount = _tasks.size();
+    std::exception_ptr exception;
+
+    for (const Task &task : _tasks)
+        dependencyCounts.push_back(task.dependencyCount);
+
+    std::function<void(int)> start;
+
+    // Runs the task & returns the ids of the dependents that became ready.
+    auto execute = [&](int id) {
+        bool skip = false;
+        {
+            std::scoped_lock lock(mutex);
+            skip = !!exception;
+        }
+
+        if (!skip) {
+            try {
+                _tasks[id].function();
+            } catch (...) {
+                std::scoped_lock lock(mutex);
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        }
+
+        std::vector<int> ready;
+        {
+            std::scoped_lock lock(mutex);
+            for (int dependent : _tasks[id].dependents)
+                if (--dependencyCounts[dependent] == 0)
+                    ready.push_back(dependent);
+            unfinishedCount--;
+            // Notifying under the lock, otherwise `run` might return & destroy `condition` before we get to it.
+            condition.notify_all();
+        }
+
+        // Note that if `ready` is non-empty then `unfinishedCount` is non-zero, and `run` is still waiting.
+        for (int dependent : ready)
+            start(dependent);
+    };
+
+    start = [&](int id) {
+        if (_tasks[id].flags & TASK_MAIN_THREAD) {
+            std::scoped_lock lock(mutex);
+            mainThreadQueue.push_back(id);
+            condition.notify_all();
+        } else {
+            (void) pool->submit([&execute, id] { execute(id); });
+        }
+    };
+
+    for (int id = 0; id < static_cast<int>(_tasks.size()); id++)
+        if (_tasks[id].dependencyCount == 0)
+            start(id);
+
+    while (true) {
+        int id = -1;
+        {
+            std::unique_lock lock(mutex);
+            condition.wait(lock, [&] { return unfinishedCount == 0 || !mainThreadQueue.empty(); });
+            if (mainThreadQueue.empty())
+                break; // All done.
+            id = mainThreadQueue.front();
+            mainThreadQueue.pop_front();
+        }
+        execute(id);
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
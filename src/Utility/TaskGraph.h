@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "Flags.h"
+
+class ThreadPool;
+
+enum class TaskFlag {
+    TASK_MAIN_THREAD = 0x1, // Task must run on the thread that's calling `TaskGraph::run`.
+};
+using enum TaskFlag;
+MM_DECLARE_FLAGS(TaskFlags, TaskFlag)
+MM_DECLARE_OPERATORS_FOR_FLAGS(TaskFlags)
+
+/**
+ * Set of tasks with dependencies between them, e.g. game table loaders.
+ *
+ * `run` starts every task as soon as all of its dependencies have finished, so the total running time is bounded by
+ * the longest dependency chain rather than by the sum of all task times. Tasks that touch state that's not
+ * thread-safe (e.g. the renderer or the asset caches) can be pinned to the calling thread with `TASK_MAIN_THREAD`.
+ *
+ * Dependencies can only point at tasks that were added earlier, so the graph is acyclic by construction.
+ */
+class TaskGraph {
+ public:
+    TaskGraph() = default;
+
+    /**
+     * @param task                      Task to run.
+     * @param dependencies              Ids of the tasks that must finish before this one is started.
+     * @param flags                     Task flags.
+     * @return                          Id of the new task.
+     */
+    int add(std::function<void()> task, std::initializer_list<int> dependencies = {}, TaskFlags flags = 0);
+
+    /**
+     * Runs all the tasks and waits for them to finish. Tasks without `TASK_MAIN_THREAD` are run on the provided
+     * thread pool, while the calling thread runs the `TASK_MAIN_THREAD` tasks as they become ready.
+     *
+     * If a task throws, the tasks that haven't been started yet are skipped, and the first exception is rethrown once
+     * the running tasks finish.
+     *
+     * @param pool                      Thread pool to use.
+     */
+    void run(ThreadPool *pool);
+
+    [[nodiscard]] size_t size() const {
+        return _tasks.size();
+    }
+
+ private:
+    struct Task {
+        std::function<void()> function;
+        TaskFlags flags;
+        int dependencyCount = 0;
+        std::vector<int> dependents;
+    };
+
+ private:
+    std::vector<Task> _tasks;
+};
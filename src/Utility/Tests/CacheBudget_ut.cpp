@@ -0,0 +1,31 @@
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/CacheBudget.h"
+
+UNIT_TEST(CacheBudget, FitsIntoBudget) {
+    std::vector<LruCandidate<int>> candidates = {{1, 10, 100}, {2, 20, 100}, {3, 30, 100}};
+    EXPECT_TRUE(selectLruVictims(candidates, 300, 300).empty());
+    EXPECT_TRUE(selectLruVictims(candidates, 300, 1000).empty());
+}
+
+UNIT_TEST(CacheBudget, NoLimit) {
+    std::vector<LruCandidate<int>> candidates = {{1, 10, 100}, {2, 20, 100}};
+    EXPECT_TRUE(selectLruVictims(candidates, 1000000, 0).empty());
+}
+
+UNIT_TEST(CacheBudget, LeastRecentlyUsedFirst) {
+    std::vector<LruCandidate<std::string>> candidates = {{"c", 30, 100}, {"a", 10, 100}, {"d", 40, 100}, {"b", 20, 100}};
+    EXPECT_EQ(selectLruVictims(candidates, 400, 250), std::vector<std::string>({"a", "b"}));
+    EXPECT_EQ(selectLruVictims(candidates, 400, 300), std::vector<std::string>({"a"}));
+    EXPECT_EQ(selectLruVictims(candidates, 400, 299), std::vector<std::string>({"a", "b"}));
+}
+
+UNIT_TEST(CacheBudget, PinnedEntries) {
+    // Only two entries can be evicted, the rest of the cache is pinned.
+    std::vector<LruCandidate<int>> candidates = {{1, 10, 50}, {2, 20, 50}};
+    EXPECT_EQ(selectLruVictims(candidates, 1000, 500), std::vector<int>({1, 2}));
+    EXPECT_EQ(selectLruVictims(candidates, 1000, 960), std::vector<int>({1}));
+}
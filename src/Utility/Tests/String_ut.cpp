@@ -1,3 +1,7 @@
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "Testing/Unit/UnitTest.h"
 
 #include "Utility/String.h"
@@ -58,3 +62,22 @@ UNIT_TEST(String, Split) {
     splitString("", ';', &v);
     EXPECT_TRUE(v.empty());
 }
+
+UNIT_TEST(String, StrtokThreadLocal) {
+    std::string s = "\r\rabc\r\rde\rf\r";
+    EXPECT_EQ(std::string(strtokThreadLocal(s.data(), "\r")), "abc");
+    EXPECT_EQ(std::string(strtokThreadLocal(nullptr, "\r")), "de");
+    EXPECT_EQ(std::string(strtokThreadLocal(nullptr, "\r")), "f");
+    EXPECT_EQ(strtokThreadLocal(nullptr, "\r"), nullptr);
+    EXPECT_EQ(strtokThreadLocal(nullptr, "\r"), nullptr);
+
+    std::string empty = "\r\r";
+    EXPECT_EQ(strtokThreadLocal(empty.data(), "\r"), nullptr);
+
+    // State is per-thread.
+    std::string l = "a\tb";
+    std::string r = "c\td";
+    EXPECT_EQ(std::string(strtokThreadLocal(l.data(), "\t")), "a");
+    std::thread([&] { EXPECT_EQ(std::string(strtokThreadLocal(r.data(), "\t")), "c"); }).join();
+    EXPECT_EQ(std::string(strtokThreadLocal(nullptr, "\t")), "b");
+}
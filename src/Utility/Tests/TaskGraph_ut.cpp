@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/TaskGraph.h"
+#include "Utility/ThreadPool.h"
+
+UNIT_TEST(TaskGraph, Dependencies) {
+    for (int threadCount : {0, 1, 4}) {
+        ThreadPool pool(threadCount);
+
+        std::mutex mutex;
+        std::vector<int> order;
+        auto record = [&](int value) {
+            return [&, value] {
+                std::scoped_lock lock(mutex);
+                order.push_back(value);
+            };
+        };
+
+        // Diamond: 0 -> {1, 2} -> 3, plus a standalone task.
+        TaskGraph graph;
+        int a = graph.add(record(0));
+        int b = graph.add(record(1), {a});
+        int c = graph.add(record(2), {a}, TASK_MAIN_THREAD);
+        graph.add(record(3), {b, c});
+        graph.add(record(4));
+        EXPECT_EQ(graph.size(), 5);
+        graph.run(&pool);
+
+        ASSERT_EQ(order.size(), 5);
+        auto pos = [&](int value) { return std::find(order.begin(), order.end(), value) - order.begin(); };
+        EXPECT_LT(pos(0), pos(1));
+        EXPECT_LT(pos(0), pos(2));
+        EXPECT_LT(pos(1), pos(3));
+        EXPECT_LT(pos(2), pos(3));
+        EXPECT_NE(pos(4), 5);
+    }
+}
+
+UNIT_TEST(TaskGraph, MainThread) {
+    ThreadPool pool(2);
+    std::thread::id mainThreadId = std::this_thread::get_id();
+
+    TaskGraph graph;
+    std::atomic<int> mainThreadCount = 0;
+    for (int i = 0; i < 10; i++) {
+        int id = graph.add([] {});
+        graph.add([&] { mainThreadCount += std::this_thread::get_id() == mainThreadId; }, {id}, TASK_MAIN_THREAD);
+    }
+    graph.run(&pool);
+
+    EXPECT_EQ(mainThreadCount, 10);
+}
+
+UNIT_TEST(TaskGraph, Concurrency) {
+    ThreadPool pool(2);
+
+    // Two tasks that can only finish if they run at the same time.
+    std::atomic<int> started = 0;
+    std::atomic<bool> timedOut = false;
+    auto task = [&] {
+        started++;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (started < 2) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                timedOut = true;
+                return;
+            }
+            std::this_thread::yield();
+        }
+    };
+
+    TaskGraph graph;
+    graph.add(task);
+    graph.add(task);
+    graph.run(&pool);
+
+    EXPECT_FALSE(timedOut);
+}
+
+UNIT_TEST(TaskGraph, Exceptions) {
+    ThreadPool pool(2);
+
+    bool dependentRan = false;
+    TaskGraph graph;
+    int a = graph.add([] { throw std::runtime_error("42"); });
+    graph.add([&] { dependentRan = true; }, {a});
+    EXPECT_THROW(graph.run(&pool), std::runtime_error);
+    EXPECT_FALSE(dependentRan);
+}
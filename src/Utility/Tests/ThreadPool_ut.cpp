@@ -0,0 +1,36 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/ThreadPool.h"
+
+UNIT_TEST(ThreadPool, Results) {
+    for (int threadCount : {0, 1, 4}) {
+        ThreadPool pool(threadCount);
+        EXPECT_EQ(pool.threadCount(), threadCount);
+
+        std::vector<std::future<int>> futures;
+        for (int i = 0; i < 100; i++)
+            futures.push_back(pool.submit([i] { return i * i; }));
+        for (int i = 0; i < 100; i++)
+            EXPECT_EQ(futures[i].get(), i * i);
+    }
+}
+
+UNIT_TEST(ThreadPool, Exceptions) {
+    ThreadPool pool(2);
+    std::future<int> future = pool.submit([]() -> int { throw std::runtime_error("42"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+UNIT_TEST(ThreadPool, DestructorWaits) {
+    std::atomic<int> counter = 0;
+    {
+        ThreadPool pool(3);
+        for (int i = 0; i < 50; i++)
+            (void) pool.submit([&] { counter++; });
+    }
+    EXPECT_EQ(counter, 50);
+}
@@ -0,0 +1,52 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(int threadCount) {
+    for (int i = 0; i < threadCount; i++)
+        _threads.emplace_back([this] { run(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::scoped_lock lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_all();
+
+    for (std::thread &thread : _threads)
+        thread.join();
+}
+
+ThreadPool &ThreadPool::shared() {
+    static ThreadPool result(std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1));
+    return result;
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    if (_threads.empty()) {
+        task();
+        return;
+    }
+
+    {
+        std::scoped_lock lock(_mutex);
+        _queue.push_back(std::move(task));
+    }
+    _condition.notify_one();
+}
+
+void ThreadPool::run() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(_mutex);
+            _condition.wait(lock, [this] { return _stopping || !_queue.empty(); });
+            if (_queue.empty())
+                return; // Stopping & nothing left to do.
+            task = std::move(_queue.front());
+            _queue.pop_front();
+        }
+        task();
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Simple fixed-size thread pool.
+ *
+ * Tasks are started in submission order, results (and exceptions) are delivered through `std::future`s.
+ */
+class ThreadPool {
+ public:
+    /**
+     * @param threadCount               Number of worker threads. If zero, tasks are executed synchronously inside
+     *                                  `submit`.
+     */
+    explicit ThreadPool(int threadCount);
+
+    /**
+     * Waits for all the submitted tasks to finish & stops the worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @param task                      Task to run.
+     * @return                          Future for the task's result.
+     */
+    template<class Task, class Result = std::invoke_result_t<std::decay_t<Task>>>
+    std::future<Result> submit(Task &&task) {
+        auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+        std::future<Result> result = packagedTask->get_future();
+        enqueue([packagedTask] { (*packagedTask)(); });
+        return result;
+    }
+
+    [[nodiscard]] int threadCount() const {
+        return _threads.size();
+    }
+
+    /**
+     * @return                          Shared thread pool for background work, with one thread per hardware core,
+     *                                  minus one for the main thread.
+     */
+    static ThreadPool &shared();
+
+ private:
+    void enqueue(std::function<void()> task);
+    void run();
+
+ private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<std::function<void()>> _queue;
+    bool _stopping = false;
+    std::vector<std::thread> _threads;
+};
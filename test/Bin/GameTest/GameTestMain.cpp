@@ -16,6 +16,7 @@
 #include "Utility/UnicodeCrt.h"
 
 #include "GameTestOptions.h"
+#include "GameTestRunner.h"
 
 void printGoogleTestHelp(char *app) {
     int argc = 2;
@@ -35,15 +36,20 @@ int platformMain(int argc, char **argv) {
             return 1;
         }
 
+        if (opts.jobs != 1 && opts.workerIndex == -1 && !opts.listRequested)
+            return runGameTestWorkers(argc, argv, opts); // Need unmodified argv here, so this goes before gtest init.
+
         testing::InitGoogleTest(&argc, argv);
         if (opts.listRequested)
             return RUN_ALL_TESTS();
+        if (opts.workerIndex != -1)
+            initGameTestWorker(&opts);
 
         GameStarter starter(opts);
 
         int exitCode = 0;
         starter.runInstrumented([&] (EngineController *game) {
-            TestController test(game, opts.testPath, opts.speed);
+            TestController test(game, opts.testPath, opts.speed, opts.fastForward);
             GameTest::init(game, &test);
             exitCode = RUN_ALL_TESTS();
         });
@@ -28,6 +28,13 @@ GameTestOptions GameTestOptions::parse(int argc, char **argv) {
     app->add_option(
         "--speed", result.speed,
         "Playback speed, default is infinite, use '1.0' for realtime playback.")->option_text("SPEED");
+    app->add_flag(
+        "--fast-forward", result.fastForward,
+        "Only draw the world & HUD on frames that are followed by input.")->group(otherOptions);
+    app->add_option(
+        "--profile", result.profilePath,
+        "Enable the profiler and write out the recorded zones in Chrome trace format on exit. When running tests in "
+        "several worker processes, worker index is appended to the file name.")->option_text("PATH")->group(otherOptions);
     app->add_flag(
         "--tracing-rng", result.tracingRng,
         "Use random number generators that print stack trace on each call.")->group(otherOptions);
@@ -37,6 +44,21 @@ GameTestOptions GameTestOptions::parse(int argc, char **argv) {
     app->add_flag_callback(
         "-v,--verbose", [&] { result.logLevel = LOG_TRACE; },
         "Set log level to 'trace'.");
+    app->add_option(
+        "-j,--jobs", result.jobs,
+        "Run tests in this many worker processes, '0' to use one per core. Default is to run all tests in this process.")->check(CLI::NonNegativeNumber)->option_text("COUNT")->group(otherOptions);
+    app->add_option(
+        "--worker-index", result.workerIndex,
+        "Index of a worker process, set by the parent process.")->group(""); // Hidden.
+    app->add_option(
+        "--worker-count", result.workerCount,
+        "Total number of worker processes, set by the parent process.")->group("");
+    app->add_option(
+        "--worker-results", result.workerResultsPath,
+        "Path to write worker test results to, set by the parent process.")->group("");
+    app->add_option(
+        "--worker-data-path", result.workerDataPath,
+        "Private data dir of a worker process, set by the parent process.")->group("");
     app->set_help_flag("-h,--help", "Print help and exit.")->group(otherOptions);
     app->add_flag(
         "--gtest_list_tests", result.listRequested,
@@ -9,8 +9,16 @@
 struct GameTestOptions : GameStarterOptions {
     std::string testPath;
     float speed = FLT_MAX; // Test playback speed.
+    bool fastForward = false; // Skip drawing the world & HUD on frames that are not followed by input.
     bool helpPrinted = false;
     bool listRequested = false;
+    int jobs = 1; // Number of worker processes to run tests in, zero means one per core.
+
+    // Worker process options, set by the parent process when running tests with `jobs != 1`.
+    int workerIndex = -1; // Index of this worker, -1 if this is not a worker process.
+    int workerCount = 0;
+    std::string workerResultsPath; // Path to write test results to.
+    std::string workerDataPath; // Private copy of the data dir for this worker, overrides `dataPath`.
 
     static GameTestOptions parse(int argc, char **argv);
 };
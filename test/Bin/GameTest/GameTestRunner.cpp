@@ -0,0 +1,263 @@
+#include "GameTestRunner.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Application/GameStarter.h"
+
+#include "Library/Environment/Interface/Environment.h"
+#include "Library/Logger/Logger.h"
+#include "Library/Logger/LogSink.h"
+
+#include "Utility/Memory/Blob.h"
+#include "Utility/Streams/FileOutputStream.h"
+#include "Utility/Format.h"
+#include "Utility/ScopeGuard.h"
+#include "Utility/String.h"
+#include "Utility/ThreadPool.h"
+
+#include "GameTestOptions.h"
+
+namespace {
+
+struct GameTestResult {
+    std::string name;
+    std::string status; // "OK", "FAILED" or "SKIPPED".
+    int64_t timeMs = 0;
+};
+
+struct GameTestWorker {
+    std::string resultsPath;
+    std::string logPath;
+    int exitCode = 0;
+    std::vector<GameTestResult> results;
+};
+
+/**
+ * Writes out a line per finished test, so that the parent process can pick up the results even if the worker
+ * crashes in the middle of a run.
+ */
+class GameTestResultWriter : public testing::EmptyTestEventListener {
+ public:
+    explicit GameTestResultWriter(std::string_view path) : _stream(path) {}
+
+    virtual void OnTestEnd(const testing::TestInfo &info) override {
+        const testing::TestResult *result = info.result();
+        std::string_view status = result->Skipped() ? "SKIPPED" : result->Failed() ? "FAILED" : "OK";
+        _stream.write(fmt::format("{} {} {}.{}\n", status, result->elapsed_time(), info.test_suite_name(), info.name()));
+        _stream.flush();
+    }
+
+ private:
+    FileOutputStream _stream;
+};
+
+} // namespace
+
+static std::string quoteArgument(std::string_view arg) {
+    std::string result = "\"";
+    for (char c : arg) {
+#ifdef _WINDOWS
+        if (c == '"')
+            result += '\\';
+#else
+        if (c == '"' || c == '\\' || c == '$' || c == '`')
+            result += '\\';
+#endif
+        result += c;
+    }
+    result += '"';
+    return result;
+}
+
+static std::string resolveDataPath(const GameTestOptions &options) {
+    GameTestOptions resolvedOptions = options;
+    std::unique_ptr<Environment> environment = Environment::createStandardEnvironment();
+    std::unique_ptr<LogSink> logSink = LogSink::createDefaultSink();
+    Logger logger(LOG_WARNING, logSink.get());
+    GameStarter::resolvePaths(environment.get(), &resolvedOptions, &logger);
+    return resolvedOptions.dataPath;
+}
+
+static void linkFile(const std::filesystem::path &src, const std::filesystem::path &dst) {
+    std::error_code ec;
+    std::filesystem::create_symlink(src, dst, ec);
+    if (ec)
+        std::filesystem::create_hard_link(src, dst, ec); // Creating symlinks on Windows requires developer mode.
+    if (ec)
+        std::filesystem::copy_file(src, dst);
+}
+
+/**
+ * Creates a private data dir for a worker process, so that workers don't overwrite each other's saves.
+ *
+ * Directories are recreated and files are linked, except for `new.lod` that's modified in place, and is thus copied.
+ * Saves dir is left empty. Caches & PVS files are written through `TempFileOutputStream` that replaces the link
+ * instead of writing through it, so they can be shared.
+ *
+ * @param src                           Game data dir.
+ * @param dst                           Worker data dir to create.
+ */
+static void createWorkerDataDir(const std::filesystem::path &src, const std::filesystem::path &dst) {
+    std::filesystem::create_directories(dst);
+    for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(src)) {
+        std::string name = toLower(entry.path().filename().string());
+        std::filesystem::path target = dst / entry.path().filename();
+        if (entry.is_directory() && name == "saves") {
+            std::filesystem::create_directory(target);
+        } else if (entry.is_directory()) {
+            createWorkerDataDir(entry.path(), target);
+        } else if (name == "new.lod") {
+            std::filesystem::copy_file(entry.path(), target);
+        } else {
+            linkFile(std::filesystem::absolute(entry.path()), target);
+        }
+    }
+}
+
+static std::vector<GameTestResult> readResults(const std::string &path) {
+    std::vector<GameTestResult> result;
+    if (!std::filesystem::exists(path))
+        return result;
+
+    Blob data = Blob::fromFile(path);
+    for (std::string_view line : splitString(data.string_view(), '\n')) {
+        std::vector<std::string_view> parts = splitString(line, ' ');
+        if (parts.size() != 3)
+            continue; // Last line might be incomplete if the worker has crashed.
+
+        GameTestResult &test = result.emplace_back();
+        test.status = parts[0];
+        test.timeMs = std::atoll(std::string(parts[1]).c_str());
+        test.name = parts[2];
+    }
+    return result;
+}
+
+int runGameTestWorkers(int argc, char **argv, const GameTestOptions &options) {
+    int jobs = options.jobs;
+    if (jobs == 0)
+        jobs = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::filesystem::path tmpDir = std::filesystem::temp_directory_path() /
+        fmt::format("OpenEnroth_GameTest_{}", startTime.time_since_epoch().count());
+    std::filesystem::create_directories(tmpDir);
+    MM_AT_SCOPE_EXIT(std::error_code ec; std::filesystem::remove_all(tmpDir, ec));
+
+    std::string dataPath = resolveDataPath(options);
+
+    std::string commandPrefix;
+    for (int i = 0; i < argc; i++)
+        commandPrefix += quoteArgument(argv[i]) + " ";
+
+    std::vector<GameTestWorker> workers(jobs);
+    {
+        ThreadPool pool(jobs);
+        std::vector<std::future<int>> exitCodes;
+        for (int i = 0; i < jobs; i++) {
+            GameTestWorker &worker = workers[i];
+            worker.resultsPath = (tmpDir / fmt::format("worker_{}.txt", i)).string();
+            worker.logPath = (tmpDir / fmt::format("worker_{}.log", i)).string();
+            std::string workerDataPath = (tmpDir / fmt::format("worker_{}_data", i)).string();
+            createWorkerDataDir(dataPath, workerDataPath);
+
+            std::string command = fmt::format("{}--worker-index {} --worker-count {} --worker-results {} "
+                                              "--worker-data-path {} > {} 2>&1", commandPrefix, i, jobs,
+                                              quoteArgument(worker.resultsPath), quoteArgument(workerDataPath),
+                                              quoteArgument(worker.logPath));
+#ifdef _WINDOWS
+            command = "\"" + command + "\""; // cmd.exe strips the outer quotes.
+#endif
+            exitCodes.push_back(pool.submit([command] { return std::system(command.c_str()); }));
+        }
+
+        for (int i = 0; i < jobs; i++) {
+            workers[i].exitCode = exitCodes[i].get();
+            fmt::print("[ WORKER   ] Worker {} finished with exit code {}.\n", i, workers[i].exitCode);
+        }
+    }
+
+    std::vector<GameTestResult> results;
+    for (GameTestWorker &worker : workers) {
+        worker.results = readResults(worker.resultsPath);
+        results.insert(results.end(), worker.results.begin(), worker.results.end());
+    }
+
+    // Print out the logs of the workers that had problems, this is where the failure messages are.
+    bool crashed = false;
+    for (size_t i = 0; i < workers.size(); i++) {
+        const GameTestWorker &worker = workers[i];
+        bool failed = std::ranges::any_of(worker.results, [](const GameTestResult &test) { return test.status == "FAILED"; });
+        if (!failed && worker.exitCode == 0)
+            continue;
+
+        crashed |= !failed;
+        fmt::print("[----------] Output of worker {}:\n", i);
+        if (std::filesystem::exists(worker.logPath))
+            fmt::print("{}\n", Blob::fromFile(worker.logPath).string_view());
+    }
+
+    std::ranges::sort(results, std::greater<>(), &GameTestResult::timeMs);
+    int64_t totalTestTimeMs = 0;
+    std::vector<std::string> failedTests;
+    int passedCount = 0;
+    for (const GameTestResult &test : results) {
+        fmt::print("[ {:<8} ] {} ({} ms)\n", test.status, test.name, test.timeMs);
+        totalTestTimeMs += test.timeMs;
+        if (test.status == "FAILED")
+            failedTests.push_back(test.name);
+        if (test.status == "OK")
+            passedCount++;
+    }
+
+    int64_t wallTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+    fmt::print("[==========] {} tests ran in {} worker processes. ({} ms total, {} ms of test time)\n",
+               results.size(), jobs, wallTimeMs, totalTestTimeMs);
+    fmt::print("[  PASSED  ] {} tests.\n", passedCount);
+    if (!failedTests.empty()) {
+        fmt::print("[  FAILED  ] {} tests, listed below:\n", failedTests.size());
+        for (const std::string &name : failedTests)
+            fmt::print("[  FAILED  ] {}\n", name);
+    }
+    if (crashed)
+        fmt::print("[  FAILED  ] Some of the worker processes have crashed, see the output above.\n");
+
+    return failedTests.empty() && !crashed ? 0 : 1;
+}
+
+void initGameTestWorker(GameTestOptions *options) {
+    // Gtest picks up the sharding settings from the environment.
+    std::string shardIndex = std::to_string(options->workerIndex);
+    std::string shardCount = std::to_string(options->workerCount);
+#ifdef _WINDOWS
+    _putenv_s("GTEST_SHARD_INDEX", shardIndex.c_str());
+    _putenv_s("GTEST_TOTAL_SHARDS", shardCount.c_str());
+#else
+    setenv("GTEST_SHARD_INDEX", shardIndex.c_str(), 1);
+    setenv("GTEST_TOTAL_SHARDS", shardCount.c_str(), 1);
+#endif
+
+    if (!options->workerDataPath.empty())
+        options->dataPath = options->workerDataPath;
+
+    if (!options->workerResultsPath.empty())
+        testing::UnitTest::GetInstance()->listeners().Append(new GameTestResultWriter(options->workerResultsPath));
+
+    if (!options->profilePath.empty()) {
+        std::filesystem::path profilePath(options->profilePath);
+        profilePath.replace_filename(fmt::format("{}_{}{}", profilePath.stem().string(), options->workerIndex,
+                                                 profilePath.extension().string()));
+        options->profilePath = profilePath.string();
+    }
+}
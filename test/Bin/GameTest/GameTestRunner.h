@@ -0,0 +1,30 @@
+#pragma once
+
+struct GameTestOptions;
+
+/**
+ * Runs game tests in several worker processes & merges the results.
+ *
+ * The engine lives in globals, so running several tests in parallel in a single process is not an option. Instead,
+ * this function relaunches the current executable `options.jobs` times, passing all the command line arguments
+ * through, and uses gtest sharding to split the tests between the worker processes. Each worker process runs its
+ * own engine instance on top of its own platform and its own copy of the data dir, and writes out per-test results
+ * that are then merged & reported by the parent process.
+ *
+ * @param argc                          Command line argument count, as passed to `main`.
+ * @param argv                          Command line arguments, as passed to `main`.
+ * @param options                       Parsed command line options.
+ * @return                              Process exit code.
+ */
+int runGameTestWorkers(int argc, char **argv, const GameTestOptions &options);
+
+/**
+ * Sets up gtest for running inside a worker process that was launched by `runGameTestWorkers`. Should be called
+ * after `testing::InitGoogleTest`.
+ *
+ * Also makes the worker use its own data dir and write its profile into a separate file, so that workers don't
+ * overwrite each other's saves & results.
+ *
+ * @param options                       Parsed command line options, might be adjusted for this worker.
+ */
+void initGameTestWorker(GameTestOptions *options);
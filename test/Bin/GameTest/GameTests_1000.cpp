@@ -1,4 +1,5 @@
 #include <unordered_set>
+#include <utility>
 
 #include "Testing/Game/GameTest.h"
 
@@ -18,6 +19,8 @@
 
 #include "Media/Audio/AudioPlayer.h"
 
+#include "Utility/Format.h"
+
 static bool characterHasJar(int charIndex, int jarIndex) {
     for (const ItemGen &item : pParty->pCharacters[charIndex].pInventoryItemList)
         if (item.uItemID == ITEM_QUEST_LICH_JAR_FULL && item.uHolderPlayer == jarIndex)
@@ -559,8 +562,7 @@ GAME_TEST(Prs, Pr1440) {
 
 GAME_TEST(Issues, Issue1447A) {
     // Fire bolt doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle &par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return engine->particle_engine->particleCount(); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447A.mm7", "issue_1447A.json");
     EXPECT_EQ(turnBasedTape.back(), true);
@@ -569,8 +571,7 @@ GAME_TEST(Issues, Issue1447A) {
 
 GAME_TEST(Issues, Issue1447B) {
     // Fireball doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle& par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return engine->particle_engine->particleCount(); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447B.mm7", "issue_1447B.json");
     EXPECT_EQ(turnBasedTape.back(), true);
@@ -579,8 +580,7 @@ GAME_TEST(Issues, Issue1447B) {
 
 GAME_TEST(Issues, Issue1447C) {
     // Acid blast doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle& par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return engine->particle_engine->particleCount(); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447C.mm7", "issue_1447C.json");
     EXPECT_EQ(turnBasedTape.back(), true);
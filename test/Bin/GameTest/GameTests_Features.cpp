@@ -0,0 +1,348 @@
+#include <algorithm>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "GUI/GUIWindow.h"
+
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/LocationFunctions.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/ParticleEngine.h"
+#include "Engine/Objects/SpriteObject.h"
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/CharacterEnumFunctions.h"
+#include "Engine/Objects/ObjectGrid.h"
+#include "Engine/Engine.h"
+#include "Engine/Party.h"
+#include "Engine/Random/Random.h"
+#include "Engine/SpellFxRenderer.h"
+#include "Engine/mm7_data.h"
+
+#include "Library/Color/ColorTable.h"
+
+#include "Utility/String.h"
+
+// Tests for engine features that are not tied to any particular issue or PR. Test saves are borrowed from the issue
+// tests, each test says why that particular save was picked.
+
+static int uncachedItemsBonus(const Character &character, CharacterAttributeType attr) {
+    // A fresh character has an empty item bonus cache, so the bonus is computed from the equipped items.
+    Character fresh;
+    fresh.pActiveSkills = character.pActiveSkills;
+    fresh.pInventoryItemList = character.pInventoryItemList;
+    fresh.pEquipment = character.pEquipment;
+    return fresh.GetItemsBonus(attr);
+}
+
+GAME_TEST(ObjectGrid, ReusedActorSlot) {
+    // An actor spawned into a reused slot should be found by the broadphase right away, and not only after the next
+    // grid refresh. Using an outdoor save with plenty of actors around.
+    test.loadGameFromTestData("pr_1005.mm7");
+    game.tick(1); // Refresh the grid.
+    ASSERT_FALSE(pActors.empty());
+
+    Vec3i oldPos = pActors[0].pos;
+    size_t actorCount = pActors.size();
+    pActors[0].Remove();
+    Actor *actor = AllocateActor(false);
+    ASSERT_NE(actor, nullptr);
+    int actorId = actor->id;
+    ASSERT_EQ(pActors.size(), actorCount); // Slot was reused, not appended.
+
+    actor->pos = oldPos + Vec3i(8192, 8192, 0); // Far away from where the grid has it.
+    actor->radius = 32;
+    actor->height = 128;
+
+    std::vector<int> ids;
+    findActorsNear(BBoxf::forCylinder(actor->pos.toFloat(), 64.0f, 128.0f), &ids);
+    EXPECT_TRUE(std::ranges::find(ids, actorId) != ids.end());
+    EXPECT_TRUE(std::ranges::is_sorted(ids));
+    EXPECT_TRUE(std::ranges::adjacent_find(ids) == ids.end());
+}
+
+GAME_TEST(EngineSnapshot, Restore) {
+    // Restoring an engine snapshot should bring back the party, the actors and the random state. Using an outdoor save
+    // with plenty of actors around.
+    test.loadGameFromTestData("pr_1005.mm7");
+    EngineSnapshot snapshot = game.makeSnapshot();
+
+    int gold = pParty->GetGold();
+    Vec3f pos = pParty->pos;
+    int actorHp = pActors[0].currentHP;
+    int nextRandom = grng->peek(1000);
+
+    for (int i = 0; i < 2; i++) {
+        pParty->SetGold(gold + 1000);
+        pParty->pos.x += 1000;
+        pActors[0].currentHP = 0;
+        grng->random(1000);
+
+        game.restoreSnapshot(snapshot); // Can restore from the same snapshot several times.
+        EXPECT_EQ(uCurrentlyLoadedLevelType, LEVEL_OUTDOOR);
+        EXPECT_EQ(pParty->GetGold(), gold);
+        EXPECT_EQ(pParty->pos.x, pos.x);
+        EXPECT_EQ(pParty->pos.y, pos.y);
+        EXPECT_EQ(pActors[0].currentHP, actorHp);
+        EXPECT_EQ(grng->peek(1000), nextRandom);
+    }
+}
+
+GAME_TEST(EngineSnapshot, RestoreAfterPlaying) {
+    // Restoring a snapshot after the game has moved on should put the party back and rewind the random state.
+    test.loadGameFromTestData("pr_1005.mm7");
+    EngineSnapshot snapshot = game.makeSnapshot();
+
+    Vec3f pos = pParty->pos;
+    int yaw = pParty->_viewYaw;
+    Time time = pParty->GetPlayingTime();
+    int nextRandom = grng->peek(1000);
+
+    pParty->pos.x += 300;
+    pParty->pos.y += 300;
+    pParty->_viewYaw = (yaw + 512) % 2048;
+    game.tick(10);
+    EXPECT_GT(pParty->GetPlayingTime(), time);
+
+    game.restoreSnapshot(snapshot);
+    EXPECT_EQ(current_screen_type, SCREEN_GAME);
+    EXPECT_EQ(pParty->pos.x, pos.x);
+    EXPECT_EQ(pParty->pos.y, pos.y);
+    EXPECT_EQ(pParty->_viewYaw, yaw);
+    EXPECT_EQ(pParty->GetPlayingTime(), time);
+    EXPECT_EQ(grng->peek(1000), nextRandom);
+}
+
+GAME_TEST(EngineSnapshot, ReplayFromSnapshot) {
+    // Playing on from a restored snapshot should give exactly the same results as playing on without the snapshot.
+    struct State {
+        Vec3f partyPos;
+        Vec3i actorPos;
+        Time time;
+        int nextRandom = 0;
+
+        bool operator==(const State &other) const = default;
+    };
+    auto playOn = [&] {
+        std::vector<State> result;
+        for (int i = 0; i < 20; i++) {
+            game.tick(1);
+            result.push_back({pParty->pos, pActors[0].pos, pParty->GetPlayingTime(), grng->peek(1000)});
+        }
+        return result;
+    };
+
+    test.loadGameFromTestData("pr_1005.mm7");
+    game.tick(10); // Let the actors move around.
+    pParty->pos += Vec3f(0.25f, 0.5f, 0.0f); // Doesn't fit into a vanilla save.
+    EngineSnapshot snapshot = game.makeSnapshot();
+
+    std::vector<State> expected = playOn();
+    game.restoreSnapshot(snapshot);
+    std::vector<State> actual = playOn();
+    EXPECT_EQ(actual, expected);
+    EXPECT_NE(expected.front().time, expected.back().time); // Game time was actually running.
+}
+
+GAME_TEST(IndoorSectorGrid, MatchesLinearScan) {
+    // Sector grid lookup should give the same results as a linear scan over all sectors. Using the save from issue 503
+    // because dragon caves is one of the largest dungeons, with lots of sectors stacked on top of each other.
+    test.loadGameFromTestData("issue_503.mm7");
+    EXPECT_EQ(toLower(pCurrentMapName), "mdt12.blv");
+
+    int checked = 0;
+    for (const BLVFace &face : pIndoor->pFaces) {
+        if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
+            continue;
+
+        Vec3i center = face.pBounding.center();
+        for (int dz : {0, 32, 256}) {
+            for (Vec3i offset : {Vec3i(0, 0, dz), Vec3i(-40, 40, dz), Vec3i(40, -40, dz)}) {
+                Vec3i pos = center + offset;
+                EXPECT_EQ(pIndoor->GetSector(pos), pIndoor->GetSectorSlow(pos.x, pos.y, pos.z));
+                checked++;
+            }
+        }
+    }
+    EXPECT_GT(checked, 1000);
+}
+
+GAME_TEST(OutdoorFaceTree, MatchesLinearScan) {
+    // Outdoor face tree should return the same faces as a linear scan over all bmodel faces. Using the save from
+    // PR 1005 because it's an outdoor map with plenty of bmodels.
+    test.loadGameFromTestData("pr_1005.mm7");
+    EXPECT_EQ(uCurrentlyLoadedLevelType, LEVEL_OUTDOOR);
+
+    int hits = 0;
+    std::vector<int> actual;
+    for (int y = -32768; y < 32768; y += 256) {
+        for (int x = -32768; x < 32768; x += 256) {
+            std::vector<int> expected;
+            for (size_t i = 0; i < pOutdoor->faceTreeRefs.size(); i++) {
+                auto [modelIndex, faceIndex] = pOutdoor->faceTreeRefs[i];
+                if (pOutdoor->pBModels[modelIndex].pFaces[faceIndex].pBoundingBox.containsXY(x, y))
+                    expected.push_back(i);
+            }
+
+            pOutdoor->faceTree.queryXY(x, y, &actual);
+            EXPECT_EQ(actual, expected);
+            hits += !expected.empty();
+        }
+    }
+    EXPECT_GT(hits, 100);
+}
+
+GAME_TEST(DetectionCache, MatchesUncached) {
+    // Cached detection results should match the uncached ones. Using the save from issue 503 because dragon caves has
+    // plenty of portals to walk through.
+    engine->config->debug.VerifyDetectionCache.setValue(true);
+    test.loadGameFromTestData("issue_503.mm7");
+    EXPECT_EQ(toLower(pCurrentMapName), "mdt12.blv");
+
+    auto detectAll = [] {
+        std::vector<bool> result;
+        for (size_t i = 0; i < pActors.size(); i++) {
+            result.push_back(Detect_Between_Objects(Pid::actor(i), Pid::character(0)));
+            for (size_t j = 0; j < pActors.size(); j++)
+                if (i != j)
+                    result.push_back(Detect_Between_Objects(Pid::actor(i), Pid::actor(j)));
+        }
+        return result;
+    };
+
+    DetectionCacheStats stats0 = detectionCacheStats();
+    std::vector<bool> expected = detectAll();
+    DetectionCacheStats stats1 = detectionCacheStats();
+    EXPECT_GT(stats1.misses, stats0.misses);
+    EXPECT_EQ(detectAll(), expected);
+    DetectionCacheStats stats2 = detectionCacheStats();
+    EXPECT_GT(stats2.hits, stats1.hits);
+    EXPECT_EQ(stats2.mismatches, stats0.mismatches);
+
+    invalidateDetectionCache();
+    EXPECT_EQ(detectAll(), expected);
+    EXPECT_EQ(detectionCacheStats().hits, stats2.hits);
+}
+
+GAME_TEST(IndoorPvs, MatchesGeometry) {
+    // Potential visibility set should be consistent with the level geometry and with the detection code. Using the save
+    // from issue 503 because dragon caves has lots of sectors and portals.
+    test.loadGameFromTestData("issue_503.mm7");
+    EXPECT_EQ(toLower(pCurrentMapName), "mdt12.blv");
+
+    const IndoorPvs &pvs = pIndoor->pvs;
+    EXPECT_EQ(pvs.sectorCount(), static_cast<int>(pIndoor->pSectors.size()));
+    EXPECT_EQ(pvs.fingerprint(), IndoorPvs::fingerprint(*pIndoor));
+    EXPECT_EQ(pvs, IndoorPvs::compute(*pIndoor)); // Cached set is the same as the freshly computed one.
+
+    // Sectors sharing a portal always see each other.
+    for (const BLVFace &face : pIndoor->pFaces) {
+        if (!face.isPortal() || !face.uSectorID || !face.uBackSectorID)
+            continue;
+        EXPECT_TRUE(pvs.isVisible(face.uSectorID, face.uBackSectorID));
+        EXPECT_TRUE(pvs.isVisible(face.uBackSectorID, face.uSectorID));
+    }
+
+    // If an actor can see another actor, then the corresponding sectors must be in the set.
+    for (size_t i = 0; i < pActors.size(); i++) {
+        for (size_t j = 0; j < pActors.size(); j++) {
+            int sector1 = pActors[i].sectorId;
+            int sector2 = pActors[j].sectorId;
+            if (i == j || sector1 == sector2 || !sector1 || !sector2)
+                continue;
+            if (Detect_Between_Objects(Pid::actor(i), Pid::actor(j)))
+                EXPECT_TRUE(pvs.isVisible(sector1, sector2));
+        }
+    }
+}
+
+GAME_TEST(ParticleEngine, Capacity) {
+    // Particles that don't fit into the particle engine, or that are cut off when its capacity is reduced, should be
+    // dropped and counted. Any save will do, using the one from issue 1447.
+    constexpr int CAPACITY = 200;
+    test.loadGameFromTestData("issue_1447A.mm7");
+
+    ParticleEngine *particles = engine->particle_engine.get();
+    particles->setCapacity(CAPACITY);
+    particles->ResetParticles();
+    EXPECT_EQ(particles->capacity(), CAPACITY);
+    EXPECT_EQ(particles->particleCount(), 0);
+    EXPECT_EQ(particles->droppedCount(), 0);
+
+    SpriteObject sprite;
+    sprite.vPosition = pParty->pos.toInt() + Vec3i(0, 0, pParty->height);
+    while (particles->droppedCount() == 0)
+        engine->spell_fx_renedrer->_4A75CC_single_spell_collision_particle(&sprite, colorTable.OrangeyRed,
+                                                                           engine->spell_fx_renedrer->effpar01);
+    EXPECT_EQ(particles->particleCount(), CAPACITY);
+    int64_t droppedCount = particles->droppedCount();
+
+    particles->setCapacity(CAPACITY / 2);
+    EXPECT_EQ(particles->capacity(), CAPACITY / 2);
+    EXPECT_EQ(particles->particleCount(), CAPACITY / 2);
+    EXPECT_EQ(particles->droppedCount(), droppedCount + CAPACITY / 2);
+
+    particles->setCapacity(CAPACITY);
+    EXPECT_EQ(particles->particleCount(), CAPACITY / 2); // Growing doesn't bring the dropped particles back.
+    EXPECT_EQ(particles->droppedCount(), droppedCount + CAPACITY / 2);
+
+    particles->ResetParticles();
+    EXPECT_EQ(particles->particleCount(), 0);
+    EXPECT_EQ(particles->droppedCount(), 0);
+
+    particles->setCapacity(engine->config->graphics.ParticleCapacity.value());
+}
+
+GAME_TEST(CharacterItemBonusCache, MatchesUncached) {
+    // Cached item bonuses should match the ones computed from scratch as items are equipped, unequipped and broken,
+    // both when pEquipment is changed directly and when going through EquipBody. Any save will do, using the one from
+    // issue 1447.
+    test.loadGameFromTestData("issue_1447A.mm7");
+
+    auto checkItemBonuses = [] {
+        for (const Character &character : pParty->pCharacters)
+            for (CharacterAttributeType attr : allEnchantableAttributes())
+                EXPECT_EQ(character.GetItemsBonus(attr), uncachedItemsBonus(character, attr));
+    };
+    checkItemBonuses();
+
+    pParty->setActiveCharacterIndex(1); // EquipBody works on the active character.
+    Character &character = pParty->activeCharacter();
+    auto equipment = character.pEquipment;
+    for (ItemSlot slot : allItemSlots()) {
+        character.pEquipment[slot] = 0;
+        checkItemBonuses();
+    }
+    for (CharacterAttributeType attr : allEnchantableAttributes())
+        EXPECT_EQ(character.GetItemsBonus(attr), 0);
+
+    for (ItemSlot slot : allItemSlots()) {
+        character.pEquipment[slot] = equipment[slot];
+        checkItemBonuses();
+    }
+
+    // Take the items off into the hand & put them back on, the way the inventory screen does it. Rings & weapons are
+    // skipped as EquipBody would put them into a different slot.
+    for (ItemSlot slot : Segment(ITEM_SLOT_ARMOUR, ITEM_SLOT_AMULET)) {
+        if (!character.HasItemEquipped(slot))
+            continue;
+
+        ItemGen &equippedItem = character.pInventoryItemList[character.pEquipment[slot] - 1];
+        ItemGen item = equippedItem;
+        item.uBodyAnchor = ITEM_SLOT_INVALID;
+        equippedItem.Reset();
+        character.pEquipment[slot] = 0;
+        checkItemBonuses();
+
+        pParty->setHoldingItem(&item);
+        character.EquipBody(item.GetItemEquipType());
+        EXPECT_EQ(pParty->pPickedItem.uItemID, ITEM_NULL);
+        EXPECT_TRUE(character.HasItemEquipped(slot));
+        checkItemBonuses();
+    }
+
+    for (ItemSlot slot : allItemSlots())
+        if (character.HasItemEquipped(slot))
+            character.pInventoryItemList[character.pEquipment[slot] - 1].SetBroken();
+    checkItemBonuses();
+}
@@ -16,10 +16,11 @@
 
 #include "Library/Platform/Application/PlatformApplication.h"
 
-TestController::TestController(EngineController *controller, const std::string &testDataPath, float playbackSpeed):
+TestController::TestController(EngineController *controller, const std::string &testDataPath, float playbackSpeed, bool fastForward):
     _controller(controller),
     _testDataPath(testDataPath),
-    _playbackSpeed(playbackSpeed)
+    _playbackSpeed(playbackSpeed),
+    _fastForward(fastForward)
 {}
 
 std::string TestController::fullPathInTestData(const std::string &fileName) {
@@ -36,6 +37,9 @@ void TestController::playTraceFromTestData(const std::string &saveName, const st
 
 void TestController::playTraceFromTestData(const std::string &saveName, const std::string &traceName,
                                            EngineTracePlaybackFlags flags, std::function<void()> postLoadCallback) {
+    if (_fastForward)
+        flags |= TRACE_PLAYBACK_FAST_FORWARD;
+
     // TODO(captainurist): we need to overhaul our usage of path::string, path::u8string, path::generic_string,
     // pick one, and spell it out explicitly in HACKING
     ::application->component<EngineTracePlayer>()->playTrace(
@@ -17,7 +17,7 @@ class EngineController;
 
 class TestController {
  public:
-    TestController(EngineController *controller, const std::string &testDataPath, float playbackSpeed);
+    TestController(EngineController *controller, const std::string &testDataPath, float playbackSpeed, bool fastForward = false);
 
     std::string fullPathInTestData(const std::string &fileName);
 
@@ -49,5 +49,6 @@ class TestController {
     EngineController *_controller;
     std::filesystem::path _testDataPath;
     float _playbackSpeed;
+    bool _fastForward;
     std::vector<std::function<void()>> _tapeCallbacks;
 };